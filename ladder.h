@@ -62,6 +62,32 @@
 #define LADDER_MAX_ROWS 32
 #define LADDER_MAX_COLS 255
 
+/**
+ * @def LADDER_CACHE_LINE
+ * @brief Cache line size in bytes (context arrays allocated by the library start on it)
+ */
+#ifndef LADDER_CACHE_LINE
+#define LADDER_CACHE_LINE 64
+#endif
+
+/**
+ * @def LADDER_FLAG_WORDS
+ * @brief Words of a packed flags bank (64 flags per word, flag n is bit n % 64 of word n / 64)
+ */
+#define LADDER_FLAG_WORDS(qty) (((qty) >> 6) + (((qty) & 63) != 0))
+
+/**
+ * @def LADDER_CUSTOM_MAX
+ * @brief Custom instruction codes (LADDER_INS_CUSTOM to LADDER_INS_CUSTOM + LADDER_CUSTOM_MAX - 1)
+ */
+#define LADDER_CUSTOM_MAX 32
+
+/**
+ * @def LADDER_CUSTOM_DATA
+ * @brief Maximum operands of a custom instruction
+ */
+#define LADDER_CUSTOM_DATA 8
+
 /**
  * @def OPTIONAL_CRON
  * @brief Include CRON
@@ -69,6 +95,53 @@
  */
 #define OPTIONAL_CRON 1
 
+/**
+ * @def OPTIONAL_COMPILED
+ * @brief Include compiled scan engines (compiled, incremental and batch lanes), program optimizer and C generator
+ *
+ */
+//#define OPTIONAL_COMPILED 1
+
+/**
+ * @def OPTIONAL_PARALLEL
+ * @brief Include parallel scan engine (needs POSIX threads)
+ *
+ */
+//#define OPTIONAL_PARALLEL 1
+
+/**
+ * @def OPTIONAL_JIT
+ * @brief Include native code scan engine (x86-64 with GCC or Clang on POSIX systems, other targets keep the compiled engine)
+ *
+ */
+//#define OPTIONAL_JIT 1
+
+/**
+ * @def OPTIONAL_HOST
+ * @brief Include host scheduler running many contexts on a thread pool (needs POSIX threads)
+ *
+ */
+//#define OPTIONAL_HOST 1
+
+/**
+ * @def OPTIONAL_FARM
+ * @brief Include scenario farm running many batch simulations of a program on a thread pool (needs POSIX threads)
+ *
+ */
+//#define OPTIONAL_FARM 1
+
+/**
+ * @def OPTIONAL_PACKED_HISTORY
+ * @brief Keep previous scan flags (prev_scan_vals) packed 64 per word (*_bits fields) instead of one byte per flag
+ *
+ */
+//#define OPTIONAL_PACKED_HISTORY 1
+
+// engines built on the compiled program
+#if !defined(OPTIONAL_COMPILED) && (defined(OPTIONAL_PARALLEL) || defined(OPTIONAL_JIT) || defined(OPTIONAL_FARM))
+#define OPTIONAL_COMPILED 1
+#endif
+
 /**
  * @enum LADDER_INSTRUCTIONS
  * @brief Ladder Instructions codes
@@ -115,6 +188,7 @@ typedef enum LADDER_INSTRUCTIONS {
     //...//
     LADDER_INS_INV,     /**< First invalid */
     LADDER_INS_MULTI,   /**< cell is a part of multi cell instruction */
+    LADDER_INS_CUSTOM,  /**< First custom instruction (see ladder_add_instruction) */
 } ladder_instruction_t;
 
 /**
@@ -152,6 +226,23 @@ typedef enum LADDER_INS_ERROR {
     LADDER_INS_ERR_FAIL,         /**< Generic fail */
 } ladder_ins_err_t;
 
+/**
+ * @enum LADDER_SCAN_ENGINE
+ * @brief Scan engine
+ *
+ */
+typedef enum LADDER_SCAN_ENGINE {
+    LADDER_ENGINE_INTERPRETER, /**< Interpret networks cell by cell */
+    LADDER_ENGINE_COMPILED,    /**< Execute networks compiled to rung bytecode (OPTIONAL_COMPILED) */
+    LADDER_ENGINE_INCREMENTAL, /**< Execute compiled rungs only when registers they use changed (or they hold timers, counters, edges or foreign
+                                    instructions). Skipped rungs don't call on.scan_end nor update ladder.last (OPTIONAL_COMPILED) */
+    LADDER_ENGINE_PARALLEL,    /**< Execute compiled networks not sharing registers concurrently on a worker pool (OPTIONAL_PARALLEL). Results match
+                                    the compiled engine scan by scan; per instruction or scan end hooks select the compiled engine */
+    LADDER_ENGINE_JIT,         /**< Execute networks translated to native code (OPTIONAL_JIT). Generic instructions are called from native code,
+                                    networks over the watchdog budget are interpreted and per instruction hooks select the interpreter */
+    LADDER_ENGINE_GENERATED,   /**< Execute the scan function of a program translated to C by ladder_program_to_c (set with ladder_set_generated) */
+} ladder_scan_engine_t;
+
 /**
  * @enum LADDER_DATA_TYPE
  * @brief Data types
@@ -260,23 +351,27 @@ typedef struct ladder_value_s {
  *
  */
 typedef struct ladder_cell_s {
+         ladder_value_t *data;         /**< Data (in the network data pool after ladder_program_compact) */
+    ladder_instruction_t code;         /**< Code */
                     bool state;        /**< Output state */
                     bool vertical_bar; /**< Have vertical bar */
-    ladder_instruction_t code;         /**< Code */
                  uint8_t data_qty;     /**< Data quantity */
-         ladder_value_t *data;         /**< Data */
 } ladder_cell_t;
 
 /**
  * @struct ladder_network_s
- * @brief
+ * @brief Network. Cells must be allocated with ladder_network_alloc (one block): the library walks them by flat index and frees them with
+ *        one free, so networks whose rows are allocated one by one are not supported.
  *
  */
 typedef struct ladder_network_s {
-             bool enable;  /**< Enabled for execution */
-         uint32_t rows;    /**< Rows qty */
-         uint32_t cols;    /**< Columns qty */
-    ladder_cell_t **cells; /**< Cells */
+              bool enable;   /**< Enabled for execution */
+          uint32_t rows;     /**< Rows qty */
+          uint32_t cols;     /**< Columns qty */
+          uint32_t pool_qty; /**< Data pool values qty */
+    ladder_cell_t **cells;   /**< Cells (row pointers and rows * cols cells in one block) */
+    ladder_value_t *pool;    /**< Data pool: data of all cells in one block (see ladder_program_compact) */
+              void *arena;   /**< Program arena holding cells data and strings (internal, NULL: heap) */
 } ladder_network_t;
 
 /**
@@ -295,13 +390,18 @@ typedef struct ladder_timer_s {
  *
  */
 typedef struct ladder_s {
-    ladder_state_t state;          /**< State */
-              bool write_on_fault; /**< if true, perform writes even on INV/ERROR before exit. Default: true. */
+          ladder_state_t state;          /**< State */
+    ladder_scan_engine_t engine;         /**< Scan engine */
+                uint32_t workers;        /**< Parallel engine threads including the caller (0: one per online processor) */
+                    bool sealed;         /**< Program proven well formed by ladder_program_check: operands are accessed unchecked (cleared by any change) */
+                    bool optimize;       /**< Compiled engines run the optimized program (see ladder_program_optimize) */
+                    bool jit_check;      /**< JIT engine runs every scan on the interpreter too and stops on any difference */
+                    bool write_on_fault; /**< if true, perform writes even on INV/ERROR before exit. Default: true. */
     struct {
-         uint8_t instr;       /**< Last executed instruction */
         uint32_t network;     /**< Last executed network */
         uint32_t cell_column; /**< Last executed cell column */
         uint32_t cell_row;    /**< Last executed cell row */
+         uint8_t instr;       /**< Last executed instruction */
          uint8_t err;         /**< Last executed error */
     } last;
 
@@ -396,6 +496,14 @@ typedef void (*_on_panic)(ladder_ctx_t* ladder_ctx);
  */
 typedef void (*_on_end_task)(ladder_ctx_t* ladder_ctx);
 
+/**
+ * @fn void (*_generated_scan)(ladder_ctx_t *ladder_ctx)
+ * @brief Scan of a program translated to C
+ *
+ * @param ladder_ctx Ladder context
+ */
+typedef void (*_generated_scan)(ladder_ctx_t* ladder_ctx);
+
 /**
  * @fn void (*_delay)(long msec)
  * @brief Delay in milliseconds
@@ -439,11 +547,11 @@ typedef struct ladder_hw_s {
  *
  */
 typedef struct ladder_manage_s {
-       _on_scan_end scan_end;    /**< Manage for every scan cycle */
     _on_instruction instruction; /**< Manage for every instruction call */
+       _on_scan_end scan_end;    /**< Manage for every scan cycle */
+          _on_panic panic;       /**< Manage panic status */
     _on_task_before task_before; /**< Manage for every task cycle before scan */
      _on_task_after task_after;  /**< Manage for every task cycle after scan */
-          _on_panic panic;       /**< Manage panic status */
        _on_end_task end_task;    /**< Manage for end task */
 } ladder_manage_t;
 
@@ -465,11 +573,19 @@ typedef struct ladder_memory_s {
  *
  */
 typedef struct ladder_prev_scan_vals_s {
-    uint8_t *Mh;  /**< Regular flags previous */
-       bool *Crh; /**< Counter running previous */
-       bool *Cdh; /**< Counter done previous */
-       bool *Trh; /**< Timer running previous */
-       bool *Tdh; /**< Timer done previous */
+#ifdef OPTIONAL_PACKED_HISTORY
+    uint64_t *Mh_bits;  /**< Regular flags previous (packed) */
+    uint64_t *Crh_bits; /**< Counter running previous (packed) */
+    uint64_t *Cdh_bits; /**< Counter done previous (packed) */
+    uint64_t *Trh_bits; /**< Timer running previous (packed) */
+    uint64_t *Tdh_bits; /**< Timer done previous (packed) */
+#else
+     uint8_t *Mh;       /**< Regular flags previous */
+        bool *Crh;      /**< Counter running previous */
+        bool *Cdh;      /**< Counter done previous */
+        bool *Trh;      /**< Timer running previous */
+        bool *Tdh;      /**< Timer done previous */
+#endif
 } ladder_prev_scan_vals_t;
 
 /**
@@ -519,14 +635,14 @@ typedef struct ladder_hw_output_vals_s {
  *
  */
 typedef struct ladder_scan_internals_s {
-    uint64_t actual_scan_time; /**< Actual scan time */
     uint64_t start_time;       /**< Start time for calculate scan time */
     uint64_t max_scan_cycles;  /**< Watchdog */
-     int32_t target_scan_ms;   /**< Target scan cycle time in ms (0 to disable padding) */
+    uint64_t actual_scan_time; /**< Actual scan time */
     uint64_t min_scan_time;    /**< Minimum scan time observed */
     uint64_t max_scan_time;    /**< Maximum scan time observed */
     uint64_t total_scan_time;  /**< Cumulative total for average */
     uint64_t avg_scan_time;    /**< Average scan time */
+     int32_t target_scan_ms;   /**< Target scan cycle time in ms (0 to disable padding) */
     uint32_t scan_count;       /**< Number of scans for average */
         bool overrun;          /**< Flag if last scan exceeded target_scan_ms */
 } ladder_scan_internals_t;
@@ -534,15 +650,65 @@ typedef struct ladder_scan_internals_s {
 
 
 /**
- * @fn  ladder_ins_err_t (*ladder_fn_t)(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row, bool *state)
+ * @struct ladder_frame_s
+ * @brief Instruction execution frame: cell and operands resolved by the scan engine before the call
+ *
+ */
+typedef struct ladder_frame_s {
+                     ladder_ctx_t *ctx;    /**< Ladder context */
+                 ladder_network_t *net;    /**< Executing network */
+                    ladder_cell_t *cell;   /**< Instruction cell */
+                   ladder_value_t *data;   /**< Cell operands (cell->data) */
+                          uint32_t column; /**< Column */
+                          uint32_t row;    /**< Row */
+                          uint32_t left;   /**< Left power: bit n is the power at the left of row + n */
+    const struct ladder_operand_s *bound;  /**< Operands bound by the compiler (custom instructions) or NULL. Read through ladder_frame_get/set */
+} ladder_frame_t;
+
+/**
+ * @fn  ladder_ins_err_t (*ladder_fn_t)(const ladder_frame_t *frame)
  * @brief Instruction prototype
  *
+ * @param frame Execution frame
+ * @return Status
+ */
+typedef ladder_ins_err_t (*ladder_fn_t)(const ladder_frame_t *frame);
+
+/**
+ * @enum LADDER_SIGNATURE
+ * @brief Custom instruction operand role
+ *
+ */
+typedef enum LADDER_SIGNATURE {
+    LADDER_SIG_ANY,   /**< Unknown use: never bound, instruction assumed to read and write anything */
+    LADDER_SIG_READ,  /**< Source operand */
+    LADDER_SIG_WRITE, /**< Destination operand */
+} ladder_signature_t;
+
+/**
+ * @struct ladder_custom_s
+ * @brief Custom instruction: executed, bound and analyzed by every scan engine as a builtin instruction
+ *
+ */
+typedef struct ladder_custom_s {
+          ladder_instruction_t code;                          /**< Code (LADDER_INS_CUSTOM to LADDER_INS_CUSTOM + LADDER_CUSTOM_MAX - 1) */
+                          char name[7];                       /**< Name */
+    ladder_instructions_iocd_t description;                   /**< Inputs, outputs, occupied cells and operands (up to LADDER_CUSTOM_DATA) */
+                   ladder_fn_t exec;                          /**< Instruction function */
+                          bool side_effects;                  /**< Must run without power and on every scan (time, edges, internal state) */
+                       uint8_t signature[LADDER_CUSTOM_DATA]; /**< Operand roles (ladder_signature_t) */
+} ladder_custom_t;
+
+/**
+ * @fn  ladder_ins_err_t (*ladder_foreign_fn_t)(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @brief Foreign function prototype (cell addressed by column and row, power read from the network cells)
+ *
  * @param ladder_ctx Ladder context
  * @param column Column
  * @param row Row
  * @return Status
  */
-typedef ladder_ins_err_t (*ladder_fn_t)(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+typedef ladder_ins_err_t (*ladder_foreign_fn_t)(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
 
 typedef struct ladder_foreign_function_s ladder_foreign_function_t;
 
@@ -575,7 +741,7 @@ typedef struct ladder_foreign_function_s {
                       uint32_t id;          /**< Foreign function id */
                           char name[7];     /**< Foreign function name */
     ladder_instructions_iocd_t description; /**< Foreign function description */
-                   ladder_fn_t exec;        /**< Foreign functions pointers */
+           ladder_foreign_fn_t exec;        /**< Foreign functions pointers */
             _foreign_fn_deinit deinit;      /**< Foreign functions deinitializer pointers */
                           void *data;       /**< Internal data for foreign functions */
 } ladder_foreign_function_t;
@@ -594,24 +760,34 @@ typedef struct ladder_foreign_s {
  * @struct ladder_ctx_s
  * @brief Ladder context
  *
+ * Fields read on every cell come first (internals; networks, registers and timers; memory areas; hooks), then the task cycle fields and last
+ * the configuration only used on load or change.
  */
 typedef struct ladder_ctx_s {
                    ladder_t ladder;         /**< Internals */
-                ladder_hw_t hw;             /**< Hardware functions */
-            ladder_manage_t on;             /**< Manage functions */
+           ladder_network_t *exec_network;  /**< Network in execution */
+           ladder_network_t *network;       /**< Networks */
+                       void *topology;      /**< Program topology (internal) */
+                       void *compiled;      /**< Compiled program (internal) */
+         ladder_registers_t registers;      /**< Registers */
+             ladder_timer_t *timers;        /**< Timers */
             ladder_memory_t memory;         /**< Memory */
-    ladder_prev_scan_vals_t prev_scan_vals; /**< Previous scan values */
      ladder_hw_input_vals_t *input;         /**< Hw inputs */
     ladder_hw_output_vals_t *output;        /**< Hw outputs */
-         ladder_registers_t registers;      /**< Registers */
-             ladder_timer_t *timers;        /**< Timers */
+            ladder_custom_t *custom;        /**< Custom instructions by code - LADDER_INS_CUSTOM (NULL before the first one is added) */
+            ladder_manage_t on;             /**< Manage functions */
+            _generated_scan generated;      /**< Scan function of the generated engine */
     ladder_scan_internals_t scan_internals; /**< Scan internals */
-           ladder_network_t *network;       /**< Networks */
-           ladder_network_t *exec_network;  /**< Network in execution */
+                ladder_hw_t hw;             /**< Hardware functions */
+    ladder_prev_scan_vals_t prev_scan_vals; /**< Previous scan values */
            ladder_foreign_t foreign;        /**< Foreign functions */
+                       void *arena;         /**< Program arena (internal) */
            #ifdef OPTIONAL_CRON
                       void *cron;           /*< Cron list */
            #endif
+           #ifdef OPTIONAL_PARALLEL
+                      void *parallel;       /**< Parallel engine worker pool (internal) */
+           #endif
 } ladder_ctx_t;
 
 /**
@@ -629,6 +805,18 @@ static inline bool LADDER_VERTICAL_BAR(const ladder_ctx_t *lctx, uint32_t n, uin
             lctx->network[n].cells[r][c].vertical_bar : false;
 }
 
+/**
+ * @fn ladder_cell_t* ladder_network_cell(const ladder_network_t*, uint32_t)
+ * @brief Point to cell by flat index (row * cols + column). Network cells are stored row by row in one block (ladder_network_alloc).
+ *
+ * @param network Network
+ * @param index Flat index
+ * @return Cell
+ */
+static inline ladder_cell_t* ladder_network_cell(const ladder_network_t *network, uint32_t index) {
+    return &network->cells[0][index];
+}
+
 /**
  * @fn bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t net_rows_qty, uint32_t networks_qty, uint32_t qty_m, uint32_t qty_c,
  *  uint32_t qty_t, uint32_t qty_d, uint32_t qty_r, uint32_t delay_not_run, uint32_t watchdog_ms, bool init_network, bool write_on_fault,
@@ -674,6 +862,16 @@ bool ladder_ctx_deinit(ladder_ctx_t *ladder_ctx);
  */
 void ladder_task(void *ladderctx);
 
+/**
+ * @fn bool ladder_task_step(ladder_ctx_t *ladder_ctx)
+ * @brief Execute one task cycle (inputs, scan, outputs and task hooks) without waiting for the target scan time.
+ *        Nothing is executed if the context is not running.
+ *
+ * @param ladder_ctx Ladder context
+ * @return False when the task must end (invalid context, fault or LADDER_ST_EXIT_TSK). on.end_task is not called.
+ */
+bool ladder_task_step(ladder_ctx_t *ladder_ctx);
+
 /**
  * @fn void ladder_clear_program(ladder_ctx_t *ladder_ctx)
  * @brief Delete all networks
@@ -682,6 +880,44 @@ void ladder_task(void *ladderctx);
  */
 void ladder_clear_program(ladder_ctx_t *ladder_ctx);
 
+/**
+ * @fn bool ladder_network_alloc(ladder_network_t *network, uint32_t rows, uint32_t cols)
+ * @brief Allocate network cells in one block: row pointers followed by rows * cols empty cells. Previous cells are freed.
+ *
+ * @param network Network
+ * @param rows Rows
+ * @param cols Columns
+ * @return Status
+ */
+bool ladder_network_alloc(ladder_network_t *network, uint32_t rows, uint32_t cols);
+
+/**
+ * @fn void ladder_network_free(ladder_network_t *network)
+ * @brief Free network cells, their data and the data pool. Cells must come from ladder_network_alloc.
+ *
+ * @param network Network
+ */
+void ladder_network_free(ladder_network_t *network);
+
+/**
+ * @fn void ladder_cell_data_free(ladder_network_t *network, ladder_cell_t *cell)
+ * @brief Free cell data and its strings. Data in the network pool is only detached from the cell.
+ *
+ * @param network Network of the cell
+ * @param cell Cell
+ */
+void ladder_cell_data_free(ladder_network_t *network, ladder_cell_t *cell);
+
+/**
+ * @fn bool ladder_program_compact(ladder_ctx_t *ladder_ctx)
+ * @brief Move data of all cells of each network into one pool, in cell order. Called by programs loaded from generated C
+ *        (ladder_program_to_c); the JSON loader uses the program arena instead.
+ *
+ * @param ladder_ctx Ladder context
+ * @return Status
+ */
+bool ladder_program_compact(ladder_ctx_t *ladder_ctx);
+
 /**
  * @fn bool ladder_add_read_fn(ladder_ctx_t*, _io_read read, _io_init read_init)
  * @brief Add read inputs function
@@ -716,6 +952,16 @@ bool ladder_add_write_fn(ladder_ctx_t *ladder_ctx, _io_write write, _io_init wri
  */
 bool ladder_add_foreign(ladder_ctx_t *ladder_ctx, _foreign_fn_init fn_init, void *init_data, uint32_t qty);
 
+/**
+ * @fn bool ladder_add_instruction(ladder_ctx_t *ladder_ctx, const ladder_custom_t *instruction)
+ * @brief Register a custom instruction. Cells take it with ladder_fn_cell(ladder_ctx, network, row, column, instruction->code, 0).
+ *
+ * @param ladder_ctx Ladder context
+ * @param instruction Instruction (copied)
+ * @return Status
+ */
+bool ladder_add_instruction(ladder_ctx_t *ladder_ctx, const ladder_custom_t *instruction);
+
 /**
  * @fn bool ladder_fn_cell(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t row, uint32_t column, ladder_instruction_t function, uint32_t foreign_id)
  * @brief Add function and allocate data in cell
@@ -730,6 +976,73 @@ bool ladder_add_foreign(ladder_ctx_t *ladder_ctx, _foreign_fn_init fn_init, void
  */
 bool ladder_fn_cell(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t row, uint32_t column, ladder_instruction_t function, uint32_t foreign_id);
 
+/**
+ * @fn bool ladder_set_engine(ladder_ctx_t *ladder_ctx, ladder_scan_engine_t engine)
+ * @brief Select scan engine used by ladder_task (fails with LADDER_INS_ERR_OUTOFRANGE on engines not built in)
+ *
+ * @param ladder_ctx Ladder context
+ * @param engine Scan engine
+ * @return Status
+ */
+bool ladder_set_engine(ladder_ctx_t *ladder_ctx, ladder_scan_engine_t engine);
+
+#ifdef OPTIONAL_PARALLEL
+/**
+ * @fn bool ladder_set_workers(ladder_ctx_t *ladder_ctx, uint32_t workers)
+ * @brief Set threads used by the parallel engine, including the one calling ladder_task. Running workers are stopped and started again on next scan.
+ *
+ * @param ladder_ctx Ladder context
+ * @param workers Threads quantity (0 or more than online processors: one per online processor, 1: no worker threads)
+ * @return Status
+ */
+bool ladder_set_workers(ladder_ctx_t *ladder_ctx, uint32_t workers);
+#endif
+
+#ifdef OPTIONAL_JIT
+/**
+ * @fn bool ladder_set_jit_check(ladder_ctx_t *ladder_ctx, bool check)
+ * @brief Run the JIT engine in lockstep with the interpreter. Every scan is executed by both from the same state (with a frozen millis() and
+ *        cron evaluated once), the interpreter result is kept and any difference sets LADDER_ST_ERROR and calls on.panic.
+ *        Foreign functions, scan end and panic hooks are called by both executions.
+ *
+ * @param ladder_ctx Ladder context
+ * @param check Enable check
+ * @return Status
+ */
+bool ladder_set_jit_check(ladder_ctx_t *ladder_ctx, bool check);
+#endif
+
+/**
+ * @fn bool ladder_set_generated(ladder_ctx_t *ladder_ctx, _generated_scan scan)
+ * @brief Set the scan function used by the generated engine (the <prefix>_scan function of a file written by ladder_program_to_c)
+ *
+ * @param ladder_ctx Ladder context
+ * @param scan Scan function (NULL: generated engine not available)
+ * @return Status
+ */
+bool ladder_set_generated(ladder_ctx_t *ladder_ctx, _generated_scan scan);
+
+/**
+ * @fn bool ladder_flag_edges(ladder_ctx_t *ladder_ctx, ladder_register_t type, uint64_t *rising, uint64_t *falling)
+ * @brief Compare a flags bank with its previous scan values, 64 flags per word
+ *
+ * @param ladder_ctx Ladder context
+ * @param type Flags bank (M, Cd, Cr, Td or Tr)
+ * @param rising Packed flags set since previous scan (LADDER_FLAG_WORDS(quantity) words, can be NULL)
+ * @param falling Packed flags reset since previous scan (LADDER_FLAG_WORDS(quantity) words, can be NULL)
+ * @return Status
+ */
+bool ladder_flag_edges(ladder_ctx_t *ladder_ctx, ladder_register_t type, uint64_t *rising, uint64_t *falling);
+
+/**
+ * @fn void ladder_program_changed(ladder_ctx_t *ladder_ctx)
+ * @brief Discard data derived from the program (topology and compiled code) and unseal it.
+ *        Must be called after editing cells code, data or vertical bars directly; ladder_fn_cell, ladder_clear_program and the json loader call it.
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_program_changed(ladder_ctx_t *ladder_ctx);
+
 /**
  * @fn bool ladder_fault_clear(ladder_ctx_t *ladder_ctx)
  * @brief Clear fault state and reset to running, for watchdog recovery.
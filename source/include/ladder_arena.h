@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_ARENA_H
+#define LADDER_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ladder.h"
+
+/**
+ * @struct ladder_arena_block_s
+ * @brief Arena block. Data follows the header.
+ *
+ */
+typedef struct ladder_arena_block_s {
+    struct ladder_arena_block_s *next; /**< Previous block */
+                         size_t size;  /**< Data size */
+                         size_t used;  /**< Data used */
+} ladder_arena_block_t;
+
+/**
+ * @struct ladder_arena_s
+ * @brief Program arena: cells data and interned strings of a loaded program, released at once
+ *
+ */
+typedef struct ladder_arena_s {
+    ladder_arena_block_t *block;        /**< Blocks, last allocated first */
+                  size_t block_size;    /**< Minimum size of the next block */
+             const char **strings;      /**< Interned strings (open addressing hash table) */
+                uint32_t strings_size;  /**< Hash table size (power of two) */
+                uint32_t strings_qty;   /**< Interned strings quantity */
+} ladder_arena_t;
+
+/**
+ * @fn ladder_arena_t* ladder_arena_get(ladder_ctx_t *ladder_ctx, size_t block_size)
+ * @brief Get the program arena, creating it if needed
+ *
+ * @param ladder_ctx Ladder context
+ * @param block_size Size of the first block (expected program data size)
+ * @return Arena or NULL on allocation failure
+ */
+ladder_arena_t* ladder_arena_get(ladder_ctx_t *ladder_ctx, size_t block_size);
+
+/**
+ * @fn void ladder_arena_free(ladder_ctx_t *ladder_ctx)
+ * @brief Release the program arena. Networks using it are detached, cells pointing into it must have been cleared.
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_arena_free(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn void* ladder_arena_alloc(ladder_arena_t *arena, size_t size)
+ * @brief Allocate zeroed memory
+ *
+ * @param arena Arena
+ * @param size Size
+ * @return Memory (aligned as malloc) or NULL on allocation failure
+ */
+void* ladder_arena_alloc(ladder_arena_t *arena, size_t size);
+
+/**
+ * @fn const char* ladder_arena_strdup(ladder_arena_t *arena, const char *str)
+ * @brief Intern a string: equal strings share one copy
+ *
+ * @param arena Arena
+ * @param str String
+ * @return Interned string or NULL on allocation failure
+ */
+const char* ladder_arena_strdup(ladder_arena_t *arena, const char *str);
+
+/**
+ * @fn bool ladder_arena_owns(const ladder_arena_t *arena, const void *ptr)
+ * @brief Memory allocated from the arena
+ *
+ * @param arena Arena (can be NULL)
+ * @param ptr Pointer
+ * @return Owned
+ */
+bool ladder_arena_owns(const ladder_arena_t *arena, const void *ptr);
+
+#endif /* LADDER_ARENA_H */
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_BATCH_H
+#define LADDER_BATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_COMPILED
+
+/**
+ * @def LADDER_BATCH_LANES
+ * @brief Maximum instances of a batch (one bit of a power word each)
+ */
+#define LADDER_BATCH_LANES 64
+
+/**
+ * @struct ladder_batch_s
+ * @brief Instances of one program scanned in lockstep on a virtual clock. Power flow of each cell is a word with one bit per instance:
+ *        contacts, coils, connectors and bound compare and arithmetic operations run once for every instance, other instructions run their
+ *        cell function on each instance. Cell states of the instances are only written for the cells run through their function and
+ *        instances run without cron.
+ *
+ */
+typedef struct ladder_batch_s ladder_batch_t;
+
+/**
+ * @fn void (*ladder_batch_io_fn)(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg)
+ * @brief Inputs and outputs of an instance module
+ *
+ * @param ladder_ctx Instance context
+ * @param lane Instance
+ * @param id Module
+ * @param tick Scan number
+ * @param arg Argument
+ */
+typedef void (*ladder_batch_io_fn)(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg);
+
+/**
+ * @struct ladder_batch_io_s
+ * @brief Scenario of a batch
+ *
+ */
+typedef struct ladder_batch_io_s {
+    ladder_batch_io_fn read;  /**< Set inputs of a module before the scan (NULL: inputs are kept) */
+    ladder_batch_io_fn write; /**< Collect outputs of a module after the scan (NULL: not collected) */
+                  void *arg;  /**< Argument of read and write */
+} ladder_batch_io_t;
+
+/**
+ * @fn ladder_batch_t* ladder_batch_init(ladder_ctx_t *ladder_ctx, uint32_t lanes, const ladder_batch_io_t *io)
+ * @brief Create instances of the program of a context. Each instance starts with the memory, registers and I/O values of the context and
+ *        gets I/O modules of the same size (created with the init functions of the context). Instances are running.
+ *
+ * @param ladder_ctx Ladder context (program without FOREIGN instructions)
+ * @param lanes Instances (1 to LADDER_BATCH_LANES)
+ * @param io Scenario
+ * @return Batch or NULL on failure
+ */
+ladder_batch_t* ladder_batch_init(ladder_ctx_t *ladder_ctx, uint32_t lanes, const ladder_batch_io_t *io);
+
+/**
+ * @fn void ladder_batch_deinit(ladder_batch_t *batch)
+ * @brief Delete instances and free batch
+ *
+ * @param batch Batch
+ */
+void ladder_batch_deinit(ladder_batch_t *batch);
+
+/**
+ * @fn ladder_ctx_t* ladder_batch_lane(ladder_batch_t *batch, uint32_t lane)
+ * @brief Context of an instance. Its program must not be changed.
+ *
+ * @param batch Batch
+ * @param lane Instance
+ * @return Context or NULL
+ */
+ladder_ctx_t* ladder_batch_lane(ladder_batch_t *batch, uint32_t lane);
+
+/**
+ * @fn uint64_t ladder_batch_run(ladder_batch_t *batch, uint64_t ticks, uint32_t period_ms)
+ * @brief Run task cycles of every running instance. millis() of the instances starts at 0 and moves period_ms after each cycle, so runs are
+ *        repeatable. An instance leaves the batch when its task ends (fault).
+ *
+ * @param batch Batch
+ * @param ticks Cycles
+ * @param period_ms Virtual time of a cycle
+ * @return Running instances (bit n: instance n)
+ */
+uint64_t ladder_batch_run(ladder_batch_t *batch, uint64_t ticks, uint32_t period_ms);
+
+#endif /* OPTIONAL_COMPILED */
+
+#endif /* LADDER_BATCH_H */
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_BIND_H
+#define LADDER_BIND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ladder.h"
+
+/**
+ * @enum LADDER_OPERAND
+ * @brief Bound operand storage
+ *
+ */
+typedef enum LADDER_OPERAND {
+    LADDER_OPERAND_NONE,  /**< No storage: reads return 0, writes are discarded */
+    LADDER_OPERAND_CONST, /**< Constant value */
+    LADDER_OPERAND_U8,    /**< uint8_t register (M, I, Q) */
+    LADDER_OPERAND_BOOL,  /**< bool register (Cd, Cr, Td, Tr) */
+    LADDER_OPERAND_U32,   /**< uint32_t register (C) */
+    LADDER_OPERAND_I32,   /**< int32_t register (D, IW, QW) */
+    LADDER_OPERAND_REAL,  /**< float register (R) */
+    LADDER_OPERAND_TIMER, /**< Timer accumulator (clipped to INT32_MAX) */
+} ladder_operand_kind_t;
+
+/**
+ * @struct ladder_operand_s
+ * @brief Operand resolved to a typed register address or a constant
+ *
+ */
+typedef struct ladder_operand_s {
+     uint8_t kind;      /**< Storage (ladder_operand_kind_t) */
+     uint8_t size;      /**< Bytes copied on write (same as ladder_set_data_value) */
+     uint8_t prev_mask; /**< Previous scan value bits in *prev (packed history or whole byte) */
+     int32_t value;     /**< Constant value */
+        void *ptr;      /**< Register address */
+    uint8_t *prev;      /**< Previous scan value (bit operands) */
+} ladder_operand_t;
+
+/**
+ * @def LADDER_BIND_MODULE_ENTRIES
+ * @brief Key entries per I/O module
+ */
+#define LADDER_BIND_MODULE_ENTRIES 5
+
+/**
+ * @struct ladder_bind_key_s
+ * @brief Register banks and I/O module arrays seen when binding. Operands are valid while the key matches the context.
+ *
+ */
+typedef struct ladder_bind_key_s {
+     uint32_t quantity[5]; /**< Quantity of m, c, t, d, r */
+         void *bank[16];   /**< Register banks, history banks, timers and I/O modules */
+     uint32_t read_qty;    /**< Read modules */
+     uint32_t write_qty;   /**< Write modules */
+    uintptr_t *io;         /**< Per module values arrays and quantities (LADDER_BIND_MODULE_ENTRIES each) */
+} ladder_bind_key_t;
+
+/**
+ * @fn static inline int32_t ladder_operand_get(const ladder_operand_t *operand)
+ * @brief Read bound operand (same result as ladder_get_data_value)
+ *
+ * @param operand Operand
+ * @return Value
+ */
+static inline int32_t ladder_operand_get(const ladder_operand_t *operand) {
+    switch (operand->kind) {
+        case LADDER_OPERAND_CONST:
+            return operand->value;
+        case LADDER_OPERAND_U8:
+            return (int32_t) *(const uint8_t*) operand->ptr;
+        case LADDER_OPERAND_BOOL:
+            return (int32_t) *(const bool*) operand->ptr;
+        case LADDER_OPERAND_U32:
+            return (int32_t) *(const uint32_t*) operand->ptr;
+        case LADDER_OPERAND_I32:
+            return *(const int32_t*) operand->ptr;
+        case LADDER_OPERAND_REAL:
+            return (int32_t) *(const float*) operand->ptr;
+        case LADDER_OPERAND_TIMER: {
+            uint32_t acc = *(const uint32_t*) operand->ptr;
+            return acc > (uint32_t) INT32_MAX ? INT32_MAX : (int32_t) acc;
+        }
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @fn static inline void ladder_operand_set(const ladder_operand_t *operand, const void *value)
+ * @brief Write bound operand (same effect as ladder_set_data_value)
+ *
+ * @param operand Operand
+ * @param value Value
+ */
+static inline void ladder_operand_set(const ladder_operand_t *operand, const void *value) {
+    if (operand->ptr != NULL)
+        memcpy(operand->ptr, value, operand->size);
+}
+
+/**
+ * @fn bool ladder_bind_bit(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand)
+ * @brief Bind a M, I or Q operand with its previous scan value. Used by contacts and coils.
+ *
+ * @param ladder_ctx Ladder context
+ * @param value Cell value
+ * @param operand Bound operand
+ * @return False if the value can't be accessed without the error paths of ladder_get_data_value
+ */
+bool ladder_bind_bit(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand);
+
+/**
+ * @fn bool ladder_bind_read(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand)
+ * @brief Bind a numeric source operand
+ *
+ * @param ladder_ctx Ladder context
+ * @param value Cell value
+ * @param operand Bound operand
+ * @return False if the value can't be accessed without the error paths of ladder_get_data_value
+ */
+bool ladder_bind_read(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand);
+
+/**
+ * @fn void ladder_bind_write(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand)
+ * @brief Bind a destination operand. Destinations rejected by ladder_set_data_value are bound to LADDER_OPERAND_NONE.
+ *
+ * @param ladder_ctx Ladder context
+ * @param value Cell value
+ * @param operand Bound operand
+ */
+void ladder_bind_write(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand);
+
+/**
+ * @fn bool ladder_bind_key(ladder_ctx_t *ladder_ctx, ladder_bind_key_t *key)
+ * @brief Take a snapshot of register banks and I/O module arrays
+ *
+ * @param ladder_ctx Ladder context
+ * @param key Key
+ * @return Status
+ */
+bool ladder_bind_key(ladder_ctx_t *ladder_ctx, ladder_bind_key_t *key);
+
+/**
+ * @fn bool ladder_bind_key_valid(ladder_ctx_t *ladder_ctx, const ladder_bind_key_t *key)
+ * @brief Check that banks and I/O modules were not reallocated since the snapshot
+ *
+ * @param ladder_ctx Ladder context
+ * @param key Key
+ * @return True if bound operands are still valid
+ */
+bool ladder_bind_key_valid(ladder_ctx_t *ladder_ctx, const ladder_bind_key_t *key);
+
+/**
+ * @fn void ladder_bind_key_free(ladder_bind_key_t *key)
+ * @brief Free key
+ *
+ * @param key Key
+ */
+void ladder_bind_key_free(ladder_bind_key_t *key);
+
+#endif /* LADDER_BIND_H */
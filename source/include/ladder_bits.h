@@ -0,0 +1,257 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_BITS_H
+#define LADDER_BITS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ladder.h"
+
+/**
+ * @fn static inline bool ladder_bits_get(const uint64_t *words, uint32_t idx)
+ * @brief Read packed flag
+ *
+ * @param words Packed flags
+ * @param idx Flag
+ * @return Flag value
+ */
+static inline bool ladder_bits_get(const uint64_t *words, uint32_t idx) {
+    return (words[idx >> 6] >> (idx & 63)) & 1;
+}
+
+/**
+ * @fn static inline void ladder_bits_set(uint64_t *words, uint32_t idx, bool value)
+ * @brief Write packed flag
+ *
+ * @param words Packed flags
+ * @param idx Flag
+ * @param value Flag value
+ */
+static inline void ladder_bits_set(uint64_t *words, uint32_t idx, bool value) {
+    if (value)
+        words[idx >> 6] |= (uint64_t) 1 << (idx & 63);
+    else
+        words[idx >> 6] &= ~((uint64_t) 1 << (idx & 63));
+}
+
+/**
+ * @fn static inline uint8_t* ladder_bits_byte(uint64_t *words, uint32_t idx, uint8_t *mask)
+ * @brief Byte holding a packed flag, to test it with one load and a mask
+ *
+ * @param words Packed flags
+ * @param idx Flag
+ * @param mask Flag mask in the byte
+ * @return Byte address
+ */
+static inline uint8_t* ladder_bits_byte(uint64_t *words, uint32_t idx, uint8_t *mask) {
+    uint32_t byte = (idx & 63) >> 3;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    byte = 7 - byte;
+#endif
+    *mask = (uint8_t) (1 << (idx & 7));
+    return (uint8_t*) &words[idx >> 6] + byte;
+}
+
+/**
+ * @fn void ladder_bits_pack(uint64_t *dst, const uint8_t *src, uint32_t qty)
+ * @brief Pack flags stored one per byte (any non zero value is set)
+ *
+ * @param dst Packed flags (LADDER_FLAG_WORDS(qty) words, unused bits of the last word are cleared)
+ * @param src Flags
+ * @param qty Flags quantity
+ */
+void ladder_bits_pack(uint64_t *dst, const uint8_t *src, uint32_t qty);
+
+/**
+ * @fn void ladder_bits_unpack(uint8_t *dst, const uint64_t *src, uint32_t qty)
+ * @brief Unpack flags to one byte per flag (0 or 1)
+ *
+ * @param dst Flags
+ * @param src Packed flags
+ * @param qty Flags quantity
+ */
+void ladder_bits_unpack(uint8_t *dst, const uint64_t *src, uint32_t qty);
+
+/**
+ * @fn void ladder_bits_edges(const uint8_t *src, const uint64_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty)
+ * @brief Packed rising and falling edges of flags stored one per byte against packed previous values
+ *
+ * @param src Flags
+ * @param prev Packed previous flags
+ * @param rising Packed flags set (can be NULL)
+ * @param falling Packed flags reset (can be NULL)
+ * @param qty Flags quantity
+ */
+void ladder_bits_edges(const uint8_t *src, const uint64_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty);
+
+/**
+ * @fn void ladder_bits_edges_bytes(const uint8_t *src, const uint8_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty)
+ * @brief Packed rising and falling edges of flags stored one per byte against previous values stored one per byte
+ *
+ * @param src Flags
+ * @param prev Previous flags
+ * @param rising Packed flags set (can be NULL)
+ * @param falling Packed flags reset (can be NULL)
+ * @param qty Flags quantity
+ */
+void ladder_bits_edges_bytes(const uint8_t *src, const uint8_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty);
+
+/**
+ * @def LADDER_HISTORY
+ * @brief Previous scan values of a flags bank (M, Cr, Cd, Tr or Td): packed words with OPTIONAL_PACKED_HISTORY, one byte per flag otherwise
+ */
+#ifdef OPTIONAL_PACKED_HISTORY
+#define LADDER_HISTORY(lctx, bank) ((lctx)->prev_scan_vals.bank##h_bits)
+#else
+#define LADDER_HISTORY(lctx, bank) ((lctx)->prev_scan_vals.bank##h)
+#endif
+
+/**
+ * @fn static inline size_t ladder_history_size(uint32_t qty)
+ * @brief Bytes of a flags bank history
+ *
+ * @param qty Flags quantity
+ * @return Bytes
+ */
+static inline size_t ladder_history_size(uint32_t qty) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    return LADDER_FLAG_WORDS((size_t) qty) * sizeof(uint64_t);
+#else
+    return qty;
+#endif
+}
+
+/**
+ * @fn static inline uint8_t ladder_history_get(const void *history, uint32_t idx)
+ * @brief Read previous scan value of a flag
+ *
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param idx Flag
+ * @return Previous value (0 or 1 when packed, the stored byte otherwise)
+ */
+static inline uint8_t ladder_history_get(const void *history, uint32_t idx) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    return ladder_bits_get((const uint64_t*) history, idx);
+#else
+    return ((const uint8_t*) history)[idx];
+#endif
+}
+
+/**
+ * @fn static inline void ladder_history_set(void *history, uint32_t idx, bool value)
+ * @brief Write previous scan value of a flag
+ *
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param idx Flag
+ * @param value Previous value
+ */
+static inline void ladder_history_set(void *history, uint32_t idx, bool value) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    ladder_bits_set((uint64_t*) history, idx, value);
+#else
+    ((uint8_t*) history)[idx] = value;
+#endif
+}
+
+/**
+ * @fn static inline uint8_t* ladder_history_byte(void *history, uint32_t idx, uint8_t *mask)
+ * @brief Byte holding the previous scan value of a flag, to test it with one load and a mask
+ *
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param idx Flag
+ * @param mask Flag mask in the byte
+ * @return Byte address
+ */
+static inline uint8_t* ladder_history_byte(void *history, uint32_t idx, uint8_t *mask) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    return ladder_bits_byte((uint64_t*) history, idx, mask);
+#else
+    *mask = 0xff;
+    return (uint8_t*) history + idx;
+#endif
+}
+
+/**
+ * @fn static inline void ladder_history_save(void *history, const void *flags, uint32_t qty)
+ * @brief Save flags of a bank as its previous scan values
+ *
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param flags Flags (one per byte)
+ * @param qty Flags quantity
+ */
+static inline void ladder_history_save(void *history, const void *flags, uint32_t qty) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    ladder_bits_pack((uint64_t*) history, (const uint8_t*) flags, qty);
+#else
+    memcpy(history, flags, qty);
+#endif
+}
+
+/**
+ * @fn static inline void ladder_history_restore(void *flags, const void *history, uint32_t qty)
+ * @brief Restore flags of a bank from its previous scan values
+ *
+ * @param flags Flags (one per byte)
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param qty Flags quantity
+ */
+static inline void ladder_history_restore(void *flags, const void *history, uint32_t qty) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    ladder_bits_unpack((uint8_t*) flags, (const uint64_t*) history, qty);
+#else
+    memcpy(flags, history, qty);
+#endif
+}
+
+/**
+ * @fn static inline void ladder_history_edges(const void *flags, const void *history, uint64_t *rising, uint64_t *falling, uint32_t qty)
+ * @brief Packed rising and falling edges of a flags bank against its previous scan values
+ *
+ * @param flags Flags (one per byte)
+ * @param history Flags bank history (LADDER_HISTORY)
+ * @param rising Packed flags set (can be NULL)
+ * @param falling Packed flags reset (can be NULL)
+ * @param qty Flags quantity
+ */
+static inline void ladder_history_edges(const void *flags, const void *history, uint64_t *rising, uint64_t *falling, uint32_t qty) {
+#ifdef OPTIONAL_PACKED_HISTORY
+    ladder_bits_edges((const uint8_t*) flags, (const uint64_t*) history, rising, falling, qty);
+#else
+    ladder_bits_edges_bytes((const uint8_t*) flags, (const uint8_t*) history, rising, falling, qty);
+#endif
+}
+
+#endif /* LADDER_BITS_H */
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_COMPILE_H
+#define LADDER_COMPILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_bind.h"
+#include "ladder_optimize.h"
+#include "ladder_slice.h"
+
+/**
+ * @enum LADDER_OPCODE
+ * @brief Compiled rung operations.
+ *        Operations below LADDER_OP_MERGE execute the instruction with the same code (ladder_instruction_t).
+ *        Bound operations execute an instruction on operands resolved at compile time (ladder_operand_t).
+ *
+ */
+typedef enum LADDER_OPCODE {
+    LADDER_OP_MERGE = LADDER_INS_INV, /**< OR and broadcast power of a vertical group */
+    LADDER_OP_INV,                    /**< Invalid instruction: abort scan */
+    LADDER_OP_RUNG_END,               /**< End of rung */
+    LADDER_OP_END,                    /**< End of network */
+    LADDER_OP_WIRE,                   /**< Cell power from the left of column operand: collapsed connectors (optimizer) */
+    LADDER_OP_NO_BOUND,               /**< NO on a bound bit operand */
+    LADDER_OP_NC_BOUND,               /**< NC on a bound bit operand */
+    LADDER_OP_RE_BOUND,               /**< RE on a bound bit operand */
+    LADDER_OP_FE_BOUND,               /**< FE on a bound bit operand */
+    LADDER_OP_COIL_BOUND,             /**< COIL on a bound bit operand */
+    LADDER_OP_COILL_BOUND,            /**< COILL on a bound bit operand */
+    LADDER_OP_COILU_BOUND,            /**< COILU on a bound bit operand */
+    LADDER_OP_EQ_BOUND,               /**< EQ on bound operands */
+    LADDER_OP_NE_BOUND,               /**< NE on bound operands */
+    LADDER_OP_GT_BOUND,               /**< GT on bound operands */
+    LADDER_OP_GE_BOUND,               /**< GE on bound operands */
+    LADDER_OP_LT_BOUND,               /**< LT on bound operands */
+    LADDER_OP_LE_BOUND,               /**< LE on bound operands */
+    LADDER_OP_ADD_BOUND,              /**< ADD on bound operands */
+    LADDER_OP_MUL_BOUND,              /**< MUL on bound operands */
+    LADDER_OP_NO_NO_COIL,             /**< Fused NO, NO and COIL bound on consecutive cells of a row (optimizer) */
+    LADDER_OP_NO_NC_COIL,             /**< Fused NO, NC and COIL bound on consecutive cells of a row (optimizer) */
+    LADDER_OP_EQ_MOVE,                /**< Fused EQ bound and MOVE on consecutive cells of a row (optimizer) */
+    LADDER_OP_RE_CTU,                 /**< Fused RE bound and CTU on consecutive cells of a row (optimizer) */
+    LADDER_OP_CUSTOM,                 /**< Custom instruction (code) called through fn */
+    LADDER_OP_CUSTOM_BOUND,           /**< Custom instruction called through fn on bound operands (frame->bound) */
+    LADDER_OP_QTY,                    /**< Operations quantity */
+} ladder_opcode_t;
+
+/**
+ * @struct ladder_op_s
+ * @brief Compiled operation
+ *
+ */
+typedef struct ladder_op_s {
+        uint8_t op;      /**< Operation (ladder_opcode_t or instruction code) */
+        uint8_t code;    /**< Instruction code */
+        uint8_t row;     /**< Row (first row of group on merge) */
+        uint8_t row_end; /**< Last row of group on merge, last row of the instruction cells on instructions. On rung end: 1 if a cell was visited */
+       uint32_t column;  /**< Column */
+       uint32_t operand; /**< First operand in the network operands pool (bound operations). On wire: first column. On merge: group rows mask */
+    ladder_fn_t fn;      /**< Instruction function (used on FOREIGN and custom instructions) */
+} ladder_op_t;
+
+/**
+ * @fn static inline uint8_t ladder_op_unfused(uint8_t op)
+ * @brief Operation a fused operation starts with. The other fused operations stay in place after it, so engines that don't fuse run them one by one.
+ *
+ * @param op Operation
+ * @return First operation of a fused operation, or the operation itself
+ */
+static inline uint8_t ladder_op_unfused(uint8_t op) {
+    switch (op) {
+        case LADDER_OP_NO_NO_COIL:
+        case LADDER_OP_NO_NC_COIL:
+            return LADDER_OP_NO_BOUND;
+        case LADDER_OP_EQ_MOVE:
+            return LADDER_OP_EQ_BOUND;
+        case LADDER_OP_RE_CTU:
+            return LADDER_OP_RE_BOUND;
+        default:
+            return op;
+    }
+}
+
+/**
+ * @struct ladder_compiled_network_s
+ * @brief Compiled network
+ *
+ */
+typedef struct ladder_compiled_network_s {
+                bool interpreted;                      /**< Network exceeds the scan cycles budget: run on the interpreter to keep watchdog behavior */
+            uint64_t cycles;                           /**< Watchdog cycles consumed by the interpreter on this network */
+            uint32_t ops_qty;                          /**< Operations quantity */
+         ladder_op_t *ops;                             /**< Operations */
+            uint32_t operands_qty;                     /**< Bound operands quantity */
+    ladder_operand_t *operands;                        /**< Bound operands */
+            uint16_t *clear;                           /**< Cells cleared before execution (copy of the topology list) */
+            uint32_t clear_start[LADDER_MAX_ROWS + 1]; /**< First entry of each row in clear */
+            uint32_t *power;                           /**< Power flow of each column as a row mask while operations run: left rail, then columns */
+      ladder_slice_t *slice;                           /**< Groups of rungs evaluated together on the power masks */
+            uint32_t slices_qty;                       /**< Groups quantity */
+} ladder_compiled_network_t;
+
+/**
+ * @struct ladder_compiled_s
+ * @brief Compiled program
+ *
+ */
+typedef struct ladder_compiled_s {
+                     uint64_t max_scan_cycles; /**< Watchdog limit used on compilation */
+            ladder_bind_key_t key;             /**< Banks and I/O modules the operands were bound to */
+                     uint32_t networks_qty;    /**< Networks quantity */
+    ladder_compiled_network_t *network;        /**< Compiled networks */
+                         void *incremental;    /**< Incremental scan data (ladder_incremental_t, built on first incremental scan) */
+                         void *parallel;       /**< Parallel schedule (ladder_parallel_t, built on first parallel scan) */
+                         void *jit;            /**< Native code (ladder_jit_t, built on first JIT scan) */
+     ladder_optimize_report_t optimized;       /**< Optimizer report (ladder.optimize) */
+} ladder_compiled_t;
+
+/**
+ * @fn bool ladder_compile(ladder_ctx_t *ladder_ctx)
+ * @brief Compile all networks to rung bytecode
+ *
+ * @param ladder_ctx Ladder context
+ * @return Status
+ */
+bool ladder_compile(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn ladder_compiled_t* ladder_compiled_get(ladder_ctx_t *ladder_ctx)
+ * @brief Compiled program for the current context. Compiles again when the program is stale (networks, watchdog limit or reallocated banks).
+ *
+ * @param ladder_ctx Ladder context
+ * @return Compiled program or NULL on failure
+ */
+ladder_compiled_t* ladder_compiled_get(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_exec_rungs(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet, const ladder_op_t *op,
+ *         const ladder_op_t *stop, uint32_t row_start, uint32_t row_end)
+ * @brief Clear power of rows row_start to row_end and execute compiled operations on them. Cell states of those rows are written on return.
+ *
+ * @param ladder_ctx Ladder context
+ * @param network Network
+ * @param cnet Compiled network
+ * @param op First operation
+ * @param stop Rung end operation where execution stops (NULL: end of network)
+ * @param row_start First row written by the operations
+ * @param row_end Last row written by the operations
+ * @return False if scan must be aborted
+ */
+bool ladder_exec_rungs(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet, const ladder_op_t *op, const ladder_op_t *stop,
+        uint32_t row_start, uint32_t row_end);
+
+/**
+ * @fn bool ladder_exec_network(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet)
+ * @brief Clear cell states and execute a whole compiled network
+ *
+ * @param ladder_ctx Ladder context
+ * @param network Network
+ * @param cnet Compiled network
+ * @return False if scan must be aborted
+ */
+bool ladder_exec_network(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet);
+
+/**
+ * @fn void ladder_compiled_free(ladder_ctx_t *ladder_ctx)
+ * @brief Free compiled program
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_compiled_free(ladder_ctx_t *ladder_ctx);
+
+#endif /* LADDER_COMPILE_H */
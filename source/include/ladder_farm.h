@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_FARM_H
+#define LADDER_FARM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_batch.h"
+
+#ifdef OPTIONAL_FARM
+
+/**
+ * @struct ladder_farm_result_s
+ * @brief Result of a run
+ *
+ */
+typedef struct ladder_farm_result_s {
+          uint64_t scans;       /**< Task cycles run */
+          uint64_t exec_us;     /**< Share of the wall time of the batch that ran it */
+    ladder_state_t state;       /**< State at the end (LADDER_ST_RUNNING: task did not end) */
+           uint8_t instr;       /**< Last executed instruction */
+          uint32_t network;     /**< Last executed network */
+          uint32_t cell_column; /**< Last executed cell column */
+          uint32_t cell_row;    /**< Last executed cell row */
+           uint8_t err;         /**< Last executed error */
+           uint8_t *Q;          /**< Digital outputs at the end (output modules in order) */
+           int32_t *QW;         /**< Analog outputs at the end (output modules in order) */
+} ladder_farm_result_t;
+
+/**
+ * @struct ladder_farm_s
+ * @brief Results table of a farm run
+ *
+ */
+typedef struct ladder_farm_s {
+                uint32_t runs;    /**< Runs */
+                uint32_t q_qty;   /**< Digital outputs of a run */
+                uint32_t qw_qty;  /**< Analog outputs of a run */
+                uint64_t scans;   /**< Task cycles of every run */
+                uint64_t exec_us; /**< Wall time */
+    ladder_farm_result_t *result; /**< Result of each run */
+} ladder_farm_t;
+
+/**
+ * @fn ladder_farm_t* ladder_farm_run(ladder_ctx_t *ladder_ctx, uint32_t runs, uint64_t ticks, uint32_t period_ms, uint32_t workers,
+ *                                    const ladder_batch_io_t *io)
+ * @brief Run the program of a context many times on worker threads, as fast as possible. Runs are instances of a batch (see ladder_batch_init),
+ *        LADDER_BATCH_LANES runs at a time by each worker, on a virtual clock. The lane argument of io functions is the run number; they are
+ *        called from the worker threads, concurrently for different runs. The context is only read.
+ *
+ * @param ladder_ctx Ladder context (program without FOREIGN instructions)
+ * @param runs Runs
+ * @param ticks Task cycles of each run
+ * @param period_ms Virtual time of a cycle
+ * @param workers Threads quantity (0: one per online processor)
+ * @param io Scenario
+ * @return Results table or NULL on failure
+ */
+ladder_farm_t* ladder_farm_run(ladder_ctx_t *ladder_ctx, uint32_t runs, uint64_t ticks, uint32_t period_ms, uint32_t workers,
+        const ladder_batch_io_t *io);
+
+/**
+ * @fn void ladder_farm_free(ladder_farm_t *farm)
+ * @brief Free results table
+ *
+ * @param farm Results table
+ */
+void ladder_farm_free(ladder_farm_t *farm);
+
+#endif /* OPTIONAL_FARM */
+
+#endif /* LADDER_FARM_H */
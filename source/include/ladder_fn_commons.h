@@ -30,6 +30,9 @@
  *
  */
 
+#ifndef LADDER_FN_COMMONS_H
+#define LADDER_FN_COMMONS_H
+
 #include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
@@ -37,6 +40,8 @@
 
 #include "ladder.h"
 #include "ladder_instructions.h"
+#include "ladder_bits.h"
+#include "ladder_bind.h"
 
 extern uint32_t basetime_factor[];
 
@@ -189,16 +194,8 @@ static inline bool safe_check_module_port(ladder_ctx_t *lctx, ladder_register_t
     return true;
 }
 
-static inline int32_t ladder_get_data_value(ladder_ctx_t *lctx, uint32_t r, uint32_t c, uint32_t i) {
-    if (lctx == NULL || lctx->exec_network == NULL) {
-        return 0;  // Safe default on invalid context
-    }
-    ladder_network_t *net = lctx->exec_network;
-    if (r >= net->rows || c >= net->cols || i >= net->cells[r][c].data_qty) {
-        return 0;  // Safe default on OOB
-    }
-    ladder_register_t type = net->cells[r][c].data[i].type;
-    ladder_value_t *val = &net->cells[r][c].data[i];
+static inline int32_t ladder_value_get(ladder_ctx_t *lctx, const ladder_value_t *val) {
+    ladder_register_t type = val->type;
     ladder_ins_err_t err = LADDER_INS_ERR_OK;
 
     switch (type) {
@@ -292,7 +289,7 @@ static inline int32_t ladder_get_data_value(ladder_ctx_t *lctx, uint32_t r, uint
     }
 }
 
-static inline int32_t ladder_get_previous_value(ladder_ctx_t *lctx, uint32_t r, uint32_t c, uint32_t i) {
+static inline int32_t ladder_get_data_value(ladder_ctx_t *lctx, uint32_t r, uint32_t c, uint32_t i) {
     if (lctx == NULL || lctx->exec_network == NULL) {
         return 0;  // Safe default on invalid context
     }
@@ -300,12 +297,15 @@ static inline int32_t ladder_get_previous_value(ladder_ctx_t *lctx, uint32_t r,
     if (r >= net->rows || c >= net->cols || i >= net->cells[r][c].data_qty) {
         return 0;  // Safe default on OOB
     }
-    ladder_register_t type = net->cells[r][c].data[i].type;
-    ladder_value_t *val = &net->cells[r][c].data[i];
+    return ladder_value_get(lctx, &net->cells[r][c].data[i]);
+}
+
+static inline int32_t ladder_value_previous(ladder_ctx_t *lctx, const ladder_value_t *val) {
+    ladder_register_t type = val->type;
 
     switch (type) {
         case LADDER_REGISTER_M:
-            return (int32_t) lctx->prev_scan_vals.Mh[val->value.i32];
+            return (int32_t) ladder_history_get(LADDER_HISTORY(lctx, M), val->value.i32);
         case LADDER_REGISTER_Q: {
             uint32_t mod = val->value.mp.module;
             uint8_t port = val->value.mp.port;
@@ -339,13 +339,13 @@ static inline int32_t ladder_get_previous_value(ladder_ctx_t *lctx, uint32_t r,
             return (int32_t) lctx->input[mod].Ih[port];
         }
         case LADDER_REGISTER_Cd:
-            return (int32_t) lctx->prev_scan_vals.Cdh[val->value.i32];
+            return (int32_t) ladder_history_get(LADDER_HISTORY(lctx, Cd), val->value.i32);
         case LADDER_REGISTER_Cr:
-            return (int32_t) lctx->prev_scan_vals.Crh[val->value.i32];
+            return (int32_t) ladder_history_get(LADDER_HISTORY(lctx, Cr), val->value.i32);
         case LADDER_REGISTER_Td:
-            return (int32_t) lctx->prev_scan_vals.Tdh[val->value.i32];
+            return (int32_t) ladder_history_get(LADDER_HISTORY(lctx, Td), val->value.i32);
         case LADDER_REGISTER_Tr:
-            return (int32_t) lctx->prev_scan_vals.Trh[val->value.i32];
+            return (int32_t) ladder_history_get(LADDER_HISTORY(lctx, Tr), val->value.i32);
             // For other types like IW/QW/C/T/D/R/S, previous values may not be stored (e.g., no prev for accumulators or data regs).
             // Default to current value or 0; adjust based on requirements (e.g., add prev for D if needed).
         case LADDER_REGISTER_IW: {
@@ -379,6 +379,17 @@ static inline int32_t ladder_get_previous_value(ladder_ctx_t *lctx, uint32_t r,
     }
 }
 
+static inline int32_t ladder_get_previous_value(ladder_ctx_t *lctx, uint32_t r, uint32_t c, uint32_t i) {
+    if (lctx == NULL || lctx->exec_network == NULL) {
+        return 0;  // Safe default on invalid context
+    }
+    ladder_network_t *net = lctx->exec_network;
+    if (r >= net->rows || c >= net->cols || i >= net->cells[r][c].data_qty) {
+        return 0;  // Safe default on OOB
+    }
+    return ladder_value_previous(lctx, &net->cells[r][c].data[i]);
+}
+
 static inline int32_t ladder_get_data_int32(ladder_ctx_t *lctx, uint32_t r, uint32_t c, uint32_t i) {
     if (lctx == NULL || lctx->exec_network == NULL) {
         return 0;  // Safe default on invalid context
@@ -442,11 +453,11 @@ static inline int32_t ladder_get_data_int32(ladder_ctx_t *lctx, uint32_t r, uint
     }
 }
 
-static inline void ladder_set_data_value(ladder_ctx_t *ladder_ctx, uint32_t row, uint32_t column, uint32_t pos, void *value, ladder_ins_err_t *error) {
-    ladder_register_t __type = ladder_cell_data_exec(ladder_ctx, row, column, pos).type;
-    int32_t __idx = ladder_cell_data_exec(ladder_ctx, row, column, pos).value.i32;
-    uint8_t __port = ladder_cell_data_exec(ladder_ctx, row, column, pos).value.mp.port;
-    uint32_t __module = ladder_cell_data_exec(ladder_ctx, row, column, pos).value.mp.module;
+static inline void ladder_value_set(ladder_ctx_t *ladder_ctx, const ladder_value_t *val, void *value, ladder_ins_err_t *error) {
+    ladder_register_t __type = val->type;
+    int32_t __idx = val->value.i32;
+    uint8_t __port = val->value.mp.port;
+    uint32_t __module = val->value.mp.module;
     uint32_t __qty = 0;
     size_t __data_size = 0;
     uint32_t __index = 0;
@@ -589,6 +600,147 @@ static inline void ladder_set_data_value(ladder_ctx_t *ladder_ctx, uint32_t row,
     }
 }
 
+static inline void ladder_set_data_value(ladder_ctx_t *ladder_ctx, uint32_t row, uint32_t column, uint32_t pos, void *value, ladder_ins_err_t *error) {
+    ladder_value_set(ladder_ctx, &ladder_cell_data_exec(ladder_ctx, row, column, pos), value, error);
+}
+
+// Operand access for sealed programs (ladder_program_check passed): memory areas, modules, indexes and data quantities were proven
+// valid, so the register is reached without checks. Results are the ones of ladder_value_get/ladder_value_set on the same operand.
+static inline int32_t ladder_value_get_sealed(ladder_ctx_t *lctx, const ladder_value_t *val) {
+    int32_t idx = val->value.i32;
+
+    switch (val->type) {
+        case LADDER_REGISTER_NONE:
+            return idx;
+        case LADDER_REGISTER_M:
+            return (int32_t) lctx->memory.M[idx];
+        case LADDER_REGISTER_Q:
+            return (int32_t) lctx->output[val->value.mp.module].Q[val->value.mp.port];
+        case LADDER_REGISTER_I:
+            return (int32_t) lctx->input[val->value.mp.module].I[val->value.mp.port];
+        case LADDER_REGISTER_IW:
+            return lctx->input[val->value.mp.module].IW[val->value.mp.port];
+        case LADDER_REGISTER_QW:
+            return lctx->output[val->value.mp.module].QW[val->value.mp.port];
+        case LADDER_REGISTER_Cd:
+            return (int32_t) lctx->memory.Cd[idx];
+        case LADDER_REGISTER_Cr:
+            return (int32_t) lctx->memory.Cr[idx];
+        case LADDER_REGISTER_Td:
+            return (int32_t) lctx->memory.Td[idx];
+        case LADDER_REGISTER_Tr:
+            return (int32_t) lctx->memory.Tr[idx];
+        case LADDER_REGISTER_C:
+            return (int32_t) lctx->registers.C[idx];
+        case LADDER_REGISTER_T:
+            return lctx->timers[idx].acc > (uint64_t) INT32_MAX ? INT32_MAX : (int32_t) lctx->timers[idx].acc;
+        case LADDER_REGISTER_D:
+            return lctx->registers.D[idx];
+        case LADDER_REGISTER_R:
+            return (int32_t) lctx->registers.R[idx];
+        default:
+            return 0;
+    }
+}
+
+static inline void ladder_value_set_sealed(ladder_ctx_t *lctx, const ladder_value_t *val, void *value, ladder_ins_err_t *error) {
+    int32_t idx = val->value.i32;
+    void *dst;
+    size_t size;
+
+    switch (val->type) {
+        case LADDER_REGISTER_M:
+            dst = &lctx->memory.M[idx];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_Q:
+            dst = &lctx->output[val->value.mp.module].Q[val->value.mp.port];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_I:
+            dst = &lctx->input[val->value.mp.module].I[val->value.mp.port];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_IW:
+            dst = &lctx->input[val->value.mp.module].IW[val->value.mp.port];
+            size = sizeof(int32_t);
+            break;
+        case LADDER_REGISTER_QW:
+            dst = &lctx->output[val->value.mp.module].QW[val->value.mp.port];
+            size = sizeof(int32_t);
+            break;
+        case LADDER_REGISTER_Cd:
+            dst = &lctx->memory.Cd[idx];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_Cr:
+            dst = &lctx->memory.Cr[idx];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_Td:
+            dst = &lctx->memory.Td[idx];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_Tr:
+            dst = &lctx->memory.Tr[idx];
+            size = sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_C:
+            dst = &lctx->registers.C[idx];
+            size = sizeof(uint32_t);
+            break;
+        case LADDER_REGISTER_D:
+            dst = &lctx->registers.D[idx];
+            size = sizeof(int32_t);
+            break;
+        case LADDER_REGISTER_R:
+            dst = &lctx->registers.R[idx];
+            size = sizeof(float);
+            break;
+        default:
+            *error = LADDER_INS_ERR_SETDATAVAL;
+            return;
+    }
+
+    if (value == NULL) {
+        *error = LADDER_INS_ERR_FAIL;
+        return;
+    }
+    memcpy(dst, value, size);
+}
+
+static inline int32_t ladder_frame_get(const ladder_frame_t *frame, uint32_t i) {
+    // sealed programs hold every operand of the instruction description
+    if (!frame->ctx->ladder.sealed && i >= frame->cell->data_qty) {
+        return 0;  // Safe default on OOB
+    }
+    // operands bound by the compiler skip the register type switch
+    if (frame->bound != NULL)
+        return ladder_operand_get(&frame->bound[i]);
+    if (frame->ctx->ladder.sealed)
+        return ladder_value_get_sealed(frame->ctx, &frame->data[i]);
+    return ladder_value_get(frame->ctx, &frame->data[i]);
+}
+
+static inline int32_t ladder_frame_previous(const ladder_frame_t *frame, uint32_t i) {
+    if (i >= frame->cell->data_qty) {
+        return 0;  // Safe default on OOB
+    }
+    return ladder_value_previous(frame->ctx, &frame->data[i]);
+}
+
+static inline void ladder_frame_set(const ladder_frame_t *frame, uint32_t i, void *value, ladder_ins_err_t *error) {
+    if (frame->bound != NULL) {
+        ladder_operand_set(&frame->bound[i], value);
+        return;
+    }
+    if (frame->ctx->ladder.sealed) {
+        ladder_value_set_sealed(frame->ctx, &frame->data[i], value, error);
+        return;
+    }
+    ladder_value_set(frame->ctx, &frame->data[i], value, error);
+}
+
 static inline ladder_data_type_t get_effective_type(ladder_register_t reg_type) {
     switch (reg_type) {
         case LADDER_REGISTER_NONE:
@@ -667,3 +819,5 @@ static inline float ladder_get_data_float(ladder_ctx_t *lctx, uint32_t r, uint32
             return 0.0f;
     }
 }
+
+#endif /* LADDER_FN_COMMONS_H */
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_HOST_H
+#define LADDER_HOST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_HOST
+
+/**
+ * @struct ladder_host_s
+ * @brief Host scheduler: contexts scanned every target_scan_ms by a fixed pool of worker threads
+ *
+ */
+typedef struct ladder_host_s ladder_host_t;
+
+/**
+ * @struct ladder_host_stats_s
+ * @brief Scheduling statistics of a context.
+ *        A scan is released every target_scan_ms and must end before the next release.
+ *
+ */
+typedef struct ladder_host_stats_s {
+    uint64_t scans;        /**< Scans executed */
+    uint64_t misses;       /**< Scans ended after their deadline */
+    uint64_t skipped;      /**< Releases dropped to catch up after a miss */
+    uint64_t stolen;       /**< Scans executed by a worker other than the one owning the context */
+    uint64_t max_late_us;  /**< Worst delay between release and scan start */
+    uint64_t max_exec_us;  /**< Worst scan execution time */
+    uint64_t last_exec_us; /**< Last scan execution time */
+        bool ended;        /**< Task ended (fault or LADDER_ST_EXIT_TSK), context is not scanned anymore */
+} ladder_host_stats_t;
+
+/**
+ * @fn ladder_host_t* ladder_host_init(uint32_t workers, uint32_t contexts_qty)
+ * @brief Create host and start worker threads. Worker n is pinned to processor n.
+ *
+ * @param workers Threads quantity (0: one per online processor)
+ * @param contexts_qty Maximum contexts
+ * @return Host or NULL on failure
+ */
+ladder_host_t* ladder_host_init(uint32_t workers, uint32_t contexts_qty);
+
+/**
+ * @fn void ladder_host_deinit(ladder_host_t *host)
+ * @brief Stop worker threads and free host. Contexts are not deleted.
+ *
+ * @param host Host
+ */
+void ladder_host_deinit(ladder_host_t *host);
+
+/**
+ * @fn bool ladder_host_add(ladder_host_t *host, ladder_ctx_t *ladder_ctx)
+ * @brief Add context. It is scanned every scan_internals.target_scan_ms (0: as often as possible) while its state is LADDER_ST_RUNNING.
+ *        The context belongs to the least loaded worker; idle workers take late scans of other workers.
+ *
+ * @param host Host
+ * @param ladder_ctx Ladder context (initialized, hw.time functions set)
+ * @return Status
+ */
+bool ladder_host_add(ladder_host_t *host, ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_host_remove(ladder_host_t *host, ladder_ctx_t *ladder_ctx)
+ * @brief Remove context. Waits for a running scan of the context to end.
+ *
+ * @param host Host
+ * @param ladder_ctx Ladder context
+ * @return False if context was not found
+ */
+bool ladder_host_remove(ladder_host_t *host, ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_host_stop(ladder_host_t *host, ladder_ctx_t *ladder_ctx)
+ * @brief Ask a context to exit. Waits for a running scan of the context to end and sets LADDER_ST_EXIT_TSK;
+ *        the next release ends the task (on.end_task, stats.ended). Use it instead of writing the state while the host runs.
+ *
+ * @param host Host
+ * @param ladder_ctx Ladder context
+ * @return False if context was not found
+ */
+bool ladder_host_stop(ladder_host_t *host, ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_host_stats(ladder_host_t *host, ladder_ctx_t *ladder_ctx, ladder_host_stats_t *stats)
+ * @brief Get scheduling statistics of a context
+ *
+ * @param host Host
+ * @param ladder_ctx Ladder context
+ * @param stats Statistics
+ * @return False if context was not found
+ */
+bool ladder_host_stats(ladder_host_t *host, ladder_ctx_t *ladder_ctx, ladder_host_stats_t *stats);
+
+#endif /* OPTIONAL_HOST */
+
+#endif /* LADDER_HOST_H */
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_INCREMENTAL_H
+#define LADDER_INCREMENTAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_compile.h"
+
+/**
+ * @struct ladder_incremental_region_s
+ * @brief Registers tracked for changes (a bank or an I/O module values array)
+ *
+ */
+typedef struct ladder_incremental_region_s {
+    uint8_t *base;   /**< First register */
+    uint32_t stride; /**< Bytes between registers */
+    uint32_t size;   /**< Register size */
+    uint32_t qty;    /**< Registers quantity */
+    uint32_t slot;   /**< First slot */
+    uint32_t shadow; /**< Offset in shadow copy */
+} ladder_incremental_region_t;
+
+/**
+ * @struct ladder_incremental_unit_s
+ * @brief Rungs executed together. Rungs are joined when a multi cell instruction spans both.
+ *
+ */
+typedef struct ladder_incremental_unit_s {
+    uint32_t network;        /**< Network */
+    uint32_t first_op;       /**< First operation */
+    uint32_t last_op;        /**< Rung end operation of the last rung */
+    uint32_t row_start;      /**< First row cleared before execution */
+    uint32_t row_end;        /**< Last row cleared before execution */
+    uint32_t writes_start;   /**< First write slot */
+    uint32_t writes_qty;     /**< Write slots quantity */
+        bool always;         /**< Execute on every scan (timers, counters, edges, foreign instructions or unresolved operands) */
+        bool unknown_writes; /**< Writes outside the write slots: compare all registers after execution */
+        bool unresolved;     /**< Operand with an error path (reported or aborting the scan) or outside the tracked registers */
+} ladder_incremental_unit_t;
+
+/**
+ * @struct ladder_incremental_network_s
+ * @brief Network units
+ *
+ */
+typedef struct ladder_incremental_network_s {
+        bool full;       /**< Execute the whole network on every scan (interpreted or invalid code) */
+        bool enabled;    /**< Network was enabled on previous scan */
+    uint32_t unit_first; /**< First unit */
+    uint32_t units_qty;  /**< Units quantity */
+} ladder_incremental_network_t;
+
+/**
+ * @struct ladder_incremental_s
+ * @brief Read/write sets of compiled rungs and register changes tracking
+ *
+ */
+typedef struct ladder_incremental_s {
+                        uint32_t regions_qty;  /**< Regions quantity */
+     ladder_incremental_region_t *region;      /**< Tracked registers */
+                        uint32_t slots_qty;    /**< Tracked registers quantity */
+                         uint8_t *shadow;      /**< Register values seen by the units */
+                        uint32_t *users_start; /**< First user of each slot (slots_qty + 1 entries) */
+                        uint32_t *users;       /**< Slot users: unit << 1, plus 1 if the unit reads the slot */
+                        uint32_t *writes;      /**< Write slots of units */
+                        uint32_t units_qty;    /**< Units quantity */
+       ladder_incremental_unit_t *unit;        /**< Units */
+                         uint8_t *pending;     /**< Units to execute on next scan */
+                        uint32_t networks_qty; /**< Networks quantity */
+    ladder_incremental_network_t *network;     /**< Networks */
+                        uint32_t executed;     /**< Units executed on last scan */
+} ladder_incremental_t;
+
+/**
+ * @fn ladder_incremental_t* ladder_incremental_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled)
+ * @brief Build units and read/write sets from the compiled program. All units start pending.
+ *
+ * @param ladder_ctx Ladder context
+ * @param compiled Compiled program
+ * @return Incremental data or NULL on failure
+ */
+ladder_incremental_t* ladder_incremental_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled);
+
+/**
+ * @fn void ladder_incremental_free(ladder_incremental_t *incremental)
+ * @brief Free incremental data
+ *
+ * @param incremental Incremental data
+ */
+void ladder_incremental_free(ladder_incremental_t *incremental);
+
+#endif /* LADDER_INCREMENTAL_H */
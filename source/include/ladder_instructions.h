@@ -92,413 +92,410 @@
 #define MAKE_BOOL(v)  ((v) == 0 ? false : true)
 
 /**
- * @fn ladder_ins_err_t fn_NOP(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
- * @brief
+ * @def FRAME_LEFT
+ * @brief Left power of row + n of the frame cell
+ *
+ */
+#define FRAME_LEFT(frame, n)  MAKE_BOOL(((frame)->left >> (n)) & 1)
+
+/**
+ * @def FRAME_STATE
+ * @brief State of row + n of the frame cell
+ *
+ */
+#define FRAME_STATE(frame, n)  ((frame)->net->cells[(frame)->row + (n)][(frame)->column].state)
+
+/**
+ * @def FRAME_DATA
+ * @brief Operand of the frame cell
+ *
+ */
+#define FRAME_DATA(frame, i)  ((frame)->data[i])
+
+/**
+ * @fn static inline const ladder_custom_t* ladder_custom_get(const ladder_ctx_t *ladder_ctx, uint32_t code)
+ * @brief Registered custom instruction of a code
+ *
+ * @param ladder_ctx Ladder context
+ * @param code Instruction code
+ * @return Custom instruction or NULL (builtin, invalid or not registered)
+ */
+static inline const ladder_custom_t* ladder_custom_get(const ladder_ctx_t *ladder_ctx, uint32_t code) {
+    if (code < LADDER_INS_CUSTOM || code >= LADDER_INS_CUSTOM + LADDER_CUSTOM_MAX || ladder_ctx->custom == NULL)
+        return NULL;
+
+    const ladder_custom_t *custom = &ladder_ctx->custom[code - LADDER_INS_CUSTOM];
+    return custom->exec != NULL ? custom : NULL;
+}
+
+/**
+ * @fn static inline void ladder_frame_cell(ladder_frame_t *frame, ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @brief Fill an execution frame for a cell of the executing network, left power of the instruction rows read from the network cells
  *
+ * @param frame Execution frame
  * @param ladder_ctx Ladder context
  * @param column Column
  * @param row Row
+ */
+static inline void ladder_frame_cell(ladder_frame_t *frame, ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+    ladder_network_t *net = ladder_ctx->exec_network;
+
+    frame->ctx = ladder_ctx;
+    frame->net = net;
+    frame->cell = &net->cells[row][column];
+    frame->data = frame->cell->data;
+    frame->column = column;
+    frame->row = row;
+    frame->bound = NULL;
+
+    if (column == 0) {
+        frame->left = UINT32_MAX;
+        return;
+    }
+
+    // rows of the instruction cells (none for foreign functions: they read the network cells)
+    ladder_instruction_t code = frame->cell->code;
+    const ladder_custom_t *custom = code < LADDER_INS_INV ? NULL : ladder_custom_get(ladder_ctx, code);
+    uint32_t span = code < LADDER_INS_INV ? ladder_fn_iocd[code].cells : custom != NULL ? custom->description.cells : 0;
+    frame->left = 0;
+    for (uint32_t n = 0; n < span && row + n < net->rows; n++)
+        frame->left |= (uint32_t) net->cells[row + n][column - 1].state << n;
+}
+
+/**
+ * @fn ladder_ins_err_t fn_NOP(const ladder_frame_t *frame)
+ * @brief
+ *
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NOP(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NOP(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_Conn(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_Conn(const ladder_frame_t *frame)
  * @brief Connector
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_CONN(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_CONN(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_Neg(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_Neg(const ladder_frame_t *frame)
  * @brief Negate
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NEG(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NEG(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_NO(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_NO(const ladder_frame_t *frame)
  * @brief Normally open contact
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NO(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NO(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_NC(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_NC(const ladder_frame_t *frame)
  * @brief Normally closed contact
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NC(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NC(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_RE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_RE(const ladder_frame_t *frame)
  * @brief  Rise Edge Contact
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_RE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_RE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_FE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_FE(const ladder_frame_t *frame)
  * @brief Fall Edge Contact
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_FE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_FE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_Coil(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_Coil(const ladder_frame_t *frame)
  * @brief Coil
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  * @return
  */
-ladder_ins_err_t fn_COIL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_COIL(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_CoilL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_CoilL(const ladder_frame_t *frame)
  * @brief Latch coil
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  * @return
  */
-ladder_ins_err_t fn_COILL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_COILL(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_CoilU(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_CoilU(const ladder_frame_t *frame)
  * @brief Unlatch coil
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  * @return
  */
-ladder_ins_err_t fn_COILU(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_COILU(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_TON(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_TON(const ladder_frame_t *frame)
  * @brief Timer on
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_TON(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_TON(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_TOFF(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_TOFF(const ladder_frame_t *frame)
  * @brief Timer off
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_TOF(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_TOF(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_TP(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_TP(const ladder_frame_t *frame)
  * @brief Timer pulse
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_TP(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_TP(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_CTU(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_CTU(const ladder_frame_t *frame)
  * @brief Counter up
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_CTU(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_CTU(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_CTD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_CTD(const ladder_frame_t *frame)
  * @brief Counter down
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_CTD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_CTD(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_MOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_MOVE(const ladder_frame_t *frame)
  * @brief Register move
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_MOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_MOVE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_SUB(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_SUB(const ladder_frame_t *frame)
  * @brief Arithmetic subtraction
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_SUB(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_SUB(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_ADD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_ADD(const ladder_frame_t *frame)
  * @brief Arithmetic addition
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_ADD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_ADD(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_MUL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_MUL(const ladder_frame_t *frame)
  * @brief Arithmetic multiplication
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_MUL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_MUL(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_DIV(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_DIV(const ladder_frame_t *frame)
  * @brief Arithmetic division
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_DIV(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_DIV(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_MOD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_MOD(const ladder_frame_t *frame)
  * @brief Arithmetic division module
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_MOD(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_MOD(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_SHL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_SHL(const ladder_frame_t *frame)
  * @brief Bit shifting left
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_SHL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_SHL(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_SHR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_SHR(const ladder_frame_t *frame)
  * @brief Bit shifting right
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_SHR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_SHR(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_ROL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_ROL(const ladder_frame_t *frame)
  * @brief Bit rotate left
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_ROL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_ROL(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_ROR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_ROR(const ladder_frame_t *frame)
  * @brief Bit rotate right
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_ROR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_ROR(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_AND(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_AND(const ladder_frame_t *frame)
  * @brief Bitwise AND
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_AND(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_AND(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_OR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_OR(const ladder_frame_t *frame)
  * @brief Bitwise OR
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_OR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_OR(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_XOR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_XOR(const ladder_frame_t *frame)
  * @brief Bitwise XOR
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_XOR(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_XOR(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_NOT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_NOT(const ladder_frame_t *frame)
  * @brief Bitwise NOT
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NOT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NOT(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_EQ(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_EQ(const ladder_frame_t *frame)
  * @brief
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_EQ(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_EQ(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_GT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_GT(const ladder_frame_t *frame)
  * @brief Comparison equal to
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_GT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_GT(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_GE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_GE(const ladder_frame_t *frame)
  * @brief Comparison greater than
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_GE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_GE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_LT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_LT(const ladder_frame_t *frame)
  * @brief Comparison lesser than
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_LT(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_LT(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_LE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_LE(const ladder_frame_t *frame)
  * @brief Comparison lesser or equal
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_LE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_LE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_NE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_NE(const ladder_frame_t *frame)
  * @brief Comparison not equal
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_NE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_NE(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_FOREIGN(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
- * @brief Execute external functions
+ * @fn ladder_ins_err_t  fn_FOREIGN(const ladder_frame_t *frame)
+ * @brief Execute external functions (foreign functions keep the column and row prototype, see ladder_foreign_fn_t)
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_FOREIGN(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_FOREIGN(const ladder_frame_t *frame);
 
 /**
- * @fn ladder_ins_err_t  fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
+ * @fn ladder_ins_err_t  fn_TMOVE(const ladder_frame_t *frame)
  * @brief Execute table data move
  *
- * @param ladder_ctx Ladder context
- * @param column Column
- * @param row Row
+ * @param frame Execution frame
  * @return Status
  */
-ladder_ins_err_t fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row);
+ladder_ins_err_t fn_TMOVE(const ladder_frame_t *frame);
 
 #endif /* FN_COMMONS_H */
@@ -35,9 +35,11 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "ladder.h"
+#include "ladder_instructions.h"
 
 /**
  * @fn static inline bool safe_memcpy(void *dst, size_t dst_len, const void *src, size_t n
@@ -55,6 +57,29 @@ static inline bool safe_memcpy(void *dst, size_t dst_len, const void *src, size_
     return true;
 }
 
+/**
+ * @fn static inline ladder_ctx_t* ladder_ctx_array(size_t qty)
+ * @brief Allocate zeroed contexts starting on a cache line (free with free)
+ *
+ * @param qty Contexts quantity
+ * @return Contexts or NULL
+ */
+static inline ladder_ctx_t* ladder_ctx_array(size_t qty) {
+#if __STDC_VERSION__ >= 201112L && (defined(__GNUC__) || defined(__clang__))
+    if (qty > (SIZE_MAX - LADDER_CACHE_LINE) / sizeof(ladder_ctx_t))
+        return NULL;
+
+    // aligned_alloc wants a multiple of the alignment
+    size_t size = (qty * sizeof(ladder_ctx_t) + LADDER_CACHE_LINE - 1) / LADDER_CACHE_LINE * LADDER_CACHE_LINE;
+    ladder_ctx_t *ctx = aligned_alloc(LADDER_CACHE_LINE, size);
+    if (ctx != NULL)
+        memset(ctx, 0, size);
+    return ctx;
+#else
+    return calloc(qty, sizeof(ladder_ctx_t));
+#endif
+}
+
 /**
  * @fn void ladder_clear_memory(ladder_ctx_t *ladder_ctx)
  * @brief Delete memory areas
@@ -79,6 +104,119 @@ void ladder_scan_time(ladder_ctx_t *ladder_ctx);
  */
 void ladder_scan(ladder_ctx_t *ladder_ctx);
 
+/**
+ * @var ladder_function
+ * @brief Instruction functions indexed by instruction code
+ */
+extern ladder_fn_t const ladder_function[];
+
+/**
+ * @var has_side_effects_on_false
+ * @brief Instructions that must execute even without power
+ */
+extern const bool has_side_effects_on_false[LADDER_INS_INV];
+
+/**
+ * @fn static inline bool ladder_side_effects(const ladder_ctx_t *ladder_ctx, ladder_instruction_t code)
+ * @brief Instruction that must execute even without power (builtin or custom). Invalid codes and multi-cell parts too.
+ *
+ * @param ladder_ctx Ladder context
+ * @param code Instruction code
+ * @return True if the cell can't be skipped
+ */
+static inline bool ladder_side_effects(const ladder_ctx_t *ladder_ctx, ladder_instruction_t code) {
+    if (code < LADDER_INS_INV)
+        return has_side_effects_on_false[code];
+
+    const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, code);
+    return custom == NULL || custom->side_effects;
+}
+
+/**
+ * @fn bool ladder_scan_begin(ladder_ctx_t *ladder_ctx)
+ * @brief Common scan prologue (cron evaluation and network array check)
+ *
+ * @param ladder_ctx Ladder context
+ * @return False if scan must be aborted
+ */
+bool ladder_scan_begin(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_scan_network(ladder_ctx_t *ladder_ctx, uint32_t network)
+ * @brief Interpret one enabled network
+ *
+ * @param ladder_ctx Ladder context
+ * @param network Network
+ * @return False if scan must be aborted
+ */
+bool ladder_scan_network(ladder_ctx_t *ladder_ctx, uint32_t network);
+
+#ifdef OPTIONAL_COMPILED
+/**
+ * @fn void ladder_scan_compiled(ladder_ctx_t *ladder_ctx)
+ * @brief Execute ladder logic from compiled rung bytecode
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_scan_compiled(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn void ladder_scan_incremental(ladder_ctx_t *ladder_ctx)
+ * @brief Execute compiled rungs affected by register changes since the previous scan
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_scan_incremental(ladder_ctx_t *ladder_ctx);
+#endif
+
+#ifdef OPTIONAL_PARALLEL
+/**
+ * @fn void ladder_scan_parallel(ladder_ctx_t *ladder_ctx)
+ * @brief Execute compiled networks on the worker pool, level by level
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_scan_parallel(ladder_ctx_t *ladder_ctx);
+#endif
+
+#ifdef OPTIONAL_JIT
+/**
+ * @fn void ladder_scan_jit(ladder_ctx_t *ladder_ctx)
+ * @brief Execute networks translated to native code (compiled engine when native code is not available)
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_scan_jit(ladder_ctx_t *ladder_ctx);
+#endif
+
+/**
+ * @fn bool ladder_seal(ladder_ctx_t *ladder_ctx)
+ * @brief Seal a program checked by ladder_program_check when the context is ready to run (memory areas, modules and functions set)
+ *
+ * @param ladder_ctx Ladder context
+ * @return True if sealed
+ */
+bool ladder_seal(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_task_begin(ladder_ctx_t *ladder_ctx)
+ * @brief Task cycle before the scan: start time, task_before hook, input history, inputs read and output history
+ *
+ * @param ladder_ctx Ladder context
+ * @return False if the scan must be skipped
+ */
+bool ladder_task_begin(ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn bool ladder_task_end(ladder_ctx_t *ladder_ctx, bool pad)
+ * @brief Task cycle after the scan: fault revert, history, outputs write, scan time and task_after hook
+ *
+ * @param ladder_ctx Ladder context
+ * @param pad Delay up to the target scan time
+ * @return False when the task must end
+ */
+bool ladder_task_end(ladder_ctx_t *ladder_ctx, bool pad);
+
 /**
  * @fn void ladder_save_previous_values(ladder_ctx_t *ladder_ctx)
  * @brief Copy values to history
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_JIT_H
+#define LADDER_JIT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_compile.h"
+
+#ifdef OPTIONAL_JIT
+
+/**
+ * @def LADDER_JIT_AVAILABLE
+ * @brief Native code generation is supported on this target
+ */
+#if defined(__x86_64__) && (defined(__unix__) || defined(__APPLE__)) && (defined(__GNUC__) || defined(__clang__))
+#define LADDER_JIT_AVAILABLE
+#endif
+
+/**
+ * @typedef ladder_jit_fn_t
+ * @brief Native network code. Cell states must be cleared before the call.
+ *
+ * @param ladder_ctx Ladder context
+ * @param cells Network cells (row pointers)
+ * @return False if scan must be aborted
+ */
+typedef bool (*ladder_jit_fn_t)(ladder_ctx_t *ladder_ctx, ladder_cell_t **cells);
+
+/**
+ * @struct ladder_jit_s
+ * @brief Native code for a compiled program
+ *
+ */
+typedef struct ladder_jit_s {
+            uint8_t *code;        /**< Executable memory holding all networks */
+             size_t size;         /**< Executable memory size */
+           uint32_t networks_qty; /**< Networks quantity */
+    ladder_jit_fn_t *entry;       /**< Entry point of each network (NULL: network executed by the compiled engine) */
+            uint8_t *check;       /**< Lockstep check buffers (state before scan and JIT result) */
+             size_t check_size;   /**< Size of each check buffer */
+} ladder_jit_t;
+
+/**
+ * @fn ladder_jit_t* ladder_jit_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled)
+ * @brief Translate compiled networks to native code
+ *
+ * @param ladder_ctx Ladder context
+ * @param compiled Compiled program
+ * @return Native code or NULL on failure
+ */
+ladder_jit_t* ladder_jit_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled);
+
+/**
+ * @fn void ladder_jit_free(ladder_jit_t *jit)
+ * @brief Release native code
+ *
+ * @param jit Native code
+ */
+void ladder_jit_free(ladder_jit_t *jit);
+
+#endif /* OPTIONAL_JIT */
+
+#endif /* LADDER_JIT_H */
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_OPTIMIZE_H
+#define LADDER_OPTIMIZE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+
+struct ladder_compiled_network_s;
+
+/**
+ * @enum LADDER_FUSE
+ * @brief Cell sequences the optimizer runs as one operation
+ *
+ */
+typedef enum LADDER_FUSE {
+    LADDER_FUSE_NO_NO_COIL, /**< NO, NO, COIL */
+    LADDER_FUSE_NO_NC_COIL, /**< NO, NC, COIL */
+    LADDER_FUSE_EQ_MOVE,    /**< EQ, MOVE */
+    LADDER_FUSE_RE_CTU,     /**< RE, CTU */
+    LADDER_FUSE_QTY,        /**< Fused sequences quantity */
+} ladder_fuse_t;
+
+/**
+ * @struct ladder_optimize_report_s
+ * @brief What the optimizer changed in the compiled program
+ *
+ */
+typedef struct ladder_optimize_report_s {
+    uint32_t ops_before;             /**< Operations before optimization */
+    uint32_t ops_after;              /**< Operations after optimization */
+    uint32_t folded;                 /**< Compares and arithmetic on two constant operands folded */
+    uint32_t wires;                  /**< Connectors absorbed into a wire starting further left */
+    uint32_t dead_rungs;             /**< Rungs that can never energise (only instructions acting without power are kept) */
+    uint32_t removed;                /**< Operations removed: output never consumed or always unpowered */
+    uint32_t fused[LADDER_FUSE_QTY]; /**< Sequences replaced by a fused operation (ladder_fuse_t) */
+} ladder_optimize_report_t;
+
+#ifdef OPTIONAL_COMPILED
+
+/**
+ * @fn bool ladder_program_optimize(ladder_ctx_t *ladder_ctx, ladder_optimize_report_t *report)
+ * @brief Compiled engines run an optimized program: constants folded, connector runs collapsed, unpowered and unused operations removed.
+ *        Frequent cell sequences (ladder_fuse_t) run as one operation outside the groups of rungs evaluated together.
+ *        Registers, I/O, timers, counters and ladder.last behave as before; states of removed cells stay cleared.
+ *        Call after ladder_program_check(). Stays enabled on recompilation until ladder_clear_program().
+ *
+ * @param ladder_ctx Ladder context
+ * @param report What was changed (can be NULL)
+ * @return Status
+ */
+bool ladder_program_optimize(ladder_ctx_t *ladder_ctx, ladder_optimize_report_t *report);
+
+/**
+ * @fn bool ladder_optimize_network(ladder_ctx_t *ladder_ctx, uint32_t network, struct ladder_compiled_network_s *cnet, ladder_optimize_report_t *report)
+ * @brief Optimize a compiled network in place
+ *
+ * @param ladder_ctx Ladder context
+ * @param network Network
+ * @param cnet Compiled network
+ * @param report Report (counters are added)
+ * @return Status
+ */
+bool ladder_optimize_network(ladder_ctx_t *ladder_ctx, uint32_t network, struct ladder_compiled_network_s *cnet, ladder_optimize_report_t *report);
+
+/**
+ * @fn void ladder_optimize_fuse(struct ladder_compiled_network_s *cnet, ladder_optimize_report_t *report)
+ * @brief Replace frequent sequences of a compiled network by fused operations. Call after ladder_slice_network(): grouped rungs are not fused.
+ *
+ * @param cnet Compiled network
+ * @param report Report (counters are added)
+ */
+void ladder_optimize_fuse(struct ladder_compiled_network_s *cnet, ladder_optimize_report_t *report);
+
+#endif /* OPTIONAL_COMPILED */
+
+#endif /* LADDER_OPTIMIZE_H */
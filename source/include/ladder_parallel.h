@@ -0,0 +1,113 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_PARALLEL_H
+#define LADDER_PARALLEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_compile.h"
+
+#ifdef OPTIONAL_PARALLEL
+
+/**
+ * @struct ladder_parallel_level_s
+ * @brief Networks that can run concurrently: no register written by one of them is used by another
+ *
+ */
+typedef struct ladder_parallel_level_s {
+        bool barrier; /**< Single network executed on the calling thread (interpreted, invalid or foreign code, unresolved operands) */
+    uint32_t first;   /**< First network in schedule order */
+    uint32_t qty;     /**< Networks quantity */
+} ladder_parallel_level_t;
+
+/**
+ * @struct ladder_parallel_result_s
+ * @brief Network execution on a worker
+ *
+ */
+typedef struct ladder_parallel_result_s {
+        bool executed;    /**< Network was enabled and executed on this scan */
+        bool ok;          /**< Execution status */
+        bool touched;     /**< ladder.last was updated */
+     uint8_t instr;       /**< ladder.last.instr */
+     uint8_t err;         /**< ladder.last.err */
+    uint32_t cell_column; /**< ladder.last.cell_column */
+    uint32_t cell_row;    /**< ladder.last.cell_row */
+} ladder_parallel_result_t;
+
+/**
+ * @struct ladder_parallel_s
+ * @brief Parallel schedule.
+ *        A network runs on a later level than every previous network it conflicts with (one writes a register the other reads or writes).
+ *        Barriers run after all previous networks and before all following ones.
+ *
+ */
+typedef struct ladder_parallel_s {
+                    uint32_t levels_qty; /**< Levels quantity */
+     ladder_parallel_level_t *level;     /**< Levels */
+                    uint32_t *order;     /**< Networks by level, in program order inside a level */
+    ladder_parallel_result_t *result;    /**< Last execution of each network */
+} ladder_parallel_t;
+
+/**
+ * @fn ladder_parallel_t* ladder_parallel_build(ladder_ctx_t *ladder_ctx, ladder_compiled_t *compiled)
+ * @brief Build the network schedule from the register read/write sets of the compiled program
+ *
+ * @param ladder_ctx Ladder context
+ * @param compiled Compiled program
+ * @return Schedule or NULL on failure
+ */
+ladder_parallel_t* ladder_parallel_build(ladder_ctx_t *ladder_ctx, ladder_compiled_t *compiled);
+
+/**
+ * @fn void ladder_parallel_free(ladder_parallel_t *parallel)
+ * @brief Free schedule
+ *
+ * @param parallel Schedule
+ */
+void ladder_parallel_free(ladder_parallel_t *parallel);
+
+/**
+ * @fn void ladder_parallel_pool_free(ladder_ctx_t *ladder_ctx)
+ * @brief Stop worker threads and free the pool
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_parallel_pool_free(ladder_ctx_t *ladder_ctx);
+
+#endif /* OPTIONAL_PARALLEL */
+
+#endif /* LADDER_PARALLEL_H */
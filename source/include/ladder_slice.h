@@ -0,0 +1,89 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_SLICE_H
+#define LADDER_SLICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+#include "ladder_topology.h"
+
+struct ladder_compiled_network_s;
+
+/**
+ * @struct ladder_slice_s
+ * @brief Consecutive boolean rungs of the same shape (contacts, connectors, negations and coils on bound flags), evaluated together.
+ *        Each rung is a lane: the rows it takes in the column power masks, so one word operation evaluates a cell of every rung.
+ *
+ */
+typedef struct ladder_slice_s {
+       uint32_t first_op;  /**< First operation of the first rung (the shape run for every lane) */
+       uint32_t last_op;   /**< Rung end operation of the last rung */
+       uint32_t ops_qty;   /**< Operations of each rung, rung end excluded */
+       uint32_t row_start; /**< First row of the first rung */
+       uint32_t height;    /**< Rows of each rung */
+       uint32_t lanes;     /**< Rungs */
+       uint32_t lane_mask; /**< First row of every rung */
+    uint8_t **flag;        /**< Bound flag of every lane on each operation (ops_qty * lanes, NULL on operations without flag) */
+} ladder_slice_t;
+
+/**
+ * @fn bool ladder_slice_network(const ladder_topology_network_t *tnet, struct ladder_compiled_network_s *cnet)
+ * @brief Group consecutive boolean rungs of the same shape of a compiled network. Rungs of a group don't read nor write flags written by
+ *        the other ones, so evaluating them together keeps the scan order.
+ *
+ * @param tnet Network topology
+ * @param cnet Compiled network
+ * @return Status
+ */
+bool ladder_slice_network(const ladder_topology_network_t *tnet, struct ladder_compiled_network_s *cnet);
+
+/**
+ * @fn void ladder_slice_exec(const struct ladder_compiled_network_s *cnet, const ladder_slice_t *slice)
+ * @brief Evaluate the rungs of a group on the column power masks. Cell states are not written.
+ *
+ * @param cnet Compiled network
+ * @param slice Group
+ */
+void ladder_slice_exec(const struct ladder_compiled_network_s *cnet, const ladder_slice_t *slice);
+
+/**
+ * @fn void ladder_slice_free(struct ladder_compiled_network_s *cnet)
+ * @brief Free groups of a compiled network
+ *
+ * @param cnet Compiled network
+ */
+void ladder_slice_free(struct ladder_compiled_network_s *cnet);
+
+#endif /* LADDER_SLICE_H */
@@ -0,0 +1,143 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef LADDER_TOPOLOGY_H
+#define LADDER_TOPOLOGY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ladder.h"
+
+/**
+ * @struct ladder_topology_column_s
+ * @brief Rung column topology
+ *
+ */
+typedef struct ladder_topology_column_s {
+    uint32_t group_end; /**< Last row merged with the rung on this column */
+    uint32_t cycles;    /**< Watchdog cycles consumed by the skip check */
+        bool skip;      /**< Lower branch column without side effects: never executed */
+} ladder_topology_column_t;
+
+/**
+ * @struct ladder_topology_rung_s
+ * @brief Rung topology
+ *
+ */
+typedef struct ladder_topology_rung_s {
+                    uint32_t row_start;   /**< First row of the rung */
+                    uint32_t row_end;     /**< Last row of the rung (rows stacked with vertical bars on column 0) */
+                    uint32_t lead_cycles; /**< Watchdog cycles before the first column (multi-cell rows skipped above the rung plus rung row) */
+                    uint32_t live_end;    /**< Columns from here to the end are skipped (side effect free suffix of a lower branch) */
+                    uint64_t cycles;      /**< Watchdog cycles consumed by the whole rung */
+                        bool is_lower;    /**< Lower branch (starts without power) */
+    ladder_topology_column_t *column;     /**< Columns */
+                     uint8_t *live;       /**< Columns walked by the sparse walk: not skipped and with a non empty cell on the rung rows */
+                    uint32_t live_qty;    /**< Live columns quantity */
+                    uint32_t last_row;    /**< Last cell executed by the full walk: row (valid if live_end > 0) */
+                    uint32_t last_column; /**< Last cell executed by the full walk: column */
+} ladder_topology_rung_t;
+
+/**
+ * @struct ladder_topology_network_s
+ * @brief Network topology
+ *
+ */
+typedef struct ladder_topology_network_s {
+                  uint32_t rows;                              /**< Network rows when built */
+                  uint32_t cols;                              /**< Network columns when built */
+                  uint32_t rungs_qty;                         /**< Rungs quantity */
+                  uint32_t tail_cycles;                       /**< Watchdog cycles of multi-cell rows after the last rung */
+                  uint64_t cycles;                            /**< Watchdog cycles consumed by the whole network */
+    ladder_topology_rung_t *rung;                             /**< Rungs */
+                  uint16_t *clear;                            /**< Cells a scan can power (instruction cells and merged groups): row << 8 | column, by row */
+                  uint32_t clear_start[LADDER_MAX_ROWS + 1];  /**< First entry of each row in clear (rows + 1 entries) */
+                  uint16_t *sparse;                           /**< Non empty cells (not NOP, vertical bar or data): row << 8 | column, by row and column */
+                  uint32_t sparse_start[LADDER_MAX_ROWS + 1]; /**< First entry of each row in sparse (rows + 1 entries) */
+} ladder_topology_network_t;
+
+/**
+ * @struct ladder_topology_s
+ * @brief Program topology
+ *
+ */
+typedef struct ladder_topology_s {
+                     uint32_t networks_qty; /**< Networks quantity */
+    ladder_topology_network_t *network;     /**< Networks */
+} ladder_topology_t;
+
+/**
+ * @fn static inline bool ladder_topology_empty(const ladder_cell_t *cell)
+ * @brief Cell left out of the sparse index: NOP without vertical bar nor data
+ *
+ * @param cell Cell
+ * @return Empty
+ */
+static inline bool ladder_topology_empty(const ladder_cell_t *cell) {
+    return cell->code == LADDER_INS_NOP && !cell->vertical_bar && cell->data_qty == 0;
+}
+
+/**
+ * @fn static inline void ladder_topology_clear(ladder_network_t *net, const uint16_t *clear, uint32_t first, uint32_t last)
+ * @brief Remove power from listed cells. Cells out of the list are never powered.
+ *
+ * @param net Network
+ * @param clear Cells list
+ * @param first First entry
+ * @param last Entry after the last one
+ */
+static inline void ladder_topology_clear(ladder_network_t *net, const uint16_t *clear, uint32_t first, uint32_t last) {
+    for (uint32_t n = first; n < last; n++)
+        net->cells[clear[n] >> 8][clear[n] & 0xff].state = false;
+}
+
+/**
+ * @fn ladder_topology_network_t* ladder_topology_get(ladder_ctx_t *ladder_ctx, uint32_t network)
+ * @brief Get network topology, building the program topology if it was discarded
+ *
+ * @param ladder_ctx Ladder context
+ * @param network Network
+ * @return Network topology or NULL on allocation failure
+ */
+ladder_topology_network_t* ladder_topology_get(ladder_ctx_t *ladder_ctx, uint32_t network);
+
+/**
+ * @fn void ladder_topology_free(ladder_ctx_t *ladder_ctx)
+ * @brief Free program topology
+ *
+ * @param ladder_ctx Ladder context
+ */
+void ladder_topology_free(ladder_ctx_t *ladder_ctx);
+
+#endif /* LADDER_TOPOLOGY_H */
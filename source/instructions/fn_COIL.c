@@ -38,16 +38,16 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_COIL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_COIL(const ladder_frame_t *frame) {
     uint32_t val = 0;
     ladder_ins_err_t error = LADDER_INS_ERR_OK;
 
-    CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
 
-    if (CELL_STATE(ladder_ctx, column, row))
+    if (FRAME_STATE(frame, 0))
         val = 1;
 
-    ladder_set_data_value(ladder_ctx, row, column, 0, (void*) &val, &error);
+    ladder_frame_set(frame, 0, (void*) &val, &error);
 
     return LADDER_INS_ERR_OK;
 }
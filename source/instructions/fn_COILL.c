@@ -38,16 +38,16 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_COILL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_COILL(const ladder_frame_t *frame) {
     ladder_ins_err_t error = LADDER_INS_ERR_OK;
 
-    bool state = CELL_STATE_LEFT(ladder_ctx, column, row);
-    bool prev = ladder_get_previous_value(ladder_ctx, row, column, 0); // From history (Mh/Qh)
+    bool state = FRAME_LEFT(frame, 0);
+    bool prev = ladder_frame_previous(frame, 0); // From history (Mh/Qh)
     uint32_t val = (prev || state) ? 1 : 0;
 
-    CELL_STATE(ladder_ctx, column, row) = (bool) val; // Power flow = latched output
+    FRAME_STATE(frame, 0) = (bool) val; // Power flow = latched output
 
-    ladder_set_data_value(ladder_ctx, row, column, 0, (void*) &val, &error);
+    ladder_frame_set(frame, 0, (void*) &val, &error);
 
     return LADDER_INS_ERR_OK;
 }
@@ -38,45 +38,46 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_CTU(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_CTU(const ladder_frame_t *frame) {
+    ladder_ctx_t *ladder_ctx = frame->ctx;
+    int32_t c = FRAME_DATA(frame, 0).value.i32;
+
     // reset counter
-    if (column == 0) {
+    if (frame->column == 0) {
         if ((*ladder_ctx).ladder.state == LADDER_ST_RUNNING) {
-            (*ladder_ctx).registers.C[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = 0;
-            (*ladder_ctx).memory.Cd[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
-            (*ladder_ctx).memory.Cr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
-            CELL_STATE(ladder_ctx, column, row) = false;
-            CELL_STATE(ladder_ctx, column, row + 1) = false;
+            (*ladder_ctx).registers.C[c] = 0;
+            (*ladder_ctx).memory.Cd[c] = false;
+            (*ladder_ctx).memory.Cr[c] = false;
+            FRAME_STATE(frame, 0) = false;
+            FRAME_STATE(frame, 1) = false;
         }
     } else {
-        if (CELL_STATE_LEFT(ladder_ctx, column, row + 1)) {
-            (*ladder_ctx).registers.C[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = 0;
-            (*ladder_ctx).memory.Cd[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
-            (*ladder_ctx).memory.Cr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
-            CELL_STATE(ladder_ctx, column, row) = false;
-            CELL_STATE(ladder_ctx, column, row + 1) = false;
+        if (FRAME_LEFT(frame, 1)) {
+            (*ladder_ctx).registers.C[c] = 0;
+            (*ladder_ctx).memory.Cd[c] = false;
+            (*ladder_ctx).memory.Cr[c] = false;
+            FRAME_STATE(frame, 0) = false;
+            FRAME_STATE(frame, 1) = false;
         }
     }
 
     // counter is activated in this scan, change count
-    if (CELL_STATE_LEFT(ladder_ctx, column, row) && !(*ladder_ctx).memory.Cr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]
-            && !(*ladder_ctx).memory.Cd[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]) {
-        (*ladder_ctx).memory.Cr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = true;
-        CELL_STATE(ladder_ctx, column, row + 1) = true;
-        (*ladder_ctx).registers.C[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]++;
+    if (FRAME_LEFT(frame, 0) && !(*ladder_ctx).memory.Cr[c] && !(*ladder_ctx).memory.Cd[c]) {
+        (*ladder_ctx).memory.Cr[c] = true;
+        FRAME_STATE(frame, 1) = true;
+        (*ladder_ctx).registers.C[c]++;
     }
 
     // reset counter edge detection
-    if (!CELL_STATE_LEFT(ladder_ctx, column, row)) {
-        (*ladder_ctx).memory.Cr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
-        CELL_STATE(ladder_ctx, column, row + 1) = false;
+    if (!FRAME_LEFT(frame, 0)) {
+        (*ladder_ctx).memory.Cr[c] = false;
+        FRAME_STATE(frame, 1) = false;
     }
 
     // counter done
-    if ((*ladder_ctx).registers.C[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]
-            >= (*(*ladder_ctx).exec_network).cells[row][column].data[1].value.i32) {
-        (*ladder_ctx).memory.Cd[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = true;
-        CELL_STATE(ladder_ctx, column, row) = true;
+    if ((*ladder_ctx).registers.C[c] >= (uint32_t) FRAME_DATA(frame, 1).value.i32) {
+        (*ladder_ctx).memory.Cd[c] = true;
+        FRAME_STATE(frame, 0) = true;
     }
 
     return LADDER_INS_ERR_OK;
@@ -38,16 +38,16 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_MOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
-    ladder_ctx_t *lctx = ladder_ctx;
+ladder_ins_err_t fn_MOVE(const ladder_frame_t *frame) {
+    ladder_ctx_t *lctx = frame->ctx;
     ladder_ins_err_t err = LADDER_INS_ERR_OK;
 
-    if (!exnet(lctx).cells[row][column].data || exnet(lctx).cells[row][column].data_qty < 2) {
+    if (!frame->data || frame->cell->data_qty < 2) {
         return LADDER_INS_ERR_OUTOFRANGE;
     }
 
-    ladder_register_t src_type = exnet(lctx).cells[row][column].data[0].type;
-    ladder_register_t dest_type = exnet(lctx).cells[row][column].data[1].type;
+    ladder_register_t src_type = FRAME_DATA(frame, 0).type;
+    ladder_register_t dest_type = FRAME_DATA(frame, 1).type;
 
     // Define union for type-safe 32-bit copy (int32/float both 4 bytes)
     typedef union {
@@ -66,13 +66,13 @@ ladder_ins_err_t fn_MOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row
         case LADDER_REGISTER_QW:
         case LADDER_REGISTER_C:
         case LADDER_REGISTER_T:  // uint64_t but treat as i32 for move subset
-            src_val.i = ladder_get_data_value(lctx, row, column, 0);  // Safe for ints
+            src_val.i = ladder_frame_get(frame, 0);  // Safe for ints
             is_int_src = true;
             break;
         case LADDER_REGISTER_R:
             // Direct fetch for float (macro casts wrong)
             {
-                uint32_t idx = exnet(lctx).cells[row][column].data[0].value.i32;
+                uint32_t idx = FRAME_DATA(frame, 0).value.i32;
                 if (idx >= lctx->ladder.quantity.r) {
                     return LADDER_INS_ERR_OUTOFRANGE;
                 }
@@ -101,13 +101,13 @@ ladder_ins_err_t fn_MOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row
     // Set destination (use set_data for consistency, pass correct pointer/size)
     ladder_ins_err_t set_err = LADDER_INS_ERR_OK;
     void *val_ptr = is_float_dest ? (void *)&dest_val.f : (void *)&dest_val.i;  // Casts to void* for ternary compatibility.
-    ladder_set_data_value(lctx, row, column, 1, val_ptr, &set_err);
+    ladder_frame_set(frame, 1, val_ptr, &set_err);
     if (set_err != LADDER_INS_ERR_OK) {
         err = LADDER_INS_ERR_SETDATAVAL;
     }
 
     // Propagate power flow
-    CELL_STATE(lctx, column, row) = CELL_STATE_LEFT(lctx, column, row);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
 
     return err;
 }
@@ -38,14 +38,14 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_MUL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_MUL(const ladder_frame_t *frame) {
     ladder_ins_err_t error = LADDER_INS_ERR_OK;
 
-    CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
 
-    if (CELL_STATE_LEFT(ladder_ctx, column, row)) {
-        int32_t val = ladder_get_data_value(ladder_ctx, row, column, 0) * ladder_get_data_value(ladder_ctx, row, column, 1);
-        ladder_set_data_value(ladder_ctx, row, column, 2, (void*) &val, &error);
+    if (FRAME_LEFT(frame, 0)) {
+        int32_t val = ladder_frame_get(frame, 0) * ladder_frame_get(frame, 1);
+        ladder_frame_set(frame, 2, (void*) &val, &error);
     }
 
     return LADDER_INS_ERR_OK;
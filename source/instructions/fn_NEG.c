@@ -38,8 +38,8 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_NEG(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
-    CELL_STATE(ladder_ctx, column, row) = !CELL_STATE_LEFT(ladder_ctx, column, row);
+ladder_ins_err_t fn_NEG(const ladder_frame_t *frame) {
+    FRAME_STATE(frame, 0) = !FRAME_LEFT(frame, 0);
 
     return LADDER_INS_ERR_OK;
 }
@@ -38,10 +38,10 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_RE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
-    CELL_STATE(ladder_ctx, column, row) =
-    MAKE_BOOL(ladder_get_data_value(ladder_ctx, row, column, 0) &&
-            !ladder_get_previous_value(ladder_ctx, row, column, 0)) && CELL_STATE_LEFT(ladder_ctx, column, row);
+ladder_ins_err_t fn_RE(const ladder_frame_t *frame) {
+    FRAME_STATE(frame, 0) =
+    MAKE_BOOL(ladder_frame_get(frame, 0) &&
+            !ladder_frame_previous(frame, 0)) && FRAME_LEFT(frame, 0);
 
     return LADDER_INS_ERR_OK;
 }
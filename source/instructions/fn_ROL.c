@@ -38,11 +38,11 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_ROL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_ROL(const ladder_frame_t *frame) {
     ladder_ins_err_t error = LADDER_INS_ERR_OK;
 
-    int32_t val = ladder_get_data_value(ladder_ctx, row, column, 0);
-    int32_t amount = ladder_get_data_value(ladder_ctx, row, column, 1);
+    int32_t val = ladder_frame_get(frame, 0);
+    int32_t amount = ladder_frame_get(frame, 1);
     uint32_t uval = (uint32_t) val;
     amount %= 32;
     if (amount < 0)
@@ -50,9 +50,9 @@ ladder_ins_err_t fn_ROL(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row)
     uval = (uval << amount) | (uval >> (32 - amount));
     val = (int32_t) uval;
 
-    ladder_set_data_value(ladder_ctx, row, column, 0, &val, &error);
+    ladder_frame_set(frame, 0, &val, &error);
 
-    CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
 
     return error;
 }
@@ -38,24 +38,24 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_SUB(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_SUB(const ladder_frame_t *frame) {
     ladder_ins_err_t error = LADDER_INS_ERR_OK;
 
-    CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row);
-    int32_t auxValue1 = ladder_get_data_value(ladder_ctx, row, column, 0);
-    int32_t auxValue2 = ladder_get_data_value(ladder_ctx, row, column, 1);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
+    int32_t auxValue1 = ladder_frame_get(frame, 0);
+    int32_t auxValue2 = ladder_frame_get(frame, 1);
 
-    if (CELL_STATE_LEFT(ladder_ctx, column, row)) {
+    if (FRAME_LEFT(frame, 0)) {
         if (auxValue1 > auxValue2) {
-            CELL_STATE(ladder_ctx, column, row) = true;
+            FRAME_STATE(frame, 0) = true;
         } else if (auxValue1 == auxValue2) {
-            CELL_STATE(ladder_ctx, column, row + 1) = true;
+            FRAME_STATE(frame, 1) = true;
         } else {
-            CELL_STATE(ladder_ctx, column, row + 2) = true;
+            FRAME_STATE(frame, 2) = true;
         }
 
         uint32_t res = auxValue1 - auxValue2;
-        ladder_set_data_value(ladder_ctx, row, column, 2, &res, &error);
+        ladder_frame_set(frame, 2, &res, &error);
     }
 
     return LADDER_INS_ERR_OK;
@@ -92,24 +92,26 @@ static void ladder_set_table_i32(ladder_ctx_t *ladder_ctx, uint32_t table_net, u
     net->cells[r][c].data[0].value.i32 = val;
 }
 
-ladder_ins_err_t fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_TMOVE(const ladder_frame_t *frame) {
+    ladder_ctx_t *ladder_ctx = frame->ctx;
+
     // MAX_MOVE=1024 (safe for 32x255=8160, but cap low)
 #define MAX_MOVE 1024
-    int32_t dest_net = ladder_get_data_value(ladder_ctx, row, column, 0);
-    int32_t dest_pos = ladder_get_data_value(ladder_ctx, row, column, 1);
-    int32_t src_net = ladder_get_data_value(ladder_ctx, row, column, 2);
-    int32_t src_pos = ladder_get_data_value(ladder_ctx, row, column, 3);
-    int32_t qty_raw = ladder_get_data_value(ladder_ctx, row, column, 4);
+    int32_t dest_net = ladder_frame_get(frame, 0);
+    int32_t dest_pos = ladder_frame_get(frame, 1);
+    int32_t src_net = ladder_frame_get(frame, 2);
+    int32_t src_pos = ladder_frame_get(frame, 3);
+    int32_t qty_raw = ladder_frame_get(frame, 4);
     uint32_t qty = (qty_raw < 0 || qty_raw > MAX_MOVE) ? 0 : (uint32_t) qty_raw; // Handle negative as 0, cap
 
     if (qty == 0) {
-        CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row); // Success for zero
+        FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0); // Success for zero
         return LADDER_INS_ERR_OK;
     }
 
     // Check table enables (disabled for data tables)
     if (ladder_ctx->network[dest_net].enable || ladder_ctx->network[src_net].enable) {
-        CELL_STATE(ladder_ctx, column, row) = false;
+        FRAME_STATE(frame, 0) = false;
         return LADDER_INS_ERR_NOTABLE;
     }
 
@@ -117,7 +119,7 @@ ladder_ins_err_t fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t ro
     uint32_t dest_size = ladder_ctx->network[dest_net].rows * ladder_ctx->network[dest_net].cols;
     uint32_t src_size = ladder_ctx->network[src_net].rows * ladder_ctx->network[src_net].cols;
     if (dest_pos + qty > dest_size || src_pos + qty > src_size) {
-        CELL_STATE(ladder_ctx, column, row) = false;
+        FRAME_STATE(frame, 0) = false;
         return LADDER_INS_ERR_OUTOFRANGE;
     }
 
@@ -131,7 +133,7 @@ ladder_ins_err_t fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t ro
         }
     }
     if (read_err != LADDER_INS_ERR_OK) {
-        CELL_STATE(ladder_ctx, column, row) = false;
+        FRAME_STATE(frame, 0) = false;
         return read_err;
     }
 
@@ -143,11 +145,11 @@ ladder_ins_err_t fn_TMOVE(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t ro
         }
     }
     if (write_err != LADDER_INS_ERR_OK) {
-        CELL_STATE(ladder_ctx, column, row) = false;
+        FRAME_STATE(frame, 0) = false;
         return write_err;
     }
 
     // Success: Propagate power
-    CELL_STATE(ladder_ctx, column, row) = CELL_STATE_LEFT(ladder_ctx, column, row);
+    FRAME_STATE(frame, 0) = FRAME_LEFT(frame, 0);
     return LADDER_INS_ERR_OK;
 }
@@ -38,39 +38,38 @@
 #include "ladder_internals.h"
 #include "ladder_instructions.h"
 
-ladder_ins_err_t fn_TP(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+ladder_ins_err_t fn_TP(const ladder_frame_t *frame) {
+    ladder_ctx_t *ladder_ctx = frame->ctx;
+    int32_t t = FRAME_DATA(frame, 0).value.i32;
+    ladder_timer_t *timer = &(*ladder_ctx).timers[t];
+    const ladder_value_t *preset = &FRAME_DATA(frame, 1);
+
     // detect rising edge to start pulse
-    if (CELL_STATE_LEFT(ladder_ctx, column, row) && !ladder_get_previous_value(ladder_ctx, row, column, 0)
-            && !(*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]) {
-        (*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = true;
+    if (FRAME_LEFT(frame, 0) && !ladder_frame_previous(frame, 0) && !(*ladder_ctx).memory.Tr[t]) {
+        (*ladder_ctx).memory.Tr[t] = true;
 
-        (*ladder_ctx).timers[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32].time_stamp = (*ladder_ctx).hw.time.millis();
+        timer->time_stamp = (*ladder_ctx).hw.time.millis();
     }
 
     // timer is running, update acc value
-    if ((*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]) {
-        (*ladder_ctx).timers[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32].acc = (uint16_t) (((*ladder_ctx).hw.time.millis()
-                - (*ladder_ctx).timers[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32].time_stamp)
-                / basetime_factor[(*(*ladder_ctx).exec_network).cells[row][column].data[1].type]);
+    if ((*ladder_ctx).memory.Tr[t]) {
+        timer->acc = (uint16_t) (((*ladder_ctx).hw.time.millis() - timer->time_stamp) / basetime_factor[preset->type]);
     }
 
     // timer done --> deactivate
-    if ((*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32]
-            && (((*ladder_ctx).hw.time.millis() - (*ladder_ctx).timers[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32].time_stamp)
-                    >= ((*(*ladder_ctx).exec_network).cells[row][column].data[1].value.i32
-                            * basetime_factor[(*(*ladder_ctx).exec_network).cells[row][column].data[1].type]))) {
-        (*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = false;
+    if ((*ladder_ctx).memory.Tr[t]
+            && (((*ladder_ctx).hw.time.millis() - timer->time_stamp) >= (preset->value.i32 * basetime_factor[preset->type]))) {
+        (*ladder_ctx).memory.Tr[t] = false;
 
-        (*ladder_ctx).memory.Td[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32] = true;
+        (*ladder_ctx).memory.Td[t] = true;
 
-        (*ladder_ctx).timers[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32].acc =
-                (*(*ladder_ctx).exec_network).cells[row][column].data[1].value.i32;
+        timer->acc = preset->value.i32;
     }
 
-    CELL_STATE(ladder_ctx, column, row + 1) = (*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32];
+    FRAME_STATE(frame, 1) = (*ladder_ctx).memory.Tr[t];
 
     // Set the state to Tr every scan to persist across clears
-    CELL_STATE(ladder_ctx, column, row) = (*ladder_ctx).memory.Tr[ladder_cell_data_exec(ladder_ctx, row, column, 0).value.i32];
+    FRAME_STATE(frame, 0) = (*ladder_ctx).memory.Tr[t];
 
     return LADDER_INS_ERR_OK;
 }
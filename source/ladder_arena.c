@@ -0,0 +1,177 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_arena.h"
+
+#define LADDER_ARENA_ALIGN      _Alignof(max_align_t)
+#define LADDER_ARENA_HEADER     ((sizeof(ladder_arena_block_t) + LADDER_ARENA_ALIGN - 1) & ~(LADDER_ARENA_ALIGN - 1))
+#define LADDER_ARENA_MIN_BLOCK  4096
+
+static inline uint8_t* ladder_arena_data(const ladder_arena_block_t *block) {
+    return (uint8_t*) block + LADDER_ARENA_HEADER;
+}
+
+// FNV-1a
+static uint32_t ladder_arena_hash(const char *str) {
+    uint32_t hash = 2166136261u;
+    for (; *str != '\0'; str++)
+        hash = (hash ^ (uint8_t) *str) * 16777619u;
+
+    return hash;
+}
+
+static bool ladder_arena_strings_grow(ladder_arena_t *arena) {
+    uint32_t size = arena->strings_size == 0 ? 64 : arena->strings_size * 2;
+    const char **strings = calloc(size, sizeof(const char*));
+    if (strings == NULL)
+        return false;
+
+    for (uint32_t n = 0; n < arena->strings_size; n++) {
+        if (arena->strings[n] == NULL)
+            continue;
+        uint32_t slot = ladder_arena_hash(arena->strings[n]) & (size - 1);
+        while (strings[slot] != NULL)
+            slot = (slot + 1) & (size - 1);
+        strings[slot] = arena->strings[n];
+    }
+
+    free(arena->strings);
+    arena->strings = strings;
+    arena->strings_size = size;
+
+    return true;
+}
+
+ladder_arena_t* ladder_arena_get(ladder_ctx_t *ladder_ctx, size_t block_size) {
+    if (ladder_ctx->arena != NULL)
+        return (ladder_arena_t*) ladder_ctx->arena;
+
+    ladder_arena_t *arena = calloc(1, sizeof(ladder_arena_t));
+    if (arena == NULL)
+        return NULL;
+
+    arena->block_size = block_size < LADDER_ARENA_MIN_BLOCK ? LADDER_ARENA_MIN_BLOCK : block_size;
+    ladder_ctx->arena = arena;
+
+    return arena;
+}
+
+void ladder_arena_free(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->arena == NULL)
+        return;
+
+    ladder_arena_t *arena = (ladder_arena_t*) ladder_ctx->arena;
+    if (ladder_ctx->network != NULL)
+        for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++)
+            if (ladder_ctx->network[n].arena == arena)
+                ladder_ctx->network[n].arena = NULL;
+
+    while (arena->block != NULL) {
+        ladder_arena_block_t *next = arena->block->next;
+        free(arena->block);
+        arena->block = next;
+    }
+    free(arena->strings);
+    free(arena);
+    ladder_ctx->arena = NULL;
+}
+
+void* ladder_arena_alloc(ladder_arena_t *arena, size_t size) {
+    if (arena == NULL || size > SIZE_MAX / 2 - LADDER_ARENA_HEADER)
+        return NULL;
+
+    size = (size + LADDER_ARENA_ALIGN - 1) & ~(LADDER_ARENA_ALIGN - 1);
+
+    ladder_arena_block_t *block = arena->block;
+    if (block == NULL || block->size - block->used < size) {
+        size_t block_size = size > arena->block_size ? size : arena->block_size;
+        // calloc: memory handed out is never reused, so it is already zeroed
+        block = calloc(1, LADDER_ARENA_HEADER + block_size);
+        if (block == NULL)
+            return NULL;
+        block->size = block_size;
+        block->next = arena->block;
+        arena->block = block;
+        // few blocks even when the first size hint is too small
+        if (arena->block_size < SIZE_MAX / 4)
+            arena->block_size *= 2;
+    }
+
+    void *ptr = ladder_arena_data(block) + block->used;
+    block->used += size;
+
+    return ptr;
+}
+
+const char* ladder_arena_strdup(ladder_arena_t *arena, const char *str) {
+    if (arena == NULL || str == NULL)
+        return NULL;
+
+    if (arena->strings_qty * 2 >= arena->strings_size && !ladder_arena_strings_grow(arena))
+        return NULL;
+
+    uint32_t slot = ladder_arena_hash(str) & (arena->strings_size - 1);
+    while (arena->strings[slot] != NULL) {
+        if (strcmp(arena->strings[slot], str) == 0)
+            return arena->strings[slot];
+        slot = (slot + 1) & (arena->strings_size - 1);
+    }
+
+    size_t len = strlen(str) + 1;
+    char *copy = ladder_arena_alloc(arena, len);
+    if (copy == NULL)
+        return NULL;
+    memcpy(copy, str, len);
+
+    arena->strings[slot] = copy;
+    arena->strings_qty++;
+
+    return copy;
+}
+
+bool ladder_arena_owns(const ladder_arena_t *arena, const void *ptr) {
+    if (arena == NULL || ptr == NULL)
+        return false;
+
+    for (const ladder_arena_block_t *block = arena->block; block != NULL; block = block->next)
+        if ((uintptr_t) ptr >= (uintptr_t) ladder_arena_data(block) && (uintptr_t) ptr < (uintptr_t) ladder_arena_data(block) + block->size)
+            return true;
+
+    return false;
+}
@@ -0,0 +1,607 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_batch.h"
+#include "ladder_bits.h"
+
+#ifdef OPTIONAL_COMPILED
+
+// Power of each cell as a lane mask: left rail first (all lanes), then columns of LADDER_MAX_ROWS words
+#define LADDER_BATCH_POWER(column, row) power[((column) + 1) * LADDER_MAX_ROWS + (row)]
+#define LADDER_BATCH_LEFT               LADDER_BATCH_POWER(op->column - 1, op->row)
+#define LADDER_BATCH_SET(value)         LADDER_BATCH_POWER(op->column, op->row) = (value)
+
+#define LADDER_BATCH_LAST(lctx, op)                                     \
+            (lctx)->ladder.last.instr = (op)->code;                     \
+            (lctx)->ladder.last.err = LADDER_INS_ERR_OK;                \
+            (lctx)->ladder.last.network = network;                      \
+            (lctx)->ladder.last.cell_row = (op)->row;                   \
+            (lctx)->ladder.last.cell_column = (op)->column
+
+typedef struct ladder_batch_network_s {
+                      bool interpreted; /**< Run on the interpreter of each instance */
+         const ladder_op_t *ops;        /**< Operations (same on every instance) */
+                      void **ptr;       /**< Register of each bound operand on each instance (operand * lanes + lane) */
+                   uint8_t **prev;      /**< Previous scan value of each bound operand on each instance */
+    const ladder_operand_t **operands;  /**< Bound operands of each instance */
+} ladder_batch_network_t;
+
+struct ladder_batch_s {
+                  uint32_t lanes;        /**< Instances */
+              ladder_ctx_t *lane;        /**< Instance contexts */
+                      void **compiled;   /**< Compiled program of each instance seen by the last bind */
+                  uint32_t networks_qty; /**< Networks */
+    ladder_batch_network_t *network;     /**< Operands of every instance by network */
+                  uint64_t *power;       /**< Cell power (lane masks) */
+         ladder_batch_io_t io;           /**< Scenario */
+                  uint64_t tick;         /**< Cycles run */
+                  uint64_t now;          /**< Virtual time in ms */
+};
+
+static _Thread_local ladder_batch_t *ladder_batch_current; // batch run by this thread (I/O functions of the instances)
+static _Thread_local uint64_t ladder_batch_now;            // millis() of the instances
+
+static uint64_t ladder_batch_millis(void) {
+    return ladder_batch_now;
+}
+
+static void ladder_batch_delay(long ms) {
+    (void) ms;
+}
+
+static void ladder_batch_read(ladder_ctx_t *ladder_ctx, uint32_t id) {
+    ladder_batch_t *batch = ladder_batch_current;
+    if (batch != NULL && batch->io.read != NULL)
+        batch->io.read(ladder_ctx, (uint32_t) (ladder_ctx - batch->lane), id, batch->tick, batch->io.arg);
+}
+
+static void ladder_batch_write(ladder_ctx_t *ladder_ctx, uint32_t id) {
+    ladder_batch_t *batch = ladder_batch_current;
+    if (batch != NULL && batch->io.write != NULL)
+        batch->io.write(ladder_ctx, (uint32_t) (ladder_ctx - batch->lane), id, batch->tick, batch->io.arg);
+}
+
+static bool ladder_batch_copy_program(const ladder_ctx_t *ladder_ctx, ladder_ctx_t *lane) {
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        const ladder_network_t *src = &ladder_ctx->network[n];
+        ladder_network_t *dst = &lane->network[n];
+        if (src->cells == NULL || ((src->rows != dst->rows || src->cols != dst->cols) && !ladder_network_alloc(dst, src->rows, src->cols)))
+            return false;
+        dst->enable = src->enable;
+
+        for (uint32_t r = 0; r < src->rows; r++)
+            for (uint32_t c = 0; c < src->cols; c++) {
+                const ladder_cell_t *from = &src->cells[r][c];
+                ladder_cell_t *to = &dst->cells[r][c];
+                if (from->code == LADDER_INS_FOREIGN)
+                    return false;
+                to->code = from->code;
+                to->vertical_bar = from->vertical_bar;
+                if (from->data_qty == 0 || from->data == NULL)
+                    continue;
+                to->data = calloc(from->data_qty, sizeof(ladder_value_t));
+                if (to->data == NULL)
+                    return false;
+                to->data_qty = from->data_qty;
+                memcpy(to->data, from->data, from->data_qty * sizeof(ladder_value_t));
+                for (uint32_t d = 0; d < from->data_qty; d++)
+                    if (from->data[d].type == LADDER_REGISTER_S && from->data[d].value.cstr != NULL
+                            && (to->data[d].value.cstr = strdup(from->data[d].value.cstr)) == NULL)
+                        return false;
+            }
+    }
+
+    return true;
+}
+
+static void ladder_batch_copy_memory(const ladder_ctx_t *ladder_ctx, ladder_ctx_t *lane) {
+    uint32_t m = ladder_ctx->ladder.quantity.m, c = ladder_ctx->ladder.quantity.c, t = ladder_ctx->ladder.quantity.t;
+
+    memcpy(lane->memory.M, ladder_ctx->memory.M, m * sizeof(uint8_t));
+    memcpy(lane->memory.Cd, ladder_ctx->memory.Cd, c * sizeof(bool));
+    memcpy(lane->memory.Cr, ladder_ctx->memory.Cr, c * sizeof(bool));
+    memcpy(lane->memory.Td, ladder_ctx->memory.Td, t * sizeof(bool));
+    memcpy(lane->memory.Tr, ladder_ctx->memory.Tr, t * sizeof(bool));
+    memcpy(LADDER_HISTORY(lane, M), LADDER_HISTORY(ladder_ctx, M), ladder_history_size(m));
+    memcpy(LADDER_HISTORY(lane, Cd), LADDER_HISTORY(ladder_ctx, Cd), ladder_history_size(c));
+    memcpy(LADDER_HISTORY(lane, Cr), LADDER_HISTORY(ladder_ctx, Cr), ladder_history_size(c));
+    memcpy(LADDER_HISTORY(lane, Td), LADDER_HISTORY(ladder_ctx, Td), ladder_history_size(t));
+    memcpy(LADDER_HISTORY(lane, Tr), LADDER_HISTORY(ladder_ctx, Tr), ladder_history_size(t));
+    memcpy(lane->registers.C, ladder_ctx->registers.C, c * sizeof(uint32_t));
+    memcpy(lane->registers.D, ladder_ctx->registers.D, ladder_ctx->ladder.quantity.d * sizeof(int32_t));
+    memcpy(lane->registers.R, ladder_ctx->registers.R, ladder_ctx->ladder.quantity.r * sizeof(float));
+    memcpy(lane->timers, ladder_ctx->timers, t * sizeof(ladder_timer_t));
+}
+
+// I/O modules of the same size holding the same values
+static bool ladder_batch_copy_io(const ladder_ctx_t *ladder_ctx, ladder_ctx_t *lane) {
+    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
+        if (!ladder_add_read_fn(lane, ladder_batch_read, ladder_ctx->hw.io.init_read[n]))
+            return false;
+        const ladder_hw_input_vals_t *src = &ladder_ctx->input[n];
+        ladder_hw_input_vals_t *dst = &lane->input[n];
+        if (dst->i_qty != src->i_qty || dst->iw_qty != src->iw_qty)
+            return false;
+        if (src->i_qty > 0 && src->I != NULL && dst->I != NULL)
+            memcpy(dst->I, src->I, src->i_qty * sizeof(uint8_t));
+        if (src->i_qty > 0 && src->Ih != NULL && dst->Ih != NULL)
+            memcpy(dst->Ih, src->Ih, src->i_qty * sizeof(uint8_t));
+        if (src->iw_qty > 0 && src->IW != NULL && dst->IW != NULL)
+            memcpy(dst->IW, src->IW, src->iw_qty * sizeof(int32_t));
+        if (src->iw_qty > 0 && src->IWh != NULL && dst->IWh != NULL)
+            memcpy(dst->IWh, src->IWh, src->iw_qty * sizeof(int32_t));
+    }
+
+    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+        if (!ladder_add_write_fn(lane, ladder_batch_write, ladder_ctx->hw.io.init_write[n]))
+            return false;
+        const ladder_hw_output_vals_t *src = &ladder_ctx->output[n];
+        ladder_hw_output_vals_t *dst = &lane->output[n];
+        if (dst->q_qty != src->q_qty || dst->qw_qty != src->qw_qty)
+            return false;
+        if (src->q_qty > 0 && src->Q != NULL && dst->Q != NULL)
+            memcpy(dst->Q, src->Q, src->q_qty * sizeof(uint8_t));
+        if (src->q_qty > 0 && src->Qh != NULL && dst->Qh != NULL)
+            memcpy(dst->Qh, src->Qh, src->q_qty * sizeof(uint8_t));
+        if (src->qw_qty > 0 && src->QW != NULL && dst->QW != NULL)
+            memcpy(dst->QW, src->QW, src->qw_qty * sizeof(int32_t));
+        if (src->qw_qty > 0 && src->QWh != NULL && dst->QWh != NULL)
+            memcpy(dst->QWh, src->QWh, src->qw_qty * sizeof(int32_t));
+    }
+
+    return true;
+}
+
+static bool ladder_batch_clone(ladder_ctx_t *ladder_ctx, ladder_ctx_t *lane) {
+    const ladder_network_t *net = &ladder_ctx->network[0];
+    if (!ladder_ctx_init(lane, net->cols, net->rows, ladder_ctx->ladder.quantity.networks, ladder_ctx->ladder.quantity.m, ladder_ctx->ladder.quantity.c,
+            ladder_ctx->ladder.quantity.t, ladder_ctx->ladder.quantity.d, ladder_ctx->ladder.quantity.r, ladder_ctx->ladder.quantity.delay_not_run,
+            ladder_ctx->ladder.quantity.watchdog_ms, true, ladder_ctx->ladder.write_on_fault, ladder_ctx->scan_internals.max_scan_cycles,
+            ladder_ctx->scan_internals.target_scan_ms))
+        return false;
+
+    // cron reads the wall clock: instances run on the virtual clock only
+    free(lane->cron);
+    lane->cron = NULL;
+    lane->hw.time.millis = ladder_batch_millis;
+    lane->hw.time.delay = ladder_batch_delay;
+    lane->ladder.optimize = ladder_ctx->ladder.optimize;
+    lane->ladder.engine = LADDER_ENGINE_COMPILED;
+
+    for (uint32_t n = 0; ladder_ctx->custom != NULL && n < LADDER_CUSTOM_MAX; n++)
+        if (ladder_ctx->custom[n].exec != NULL && !ladder_add_instruction(lane, &ladder_ctx->custom[n]))
+            return false;
+    if (!ladder_batch_copy_io(ladder_ctx, lane) || !ladder_batch_copy_program(ladder_ctx, lane))
+        return false;
+    ladder_batch_copy_memory(ladder_ctx, lane);
+    ladder_program_changed(lane);
+    lane->ladder.state = LADDER_ST_RUNNING;
+
+    return true;
+}
+
+static void ladder_batch_unbind(ladder_batch_t *batch) {
+    if (batch->network == NULL)
+        return;
+
+    for (uint32_t n = 0; n < batch->networks_qty; n++) {
+        free(batch->network[n].ptr);
+        free(batch->network[n].prev);
+        free(batch->network[n].operands);
+    }
+    free(batch->network);
+    batch->network = NULL;
+}
+
+// Operands of every instance, taken again when a compiled program was rebuilt
+static bool ladder_batch_bind(ladder_batch_t *batch) {
+    bool same = batch->network != NULL;
+    for (uint32_t l = 0; l < batch->lanes; l++) {
+        void *compiled = ladder_compiled_get(&batch->lane[l]);
+        if (compiled == NULL)
+            return false;
+        same = same && compiled == batch->compiled[l];
+        batch->compiled[l] = compiled;
+    }
+    if (same)
+        return true;
+
+    ladder_batch_unbind(batch);
+    batch->network = calloc(batch->networks_qty, sizeof(ladder_batch_network_t));
+    if (batch->network == NULL)
+        return false;
+
+    for (uint32_t n = 0; n < batch->networks_qty; n++) {
+        const ladder_compiled_network_t *first = &((ladder_compiled_t*) batch->compiled[0])->network[n];
+        ladder_batch_network_t *bnet = &batch->network[n];
+        bnet->interpreted = first->interpreted;
+        bnet->ops = first->ops;
+        if (bnet->interpreted)
+            continue;
+
+        bnet->ptr = calloc((size_t) first->operands_qty * batch->lanes + 1, sizeof(void*));
+        bnet->prev = calloc((size_t) first->operands_qty * batch->lanes + 1, sizeof(uint8_t*));
+        bnet->operands = calloc(batch->lanes, sizeof(ladder_operand_t*));
+        if (bnet->ptr == NULL || bnet->prev == NULL || bnet->operands == NULL)
+            goto fail;
+
+        for (uint32_t l = 0; l < batch->lanes; l++) {
+            const ladder_compiled_network_t *cnet = &((ladder_compiled_t*) batch->compiled[l])->network[n];
+            if (cnet->interpreted || cnet->ops_qty != first->ops_qty || cnet->operands_qty != first->operands_qty)
+                goto fail;
+            bnet->operands[l] = cnet->operands;
+            for (uint32_t o = 0; o < cnet->operands_qty; o++) {
+                bnet->ptr[o * batch->lanes + l] = cnet->operands[o].ptr;
+                bnet->prev[o * batch->lanes + l] = cnet->operands[o].prev;
+            }
+        }
+    }
+
+    return true;
+
+    fail:
+    ladder_batch_unbind(batch);
+    return false;
+}
+
+ladder_batch_t* ladder_batch_init(ladder_ctx_t *ladder_ctx, uint32_t lanes, const ladder_batch_io_t *io) {
+    if (ladder_ctx == NULL || ladder_ctx->network == NULL || lanes < 1 || lanes > LADDER_BATCH_LANES)
+        return NULL;
+
+    ladder_batch_t *batch = calloc(1, sizeof(ladder_batch_t));
+    if (batch == NULL)
+        return NULL;
+
+    uint32_t cols = 0;
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++)
+        if (ladder_ctx->network[n].cols > cols)
+            cols = ladder_ctx->network[n].cols;
+
+    batch->networks_qty = ladder_ctx->ladder.quantity.networks;
+    batch->lane = ladder_ctx_array(lanes);
+    batch->compiled = calloc(lanes, sizeof(void*));
+    batch->power = calloc(((size_t) cols + 1) * LADDER_MAX_ROWS, sizeof(uint64_t));
+    if (io != NULL)
+        batch->io = *io;
+    if (batch->lane == NULL || batch->compiled == NULL || batch->power == NULL) {
+        ladder_batch_deinit(batch);
+        return NULL;
+    }
+
+    for (uint32_t l = 0; l < lanes; l++) {
+        batch->lanes = l + 1;
+        if (!ladder_batch_clone(ladder_ctx, &batch->lane[l])) {
+            ladder_batch_deinit(batch);
+            return NULL;
+        }
+    }
+
+    // left rail
+    for (uint32_t row = 0; row < LADDER_MAX_ROWS; row++)
+        batch->power[row] = UINT64_MAX;
+
+    if (!ladder_batch_bind(batch)) {
+        ladder_batch_deinit(batch);
+        return NULL;
+    }
+
+    return batch;
+}
+
+void ladder_batch_deinit(ladder_batch_t *batch) {
+    if (batch == NULL)
+        return;
+
+    ladder_batch_unbind(batch);
+    if (batch->lane != NULL)
+        for (uint32_t l = 0; l < batch->lanes; l++)
+            ladder_ctx_deinit(&batch->lane[l]);
+    free(batch->lane);
+    free(batch->compiled);
+    free(batch->power);
+    free(batch);
+}
+
+ladder_ctx_t* ladder_batch_lane(ladder_batch_t *batch, uint32_t lane) {
+    if (batch == NULL || lane >= batch->lanes)
+        return NULL;
+
+    return &batch->lane[lane];
+}
+
+static inline uint64_t ladder_batch_gather(void *const *ptr, uint32_t lanes) {
+    uint64_t word = 0;
+    for (uint32_t l = 0; l < lanes; l++)
+        word |= (uint64_t) (*(const uint8_t*) ptr[l] != 0) << l;
+
+    return word;
+}
+
+static inline uint64_t ladder_batch_gather_prev(uint8_t *const *prev, uint8_t prev_mask, uint32_t lanes) {
+    uint64_t word = 0;
+    for (uint32_t l = 0; l < lanes; l++)
+        word |= (uint64_t) ((*prev[l] & prev_mask) != 0) << l;
+
+    return word;
+}
+
+static inline void ladder_batch_scatter(void *const *ptr, uint64_t mask, uint64_t word, uint32_t lanes) {
+    for (uint32_t l = 0; l < lanes; l++)
+        if (mask >> l & 1)
+            *(uint8_t*) ptr[l] = (word >> l) & 1;
+}
+
+#define LADDER_BATCH_COMPARE(name, cmp)                                                                                      \
+        case LADDER_OP_##name##_BOUND: {                                                                                     \
+            uint64_t left = LADDER_BATCH_LEFT, value = 0;                                                                    \
+            for (uint32_t l = 0; l < lanes; l++) {                                                                           \
+                const ladder_operand_t *operand = &bnet->operands[l][op->operand];                                          \
+                if ((left >> l & 1) && ladder_operand_get(&operand[0]) cmp ladder_operand_get(&operand[1]))                  \
+                    value |= (uint64_t) 1 << l;                                                                              \
+            }                                                                                                                \
+            LADDER_BATCH_SET(value);                                                                                         \
+            break;                                                                                                           \
+        }
+
+#define LADDER_BATCH_ARITH(name, arith)                                                                                      \
+        case LADDER_OP_##name##_BOUND: {                                                                                     \
+            uint64_t left = LADDER_BATCH_LEFT;                                                                               \
+            LADDER_BATCH_SET(left);                                                                                          \
+            for (uint32_t l = 0; l < lanes; l++) {                                                                           \
+                if (!((left & mask) >> l & 1))                                                                               \
+                    continue;                                                                                                \
+                const ladder_operand_t *operand = &bnet->operands[l][op->operand];                                          \
+                int32_t val = ladder_operand_get(&operand[0]) arith ladder_operand_get(&operand[1]);                         \
+                ladder_operand_set(&operand[2], &val);                                                                       \
+            }                                                                                                                \
+            break;                                                                                                           \
+        }
+
+// Run the operations of a network on the instances of mask. Returns the instances that faulted.
+static uint64_t ladder_batch_exec(ladder_batch_t *batch, uint32_t network, uint64_t mask) {
+    const ladder_batch_network_t *bnet = &batch->network[network];
+    const uint32_t lanes = batch->lanes;
+    uint64_t *power = batch->power;
+    const ladder_op_t *last = NULL;
+    uint64_t fault = 0;
+
+    memset(&LADDER_BATCH_POWER(0, 0), 0, batch->lane[0].network[network].cols * LADDER_MAX_ROWS * sizeof(uint64_t));
+    for (uint32_t l = 0; l < lanes; l++)
+        if (mask >> l & 1)
+            batch->lane[l].exec_network = &batch->lane[l].network[network];
+
+    // fused operations run one by one
+    for (const ladder_op_t *op = bnet->ops; op->op != LADDER_OP_END && mask != 0; op++) {
+        switch (ladder_op_unfused(op->op)) {
+            case LADDER_OP_NO_BOUND:
+                LADDER_BATCH_SET(LADDER_BATCH_LEFT & ladder_batch_gather(&bnet->ptr[op->operand * lanes], lanes));
+                break;
+
+            case LADDER_OP_NC_BOUND:
+                LADDER_BATCH_SET(LADDER_BATCH_LEFT & ~ladder_batch_gather(&bnet->ptr[op->operand * lanes], lanes));
+                break;
+
+            case LADDER_OP_RE_BOUND: {
+                uint8_t prev_mask = bnet->operands[0][op->operand].prev_mask;
+                LADDER_BATCH_SET(LADDER_BATCH_LEFT & ladder_batch_gather(&bnet->ptr[op->operand * lanes], lanes)
+                        & ~ladder_batch_gather_prev(&bnet->prev[op->operand * lanes], prev_mask, lanes));
+                break;
+            }
+
+            case LADDER_OP_FE_BOUND: {
+                uint8_t prev_mask = bnet->operands[0][op->operand].prev_mask;
+                LADDER_BATCH_SET(LADDER_BATCH_LEFT & ~ladder_batch_gather(&bnet->ptr[op->operand * lanes], lanes)
+                        & ladder_batch_gather_prev(&bnet->prev[op->operand * lanes], prev_mask, lanes));
+                break;
+            }
+
+            case LADDER_OP_COIL_BOUND: {
+                uint64_t left = LADDER_BATCH_LEFT;
+                LADDER_BATCH_SET(left);
+                ladder_batch_scatter(&bnet->ptr[op->operand * lanes], mask, left, lanes);
+                break;
+            }
+
+            case LADDER_OP_COILL_BOUND:
+            case LADDER_OP_COILU_BOUND: {
+                uint8_t prev_mask = bnet->operands[0][op->operand].prev_mask;
+                uint64_t prev = ladder_batch_gather_prev(&bnet->prev[op->operand * lanes], prev_mask, lanes);
+                uint64_t value = op->op == LADDER_OP_COILL_BOUND ? (prev | LADDER_BATCH_LEFT) : (prev & ~LADDER_BATCH_LEFT);
+                LADDER_BATCH_SET(value);
+                ladder_batch_scatter(&bnet->ptr[op->operand * lanes], mask, value, lanes);
+                break;
+            }
+
+            LADDER_BATCH_COMPARE(EQ, ==)
+            LADDER_BATCH_COMPARE(NE, !=)
+            LADDER_BATCH_COMPARE(GT, >)
+            LADDER_BATCH_COMPARE(GE, >=)
+            LADDER_BATCH_COMPARE(LT, <)
+            LADDER_BATCH_COMPARE(LE, <=)
+            LADDER_BATCH_ARITH(ADD, +)
+            LADDER_BATCH_ARITH(MUL, *)
+
+            case LADDER_OP_WIRE:
+                LADDER_BATCH_SET(LADDER_BATCH_POWER(op->operand - 1, op->row));
+                break;
+
+            case LADDER_OP_MERGE: {
+                uint64_t any = 0;
+                for (uint32_t row = 0; row < LADDER_MAX_ROWS; row++)
+                    if (op->operand >> row & 1)
+                        any |= LADDER_BATCH_POWER(op->column, row);
+                for (uint32_t row = 0; row < LADDER_MAX_ROWS; row++)
+                    if (op->operand >> row & 1)
+                        LADDER_BATCH_POWER(op->column, row) = any;
+                break;
+            }
+
+            case LADDER_OP_RUNG_END:
+                if (op->row_end)
+                    last = op;
+                break;
+
+            case LADDER_OP_INV:
+                for (uint32_t l = 0; l < lanes; l++)
+                    if (mask >> l & 1) {
+                        LADDER_BATCH_LAST(&batch->lane[l], op);
+                        batch->lane[l].ladder.last.err = LADDER_INS_ERR_FAIL;
+                        batch->lane[l].ladder.state = LADDER_ST_INV;
+                    }
+                fault |= mask;
+                mask = 0;
+                break;
+
+            case LADDER_INS_CONN:
+                LADDER_BATCH_SET(LADDER_BATCH_LEFT);
+                last = op;
+                break;
+
+            case LADDER_INS_NEG:
+                LADDER_BATCH_SET(~LADDER_BATCH_LEFT);
+                last = op;
+                break;
+
+            default:
+                // instruction cell function on each instance: left power in the frame, own column on the cell states
+                for (uint32_t l = 0; l < lanes; l++) {
+                    if (!(mask >> l & 1))
+                        continue;
+                    ladder_ctx_t *lane = &batch->lane[l];
+                    ladder_network_t *net = &lane->network[network];
+                    ladder_cell_t **cells = net->cells;
+                    ladder_frame_t frame = { .ctx = lane, .net = net, .cell = &cells[op->row][op->column], .column = op->column, .row = op->row };
+                    frame.data = frame.cell->data;
+                    for (uint32_t row = op->row; row <= op->row_end; row++) {
+                        frame.left |= (uint32_t) (LADDER_BATCH_POWER(op->column - 1, row) >> l & 1) << (row - op->row);
+                        cells[row][op->column].state = LADDER_BATCH_POWER(op->column, row) >> l & 1;
+                    }
+                    LADDER_BATCH_LAST(lane, op);
+                    lane->ladder.last.err = op->code >= LADDER_INS_CUSTOM ? lane->custom[op->code - LADDER_INS_CUSTOM].exec(&frame)
+                            : ladder_function[op->code](&frame);
+                    for (uint32_t row = op->row; row <= op->row_end; row++)
+                        LADDER_BATCH_POWER(op->column, row) = (LADDER_BATCH_POWER(op->column, row) & ~((uint64_t) 1 << l))
+                                | ((uint64_t) cells[row][op->column].state << l);
+                    if (lane->ladder.last.err != LADDER_INS_ERR_OK) {
+                        lane->ladder.state = LADDER_ST_INV;
+                        fault |= (uint64_t) 1 << l;
+                    }
+                }
+                mask &= ~fault;
+                last = op;
+                break;
+        }
+    }
+
+    if (last != NULL)
+        for (uint32_t l = 0; l < lanes; l++)
+            if (mask >> l & 1) {
+                LADDER_BATCH_LAST(&batch->lane[l], last);
+            }
+
+    return fault;
+}
+
+// One scan of the instances of mask (ladder_scan_compiled on each of them)
+static void ladder_batch_scan(ladder_batch_t *batch, uint64_t mask) {
+    for (uint32_t l = 0; l < batch->lanes; l++)
+        if ((mask >> l & 1) && !ladder_scan_begin(&batch->lane[l]))
+            mask &= ~((uint64_t) 1 << l);
+
+    for (uint32_t n = 0; n < batch->networks_qty && mask != 0; n++) {
+        uint64_t run = 0;
+        for (uint32_t l = 0; l < batch->lanes; l++)
+            if ((mask >> l & 1) && batch->lane[l].network[n].enable)
+                run |= (uint64_t) 1 << l;
+        if (run == 0)
+            continue;
+
+        if (batch->network[n].interpreted) {
+            for (uint32_t l = 0; l < batch->lanes; l++)
+                if ((run >> l & 1) && !ladder_scan_network(&batch->lane[l], n))
+                    mask &= ~((uint64_t) 1 << l);
+        } else {
+            mask &= ~ladder_batch_exec(batch, n, run);
+        }
+    }
+}
+
+uint64_t ladder_batch_run(ladder_batch_t *batch, uint64_t ticks, uint32_t period_ms) {
+    if (batch == NULL || !ladder_batch_bind(batch))
+        return 0;
+
+    ladder_batch_t *outer = ladder_batch_current;
+    ladder_batch_current = batch;
+
+    for (uint64_t t = 0; t < ticks; t++) {
+        ladder_batch_now = batch->now;
+
+        // task cycle of every running instance, with the scan run once for all of them
+        uint64_t running = 0, scan = 0;
+        for (uint32_t l = 0; l < batch->lanes; l++) {
+            if (batch->lane[l].ladder.state != LADDER_ST_RUNNING)
+                continue;
+            running |= (uint64_t) 1 << l;
+            if (ladder_task_begin(&batch->lane[l]))
+                scan |= (uint64_t) 1 << l;
+        }
+        if (running == 0)
+            break;
+
+        ladder_batch_scan(batch, scan);
+        for (uint32_t l = 0; l < batch->lanes; l++)
+            if (scan >> l & 1)
+                ladder_task_end(&batch->lane[l], false);
+
+        batch->tick++;
+        batch->now += period_ms;
+    }
+
+    ladder_batch_current = outer;
+
+    uint64_t running = 0;
+    for (uint32_t l = 0; l < batch->lanes; l++)
+        if (batch->lane[l].ladder.state == LADDER_ST_RUNNING)
+            running |= (uint64_t) 1 << l;
+
+    return running;
+}
+
+#endif /* OPTIONAL_COMPILED */
@@ -0,0 +1,373 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "ladder.h"
+#include "ladder_bind.h"
+#include "ladder_bits.h"
+
+#ifdef OPTIONAL_COMPILED
+
+// Register index as checked by safe_get_register_index(), -1 if the access would take an error path
+static int32_t ladder_bind_index(ladder_ctx_t *ladder_ctx, ladder_register_t type, int32_t idx) {
+    uint32_t qty = 0;
+    void *bank = NULL;
+
+    switch (type) {
+        case LADDER_REGISTER_M:
+            bank = ladder_ctx->memory.M;
+            qty = ladder_ctx->ladder.quantity.m;
+            break;
+        case LADDER_REGISTER_Cd:
+            bank = ladder_ctx->memory.Cd;
+            qty = ladder_ctx->ladder.quantity.c;
+            break;
+        case LADDER_REGISTER_Cr:
+            bank = ladder_ctx->memory.Cr;
+            qty = ladder_ctx->ladder.quantity.c;
+            break;
+        case LADDER_REGISTER_C:
+            bank = ladder_ctx->registers.C;
+            qty = ladder_ctx->ladder.quantity.c;
+            break;
+        case LADDER_REGISTER_Td:
+            bank = ladder_ctx->memory.Td;
+            qty = ladder_ctx->ladder.quantity.t;
+            break;
+        case LADDER_REGISTER_Tr:
+            bank = ladder_ctx->memory.Tr;
+            qty = ladder_ctx->ladder.quantity.t;
+            break;
+        case LADDER_REGISTER_T:
+            bank = ladder_ctx->timers;
+            qty = ladder_ctx->ladder.quantity.t;
+            break;
+        case LADDER_REGISTER_D:
+            bank = ladder_ctx->registers.D;
+            qty = ladder_ctx->ladder.quantity.d;
+            break;
+        case LADDER_REGISTER_R:
+            bank = ladder_ctx->registers.R;
+            qty = ladder_ctx->ladder.quantity.r;
+            break;
+        default:
+            return -1;
+    }
+
+    if (bank == NULL || idx < 0 || (uint32_t) idx >= qty)
+        return -1;
+
+    return idx;
+}
+
+// Address of a module port (same checks as safe_check_module_port() plus the values array), NULL if not accessible
+static void* ladder_bind_port(ladder_ctx_t *ladder_ctx, ladder_register_t type, uint32_t module, uint8_t port) {
+    switch (type) {
+        case LADDER_REGISTER_I:
+            if (ladder_ctx->input == NULL || module >= ladder_ctx->hw.io.fn_read_qty || port >= ladder_ctx->input[module].i_qty
+                    || ladder_ctx->input[module].I == NULL)
+                return NULL;
+            return &ladder_ctx->input[module].I[port];
+        case LADDER_REGISTER_IW:
+            if (ladder_ctx->input == NULL || module >= ladder_ctx->hw.io.fn_read_qty || port >= ladder_ctx->input[module].iw_qty
+                    || ladder_ctx->input[module].IW == NULL)
+                return NULL;
+            return &ladder_ctx->input[module].IW[port];
+        case LADDER_REGISTER_Q:
+            if (ladder_ctx->output == NULL || module >= ladder_ctx->hw.io.fn_write_qty || port >= ladder_ctx->output[module].q_qty
+                    || ladder_ctx->output[module].Q == NULL)
+                return NULL;
+            return &ladder_ctx->output[module].Q[port];
+        case LADDER_REGISTER_QW:
+            if (ladder_ctx->output == NULL || module >= ladder_ctx->hw.io.fn_write_qty || port >= ladder_ctx->output[module].qw_qty
+                    || ladder_ctx->output[module].QW == NULL)
+                return NULL;
+            return &ladder_ctx->output[module].QW[port];
+        default:
+            return NULL;
+    }
+}
+
+bool ladder_bind_bit(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand) {
+    memset(operand, 0, sizeof(ladder_operand_t));
+    operand->kind = LADDER_OPERAND_U8;
+    operand->size = sizeof(uint8_t);
+
+    switch (value->type) {
+        case LADDER_REGISTER_M: {
+            int32_t idx = ladder_bind_index(ladder_ctx, value->type, value->value.i32);
+            if (idx < 0 || LADDER_HISTORY(ladder_ctx, M) == NULL)
+                return false;
+            operand->ptr = &ladder_ctx->memory.M[idx];
+            operand->prev = ladder_history_byte(LADDER_HISTORY(ladder_ctx, M), idx, &operand->prev_mask);
+            return true;
+        }
+        case LADDER_REGISTER_I:
+            operand->ptr = ladder_bind_port(ladder_ctx, value->type, value->value.mp.module, value->value.mp.port);
+            if (operand->ptr == NULL || ladder_ctx->input[value->value.mp.module].Ih == NULL)
+                return false;
+            operand->prev = &ladder_ctx->input[value->value.mp.module].Ih[value->value.mp.port];
+            operand->prev_mask = 0xff;
+            return true;
+        case LADDER_REGISTER_Q:
+            operand->ptr = ladder_bind_port(ladder_ctx, value->type, value->value.mp.module, value->value.mp.port);
+            if (operand->ptr == NULL || ladder_ctx->output[value->value.mp.module].Qh == NULL)
+                return false;
+            operand->prev = &ladder_ctx->output[value->value.mp.module].Qh[value->value.mp.port];
+            operand->prev_mask = 0xff;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ladder_bind_read(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand) {
+    memset(operand, 0, sizeof(ladder_operand_t));
+    operand->kind = LADDER_OPERAND_CONST;
+
+    switch (value->type) {
+        case LADDER_REGISTER_NONE:
+            operand->value = value->value.i32;
+            return true;
+        case LADDER_REGISTER_M:
+        case LADDER_REGISTER_Cd:
+        case LADDER_REGISTER_Cr:
+        case LADDER_REGISTER_Td:
+        case LADDER_REGISTER_Tr:
+        case LADDER_REGISTER_C:
+        case LADDER_REGISTER_T:
+        case LADDER_REGISTER_D:
+        case LADDER_REGISTER_R: {
+            // invalid indexes report errors (and may panic) on every read: keep them on the generic path
+            int32_t idx = ladder_bind_index(ladder_ctx, value->type, value->value.i32);
+            if (idx < 0)
+                return false;
+            switch (value->type) {
+                case LADDER_REGISTER_M:
+                    operand->kind = LADDER_OPERAND_U8;
+                    operand->ptr = &ladder_ctx->memory.M[idx];
+                    break;
+                case LADDER_REGISTER_Cd:
+                    operand->kind = LADDER_OPERAND_BOOL;
+                    operand->ptr = &ladder_ctx->memory.Cd[idx];
+                    break;
+                case LADDER_REGISTER_Cr:
+                    operand->kind = LADDER_OPERAND_BOOL;
+                    operand->ptr = &ladder_ctx->memory.Cr[idx];
+                    break;
+                case LADDER_REGISTER_Td:
+                    operand->kind = LADDER_OPERAND_BOOL;
+                    operand->ptr = &ladder_ctx->memory.Td[idx];
+                    break;
+                case LADDER_REGISTER_Tr:
+                    operand->kind = LADDER_OPERAND_BOOL;
+                    operand->ptr = &ladder_ctx->memory.Tr[idx];
+                    break;
+                case LADDER_REGISTER_C:
+                    operand->kind = LADDER_OPERAND_U32;
+                    operand->ptr = &ladder_ctx->registers.C[idx];
+                    break;
+                case LADDER_REGISTER_T:
+                    operand->kind = LADDER_OPERAND_TIMER;
+                    operand->ptr = &ladder_ctx->timers[idx].acc;
+                    break;
+                case LADDER_REGISTER_D:
+                    operand->kind = LADDER_OPERAND_I32;
+                    operand->ptr = &ladder_ctx->registers.D[idx];
+                    break;
+                default:
+                    operand->kind = LADDER_OPERAND_REAL;
+                    operand->ptr = &ladder_ctx->registers.R[idx];
+                    break;
+            }
+            return true;
+        }
+        case LADDER_REGISTER_I:
+        case LADDER_REGISTER_IW:
+        case LADDER_REGISTER_Q:
+        case LADDER_REGISTER_QW: {
+            bool input = (value->type == LADDER_REGISTER_I || value->type == LADDER_REGISTER_IW);
+            // modules not installed read as 0
+            if (value->value.mp.module >= (input ? ladder_ctx->hw.io.fn_read_qty : ladder_ctx->hw.io.fn_write_qty))
+                return true;
+            operand->ptr = ladder_bind_port(ladder_ctx, value->type, value->value.mp.module, value->value.mp.port);
+            if (operand->ptr == NULL)
+                return false;
+            operand->kind = (value->type == LADDER_REGISTER_I || value->type == LADDER_REGISTER_Q) ? LADDER_OPERAND_U8 : LADDER_OPERAND_I32;
+            return true;
+        }
+        default:
+            // strings and invalid registers read as 0
+            return true;
+    }
+}
+
+void ladder_bind_write(ladder_ctx_t *ladder_ctx, const ladder_value_t *value, ladder_operand_t *operand) {
+    memset(operand, 0, sizeof(ladder_operand_t));
+
+    switch (value->type) {
+        case LADDER_REGISTER_M:
+        case LADDER_REGISTER_Cd:
+        case LADDER_REGISTER_Cr:
+        case LADDER_REGISTER_Td:
+        case LADDER_REGISTER_Tr:
+        case LADDER_REGISTER_C:
+        case LADDER_REGISTER_D:
+        case LADDER_REGISTER_R:
+            if (ladder_bind_read(ladder_ctx, value, operand))
+                operand->size = (value->type == LADDER_REGISTER_C || value->type == LADDER_REGISTER_D || value->type == LADDER_REGISTER_R) ?
+                        sizeof(int32_t) : sizeof(uint8_t);
+            break;
+        case LADDER_REGISTER_I:
+        case LADDER_REGISTER_IW:
+        case LADDER_REGISTER_Q:
+        case LADDER_REGISTER_QW:
+            operand->ptr = ladder_bind_port(ladder_ctx, value->type, value->value.mp.module, value->value.mp.port);
+            operand->kind = (value->type == LADDER_REGISTER_I || value->type == LADDER_REGISTER_Q) ? LADDER_OPERAND_U8 : LADDER_OPERAND_I32;
+            operand->size = (operand->kind == LADDER_OPERAND_U8) ? sizeof(uint8_t) : sizeof(int32_t);
+            break;
+        default:
+            break;
+    }
+
+    // ladder_set_data_value() fails without writing: the instruction ignores the error
+    if (operand->ptr == NULL) {
+        operand->kind = LADDER_OPERAND_NONE;
+        operand->size = 0;
+    }
+}
+
+// Banks and quantities bound operands depend on
+static void ladder_bind_banks(ladder_ctx_t *ladder_ctx, uint32_t quantity[5], void *bank[16]) {
+    quantity[0] = ladder_ctx->ladder.quantity.m;
+    quantity[1] = ladder_ctx->ladder.quantity.c;
+    quantity[2] = ladder_ctx->ladder.quantity.t;
+    quantity[3] = ladder_ctx->ladder.quantity.d;
+    quantity[4] = ladder_ctx->ladder.quantity.r;
+
+    bank[0] = ladder_ctx->memory.M;
+    bank[1] = ladder_ctx->memory.Cr;
+    bank[2] = ladder_ctx->memory.Cd;
+    bank[3] = ladder_ctx->memory.Tr;
+    bank[4] = ladder_ctx->memory.Td;
+    bank[5] = LADDER_HISTORY(ladder_ctx, M);
+    bank[6] = LADDER_HISTORY(ladder_ctx, Cr);
+    bank[7] = LADDER_HISTORY(ladder_ctx, Cd);
+    bank[8] = LADDER_HISTORY(ladder_ctx, Tr);
+    bank[9] = LADDER_HISTORY(ladder_ctx, Td);
+    bank[10] = ladder_ctx->registers.C;
+    bank[11] = ladder_ctx->registers.D;
+    bank[12] = ladder_ctx->registers.R;
+    bank[13] = ladder_ctx->timers;
+    bank[14] = ladder_ctx->input;
+    bank[15] = ladder_ctx->output;
+}
+
+// Values arrays and quantities of one module (modules are allocated by the io init functions)
+static void ladder_bind_module(ladder_ctx_t *ladder_ctx, bool input, uint32_t module, uintptr_t entry[LADDER_BIND_MODULE_ENTRIES]) {
+    if (input) {
+        entry[0] = (uintptr_t) ladder_ctx->input[module].I;
+        entry[1] = (uintptr_t) ladder_ctx->input[module].IW;
+        entry[2] = (uintptr_t) ladder_ctx->input[module].Ih;
+        entry[3] = ladder_ctx->input[module].i_qty;
+        entry[4] = ladder_ctx->input[module].iw_qty;
+    } else {
+        entry[0] = (uintptr_t) ladder_ctx->output[module].Q;
+        entry[1] = (uintptr_t) ladder_ctx->output[module].QW;
+        entry[2] = (uintptr_t) ladder_ctx->output[module].Qh;
+        entry[3] = ladder_ctx->output[module].q_qty;
+        entry[4] = ladder_ctx->output[module].qw_qty;
+    }
+}
+
+bool ladder_bind_key(ladder_ctx_t *ladder_ctx, ladder_bind_key_t *key) {
+    memset(key, 0, sizeof(ladder_bind_key_t));
+    ladder_bind_banks(ladder_ctx, key->quantity, key->bank);
+
+    key->read_qty = ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0;
+    key->write_qty = ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0;
+    if (key->read_qty + key->write_qty == 0)
+        return true;
+
+    key->io = malloc((key->read_qty + key->write_qty) * LADDER_BIND_MODULE_ENTRIES * sizeof(uintptr_t));
+    if (key->io == NULL)
+        return false;
+
+    uintptr_t *entry = key->io;
+    for (uint32_t module = 0; module < key->read_qty; module++, entry += LADDER_BIND_MODULE_ENTRIES)
+        ladder_bind_module(ladder_ctx, true, module, entry);
+    for (uint32_t module = 0; module < key->write_qty; module++, entry += LADDER_BIND_MODULE_ENTRIES)
+        ladder_bind_module(ladder_ctx, false, module, entry);
+
+    return true;
+}
+
+bool ladder_bind_key_valid(ladder_ctx_t *ladder_ctx, const ladder_bind_key_t *key) {
+    uint32_t quantity[5];
+    void *bank[16];
+    uintptr_t now[LADDER_BIND_MODULE_ENTRIES];
+
+    ladder_bind_banks(ladder_ctx, quantity, bank);
+    if (memcmp(quantity, key->quantity, sizeof(quantity)) != 0 || memcmp(bank, key->bank, sizeof(bank)) != 0)
+        return false;
+
+    if (key->read_qty != (ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0)
+            || key->write_qty != (ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0))
+        return false;
+
+    const uintptr_t *entry = key->io;
+    for (uint32_t module = 0; module < key->read_qty; module++, entry += LADDER_BIND_MODULE_ENTRIES) {
+        ladder_bind_module(ladder_ctx, true, module, now);
+        if (memcmp(now, entry, sizeof(now)) != 0)
+            return false;
+    }
+    for (uint32_t module = 0; module < key->write_qty; module++, entry += LADDER_BIND_MODULE_ENTRIES) {
+        ladder_bind_module(ladder_ctx, false, module, now);
+        if (memcmp(now, entry, sizeof(now)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+void ladder_bind_key_free(ladder_bind_key_t *key) {
+    free(key->io);
+    key->io = NULL;
+    key->read_qty = 0;
+    key->write_qty = 0;
+}
+
+#endif /* OPTIONAL_COMPILED */
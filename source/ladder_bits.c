@@ -0,0 +1,183 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "ladder.h"
+#include "ladder_bits.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LADDER_BITS_SWAR 1
+#endif
+
+// x86 builds without AVX2 select the AVX2 word loops at run time
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__AVX2__)
+#define LADDER_BITS_AVX2 1
+#include <immintrin.h>
+#endif
+
+// 64 flags to one word (vector compare against zero and byte mask extraction where available)
+static inline uint64_t ladder_bits_pack64(const uint8_t *src) {
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t lo = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) src), zero));
+    uint32_t hi = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (src + 32)), zero));
+    return ~(((uint64_t) hi << 32) | lo);
+#elif defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    uint64_t zeros0 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) src), zero));
+    uint64_t zeros1 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (src + 16)), zero));
+    uint64_t zeros2 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (src + 32)), zero));
+    uint64_t zeros3 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*) (src + 48)), zero));
+    return ~(zeros0 | (zeros1 << 16) | (zeros2 << 32) | (zeros3 << 48));
+#elif defined(LADDER_BITS_SWAR)
+    uint64_t word = 0;
+    for (uint32_t n = 0; n < 8; n++) {
+        uint64_t bytes;
+        memcpy(&bytes, src + 8 * n, sizeof(uint64_t));
+        // bit 7 of each non zero byte, moved to bit 0 and gathered in the top byte
+        bytes = ((((bytes & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | bytes) & 0x8080808080808080ULL) >> 7;
+        word |= ((bytes * 0x0102040810204080ULL) >> 56) << (8 * n);
+    }
+    return word;
+#else
+    uint64_t word = 0;
+    for (uint32_t n = 0; n < 64; n++)
+        if (src[n])
+            word |= (uint64_t) 1 << n;
+    return word;
+#endif
+}
+
+static inline uint64_t ladder_bits_pack_tail(const uint8_t *src, uint32_t qty) {
+    uint64_t word = 0;
+    for (uint32_t n = 0; n < qty; n++)
+        if (src[n])
+            word |= (uint64_t) 1 << n;
+    return word;
+}
+
+// Whole words: snapshot and edges
+#define LADDER_BITS_WORDS(suffix, pack64, attribute)                                                                                                     \
+    attribute static void ladder_bits_pack_words##suffix(uint64_t *dst, const uint8_t *src, uint32_t words) {                                            \
+        for (uint32_t w = 0; w < words; w++)                                                                                                             \
+            dst[w] = pack64(src + ((size_t) w << 6));                                                                                                    \
+    }                                                                                                                                                    \
+                                                                                                                                                         \
+    attribute static void ladder_bits_edges_words##suffix(const uint8_t *src, const uint64_t *prev, uint64_t *rising, uint64_t *falling, uint32_t words) { \
+        for (uint32_t w = 0; w < words; w++) {                                                                                                           \
+            uint64_t word = pack64(src + ((size_t) w << 6));                                                                                             \
+            if (rising != NULL)                                                                                                                          \
+                rising[w] = word & ~prev[w];                                                                                                             \
+            if (falling != NULL)                                                                                                                         \
+                falling[w] = ~word & prev[w];                                                                                                            \
+        }                                                                                                                                                \
+    }
+
+LADDER_BITS_WORDS(, ladder_bits_pack64, )
+
+#ifdef LADDER_BITS_AVX2
+__attribute__((target("avx2"))) static inline uint64_t ladder_bits_pack64_avx2(const uint8_t *src) {
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t lo = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) src), zero));
+    uint32_t hi = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*) (src + 32)), zero));
+    return ~(((uint64_t) hi << 32) | lo);
+}
+
+LADDER_BITS_WORDS(_avx2, ladder_bits_pack64_avx2, __attribute__((target("avx2"))))
+#endif
+
+void ladder_bits_pack(uint64_t *dst, const uint8_t *src, uint32_t qty) {
+    uint32_t words = qty >> 6;
+
+#ifdef LADDER_BITS_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        ladder_bits_pack_words_avx2(dst, src, words);
+    else
+#endif
+        ladder_bits_pack_words(dst, src, words);
+
+    if (qty & 63)
+        dst[words] = ladder_bits_pack_tail(src + ((size_t) words << 6), qty & 63);
+}
+
+void ladder_bits_unpack(uint8_t *dst, const uint64_t *src, uint32_t qty) {
+    uint32_t n = 0;
+
+#ifdef LADDER_BITS_SWAR
+    for (; n + 8 <= qty; n += 8) {
+        // flag k of the byte to byte k: isolate it, carry it to bit 7 and move it to bit 0
+        uint64_t bits = (src[n >> 6] >> (n & 63)) & 0xff;
+        uint64_t bytes = ((((bits * 0x0101010101010101ULL) & 0x8040201008040201ULL) + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+        memcpy(dst + n, &bytes, sizeof(uint64_t));
+    }
+#endif
+
+    for (; n < qty; n++)
+        dst[n] = (src[n >> 6] >> (n & 63)) & 1;
+}
+
+void ladder_bits_edges(const uint8_t *src, const uint64_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty) {
+    uint32_t words = qty >> 6;
+
+#ifdef LADDER_BITS_AVX2
+    if (__builtin_cpu_supports("avx2"))
+        ladder_bits_edges_words_avx2(src, prev, rising, falling, words);
+    else
+#endif
+        ladder_bits_edges_words(src, prev, rising, falling, words);
+
+    if (qty & 63) {
+        uint64_t word = ladder_bits_pack_tail(src + ((size_t) words << 6), qty & 63);
+        if (rising != NULL)
+            rising[words] = word & ~prev[words];
+        if (falling != NULL)
+            falling[words] = ~word & prev[words];
+    }
+}
+
+void ladder_bits_edges_bytes(const uint8_t *src, const uint8_t *prev, uint64_t *rising, uint64_t *falling, uint32_t qty) {
+    // previous values packed one word at a time
+    for (uint32_t n = 0; n < qty; n += 64) {
+        uint32_t flags = qty - n < 64 ? qty - n : 64;
+        uint64_t prev_word;
+        ladder_bits_pack(&prev_word, prev + n, flags);
+        ladder_bits_edges(src + n, &prev_word, rising != NULL ? rising + (n >> 6) : NULL, falling != NULL ? falling + (n >> 6) : NULL, flags);
+    }
+}
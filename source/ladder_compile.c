@@ -0,0 +1,371 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_incremental.h"
+#include "ladder_parallel.h"
+#include "ladder_jit.h"
+#include "ladder_topology.h"
+
+#ifdef OPTIONAL_COMPILED
+
+static bool ladder_emit(ladder_compiled_network_t *cnet, uint32_t *size, ladder_opcode_t op, ladder_instruction_t code, uint32_t row, uint32_t row_end,
+        uint32_t column) {
+    if (cnet->ops_qty == *size) {
+        uint32_t new_size = *size == 0 ? 64 : *size * 2;
+        ladder_op_t *tmp = realloc(cnet->ops, new_size * sizeof(ladder_op_t));
+        if (tmp == NULL)
+            return false;
+        cnet->ops = tmp;
+        *size = new_size;
+    }
+
+    ladder_op_t *o = &cnet->ops[cnet->ops_qty++];
+    o->op = op;
+    o->code = code;
+    o->row = row;
+    o->row_end = row_end;
+    o->column = column;
+    o->operand = 0;
+    o->fn = (op < LADDER_OP_MERGE) ? ladder_function[op] : NULL;
+
+    return true;
+}
+
+static ladder_operand_t* ladder_operands_reserve(ladder_compiled_network_t *cnet, uint32_t *size, uint32_t qty) {
+    if (cnet->operands_qty + qty > *size) {
+        uint32_t new_size = *size == 0 ? 16 : *size * 2;
+        ladder_operand_t *tmp = realloc(cnet->operands, new_size * sizeof(ladder_operand_t));
+        if (tmp == NULL)
+            return NULL;
+        cnet->operands = tmp;
+        *size = new_size;
+    }
+
+    return &cnet->operands[cnet->operands_qty];
+}
+
+// Replace the last emitted instruction with its bound form when every operand resolves to a register address or a constant.
+// Operands that would take an error path (and report it in ladder.last) keep the generic instruction.
+static bool ladder_compile_bind(ladder_ctx_t *ladder_ctx, const ladder_cell_t *cell, ladder_compiled_network_t *cnet, uint32_t *size) {
+    ladder_op_t *o = &cnet->ops[cnet->ops_qty - 1];
+    ladder_opcode_t bound;
+    uint32_t reads = 0;
+    bool write = false;
+
+    switch (o->op) {
+        case LADDER_INS_NO:
+            bound = LADDER_OP_NO_BOUND;
+            break;
+        case LADDER_INS_NC:
+            bound = LADDER_OP_NC_BOUND;
+            break;
+        case LADDER_INS_RE:
+            bound = LADDER_OP_RE_BOUND;
+            break;
+        case LADDER_INS_FE:
+            bound = LADDER_OP_FE_BOUND;
+            break;
+        case LADDER_INS_COIL:
+            bound = LADDER_OP_COIL_BOUND;
+            break;
+        case LADDER_INS_COILL:
+            bound = LADDER_OP_COILL_BOUND;
+            break;
+        case LADDER_INS_COILU:
+            bound = LADDER_OP_COILU_BOUND;
+            break;
+        case LADDER_INS_EQ:
+            bound = LADDER_OP_EQ_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_NE:
+            bound = LADDER_OP_NE_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_GT:
+            bound = LADDER_OP_GT_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_GE:
+            bound = LADDER_OP_GE_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_LT:
+            bound = LADDER_OP_LT_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_LE:
+            bound = LADDER_OP_LE_BOUND;
+            reads = 2;
+            break;
+        case LADDER_INS_ADD:
+            bound = LADDER_OP_ADD_BOUND;
+            reads = 2;
+            write = true;
+            break;
+        case LADDER_INS_MUL:
+            bound = LADDER_OP_MUL_BOUND;
+            reads = 2;
+            write = true;
+            break;
+        default:
+            return true;
+    }
+
+    uint32_t qty = (reads == 0) ? 1 : reads + (write ? 1 : 0);
+    if (cell->data == NULL || cell->data_qty < qty)
+        return true;
+
+    ladder_operand_t *operand = ladder_operands_reserve(cnet, size, qty);
+    if (operand == NULL)
+        return false;
+
+    if (reads == 0) {
+        if (!ladder_bind_bit(ladder_ctx, &cell->data[0], operand))
+            return true;
+    } else {
+        for (uint32_t n = 0; n < reads; n++)
+            if (!ladder_bind_read(ladder_ctx, &cell->data[n], &operand[n]))
+                return true;
+        if (write)
+            ladder_bind_write(ladder_ctx, &cell->data[reads], &operand[reads]);
+    }
+
+    o->op = bound;
+    o->operand = cnet->operands_qty;
+    cnet->operands_qty += qty;
+
+    return true;
+}
+
+// Custom instructions run through their function, on bound operands when every operand has a read or write role and resolves without
+// the error paths of ladder_get_data_value() and ladder_set_data_value()
+static bool ladder_compile_custom(ladder_ctx_t *ladder_ctx, const ladder_custom_t *custom, const ladder_cell_t *cell, ladder_compiled_network_t *cnet,
+        uint32_t *size) {
+    ladder_op_t *o = &cnet->ops[cnet->ops_qty - 1];
+    uint32_t qty = custom->description.data_qty;
+
+    o->fn = custom->exec;
+    if (qty == 0 || cell->data == NULL || cell->data_qty != qty)
+        return true;
+    for (uint32_t n = 0; n < qty; n++)
+        if (custom->signature[n] == LADDER_SIG_ANY)
+            return true;
+
+    ladder_operand_t *operand = ladder_operands_reserve(cnet, size, qty);
+    if (operand == NULL)
+        return false;
+
+    for (uint32_t n = 0; n < qty; n++) {
+        if (custom->signature[n] == LADDER_SIG_READ) {
+            if (!ladder_bind_read(ladder_ctx, &cell->data[n], &operand[n]))
+                return true;
+        } else {
+            ladder_bind_write(ladder_ctx, &cell->data[n], &operand[n]);
+            if (operand[n].ptr == NULL)
+                return true;
+        }
+    }
+
+    o->op = LADDER_OP_CUSTOM_BOUND;
+    o->operand = cnet->operands_qty;
+    cnet->operands_qty += qty;
+
+    return true;
+}
+
+// Lower one network to bytecode following the topology walked by ladder_scan_network(). NOP cells are not emitted; the rung end restores
+// the last visited cell so ladder.last matches.
+static bool ladder_compile_network(ladder_ctx_t *ladder_ctx, ladder_network_t *net, const ladder_topology_network_t *tnet,
+        ladder_compiled_network_t *cnet) {
+    uint32_t size = 0, operands_size = 0;
+
+    uint32_t clear_qty = tnet->clear_start[tnet->rows];
+    cnet->clear = malloc((clear_qty > 0 ? clear_qty : 1) * sizeof(uint16_t));
+    if (cnet->clear == NULL)
+        return false;
+    memcpy(cnet->clear, tnet->clear, clear_qty * sizeof(uint16_t));
+    memcpy(cnet->clear_start, tnet->clear_start, sizeof(cnet->clear_start));
+    cnet->power = calloc(net->cols + 1, sizeof(uint32_t));
+    if (cnet->power == NULL)
+        return false;
+    cnet->power[0] = UINT32_MAX;
+
+    for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+        const ladder_topology_rung_t *rung = &tnet->rung[r];
+
+        // lower branches start without power: columns without side effects are never executed, columns of NOP cells do nothing
+        for (uint32_t l = 0; l < rung->live_qty; l++) {
+            uint32_t column = rung->live[l];
+            const ladder_topology_column_t *tc = &rung->column[column];
+
+            for (uint32_t gr = rung->row_start; gr <= tc->group_end; gr++) {
+                ladder_instruction_t code = net->cells[gr][column].code;
+                const ladder_custom_t *custom = code < LADDER_INS_INV ? NULL : ladder_custom_get(ladder_ctx, code);
+                if (code >= LADDER_INS_INV && code != LADDER_INS_MULTI && custom == NULL) {
+                    // the interpreter stops here, nothing after this point is reachable
+                    if (!ladder_emit(cnet, &size, LADDER_OP_INV, code, gr, gr, column))
+                        return false;
+                    goto end;
+                }
+                if (code != LADDER_INS_MULTI && code != LADDER_INS_NOP) {
+                    // generic instructions see the cell states of their rows
+                    uint32_t last = gr;
+                    while (last + 1 < net->rows && net->cells[last + 1][column].code == LADDER_INS_MULTI)
+                        last++;
+                    if (custom != NULL) {
+                        if (!ladder_emit(cnet, &size, LADDER_OP_CUSTOM, code, gr, last, column)
+                                || !ladder_compile_custom(ladder_ctx, custom, &net->cells[gr][column], cnet, &operands_size))
+                            return false;
+                    } else if (!ladder_emit(cnet, &size, (ladder_opcode_t) code, code, gr, last, column)
+                            || !ladder_compile_bind(ladder_ctx, &net->cells[gr][column], cnet, &operands_size)) {
+                        return false;
+                    }
+                }
+            }
+
+            if (tc->group_end > rung->row_start) {
+                if (!ladder_emit(cnet, &size, LADDER_OP_MERGE, 0, rung->row_start, tc->group_end, column))
+                    return false;
+                cnet->ops[cnet->ops_qty - 1].operand = (uint32_t) (((uint64_t) 1 << (tc->group_end + 1)) - ((uint64_t) 1 << rung->row_start));
+            }
+        }
+
+        bool visited = rung->live_end > 0;
+        if (!ladder_emit(cnet, &size, LADDER_OP_RUNG_END, visited ? net->cells[rung->last_row][rung->last_column].code : LADDER_INS_NOP,
+                visited ? rung->last_row : 0, visited ? 1 : 0, visited ? rung->last_column : 0))
+            return false;
+    }
+
+    end:
+    cnet->cycles = tnet->cycles;
+    cnet->interpreted = (tnet->cycles > (ladder_ctx->scan_internals.max_scan_cycles * 0.8));
+
+    return ladder_emit(cnet, &size, LADDER_OP_END, 0, 0, 0, 0);
+}
+
+bool ladder_compile(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->network == NULL)
+        return false;
+
+    ladder_compiled_free(ladder_ctx);
+
+    ladder_compiled_t *compiled = calloc(1, sizeof(ladder_compiled_t));
+    if (compiled == NULL)
+        return false;
+
+    compiled->network = calloc(ladder_ctx->ladder.quantity.networks, sizeof(ladder_compiled_network_t));
+    if (compiled->network == NULL) {
+        free(compiled);
+        return false;
+    }
+    compiled->networks_qty = ladder_ctx->ladder.quantity.networks;
+    compiled->max_scan_cycles = ladder_ctx->scan_internals.max_scan_cycles;
+    ladder_ctx->compiled = compiled;
+
+    if (!ladder_bind_key(ladder_ctx, &compiled->key)) {
+        ladder_compiled_free(ladder_ctx);
+        return false;
+    }
+
+    for (uint32_t n = 0; n < compiled->networks_qty; n++) {
+        if (ladder_ctx->network[n].cells == NULL) {
+            compiled->network[n].interpreted = true;
+            continue;
+        }
+        const ladder_topology_network_t *tnet = ladder_topology_get(ladder_ctx, n);
+        if (tnet == NULL || !ladder_compile_network(ladder_ctx, &ladder_ctx->network[n], tnet, &compiled->network[n])
+                || (ladder_ctx->ladder.optimize && !ladder_optimize_network(ladder_ctx, n, &compiled->network[n], &compiled->optimized))
+                || !ladder_slice_network(tnet, &compiled->network[n])) {
+            ladder_compiled_free(ladder_ctx);
+            return false;
+        }
+        if (ladder_ctx->ladder.optimize)
+            ladder_optimize_fuse(&compiled->network[n], &compiled->optimized);
+    }
+
+    return true;
+}
+
+ladder_compiled_t* ladder_compiled_get(ladder_ctx_t *ladder_ctx) {
+    ladder_compiled_t *compiled = (ladder_compiled_t*) ladder_ctx->compiled;
+    if (compiled != NULL
+            && (compiled->networks_qty != ladder_ctx->ladder.quantity.networks || compiled->max_scan_cycles != ladder_ctx->scan_internals.max_scan_cycles
+                    || !ladder_bind_key_valid(ladder_ctx, &compiled->key))) {
+        // bound operands point into banks or I/O modules that were reallocated: rebind
+        ladder_compiled_free(ladder_ctx);
+        compiled = NULL;
+    }
+
+    if (compiled == NULL && ladder_compile(ladder_ctx))
+        compiled = (ladder_compiled_t*) ladder_ctx->compiled;
+
+    return compiled;
+}
+
+void ladder_compiled_free(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->compiled == NULL)
+        return;
+
+    ladder_compiled_t *compiled = (ladder_compiled_t*) ladder_ctx->compiled;
+    if (compiled->network != NULL) {
+        for (uint32_t n = 0; n < compiled->networks_qty; n++) {
+            free(compiled->network[n].ops);
+            free(compiled->network[n].operands);
+            free(compiled->network[n].clear);
+            free(compiled->network[n].power);
+            ladder_slice_free(&compiled->network[n]);
+        }
+        free(compiled->network);
+    }
+    ladder_bind_key_free(&compiled->key);
+    ladder_incremental_free((ladder_incremental_t*) compiled->incremental);
+#ifdef OPTIONAL_PARALLEL
+    ladder_parallel_free((ladder_parallel_t*) compiled->parallel);
+#endif
+#ifdef OPTIONAL_JIT
+    ladder_jit_free((ladder_jit_t*) compiled->jit);
+#endif
+    free(compiled);
+    ladder_ctx->compiled = NULL;
+}
+
+#endif /* OPTIONAL_COMPILED */
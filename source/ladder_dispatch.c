@@ -0,0 +1,606 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_fn_commons.h"
+#include "ladder_instructions.h"
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+
+#ifdef OPTIONAL_COMPILED
+
+// Built-in instruction bodies are compiled again in this unit as private functions so the dispatch loop can inline the short ones.
+// FOREIGN and custom instructions are the only ones still called through a function pointer.
+#define fn_NOP   ladder_inline_NOP
+#define fn_CONN  ladder_inline_CONN
+#define fn_NEG   ladder_inline_NEG
+#define fn_NO    ladder_inline_NO
+#define fn_NC    ladder_inline_NC
+#define fn_RE    ladder_inline_RE
+#define fn_FE    ladder_inline_FE
+#define fn_COIL  ladder_inline_COIL
+#define fn_COILL ladder_inline_COILL
+#define fn_COILU ladder_inline_COILU
+#define fn_TON   ladder_inline_TON
+#define fn_TOF   ladder_inline_TOF
+#define fn_TP    ladder_inline_TP
+#define fn_CTU   ladder_inline_CTU
+#define fn_CTD   ladder_inline_CTD
+#define fn_MOVE  ladder_inline_MOVE
+#define fn_SUB   ladder_inline_SUB
+#define fn_ADD   ladder_inline_ADD
+#define fn_MUL   ladder_inline_MUL
+#define fn_DIV   ladder_inline_DIV
+#define fn_MOD   ladder_inline_MOD
+#define fn_SHL   ladder_inline_SHL
+#define fn_SHR   ladder_inline_SHR
+#define fn_ROL   ladder_inline_ROL
+#define fn_ROR   ladder_inline_ROR
+#define fn_AND   ladder_inline_AND
+#define fn_OR    ladder_inline_OR
+#define fn_XOR   ladder_inline_XOR
+#define fn_NOT   ladder_inline_NOT
+#define fn_EQ    ladder_inline_EQ
+#define fn_GT    ladder_inline_GT
+#define fn_GE    ladder_inline_GE
+#define fn_LT    ladder_inline_LT
+#define fn_LE    ladder_inline_LE
+#define fn_NE    ladder_inline_NE
+#define fn_TMOVE ladder_inline_TMOVE
+
+static inline ladder_ins_err_t ladder_inline_NOP(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_CONN(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_NEG(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_NO(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_NC(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_RE(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_FE(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_COIL(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_COILL(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_COILU(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_TON(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_TOF(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_TP(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_CTU(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_CTD(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_MOVE(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_SUB(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_ADD(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_MUL(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_DIV(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_MOD(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_SHL(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_SHR(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_ROL(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_ROR(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_AND(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_OR(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_XOR(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_NOT(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_EQ(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_GT(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_GE(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_LT(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_LE(const ladder_frame_t *frame);
+static inline ladder_ins_err_t ladder_inline_NE(const ladder_frame_t *frame);
+static ladder_ins_err_t ladder_inline_TMOVE(const ladder_frame_t *frame);
+
+#include "instructions/fn_NOP.c"
+#include "instructions/fn_CONN.c"
+#include "instructions/fn_NEG.c"
+#include "instructions/fn_NO.c"
+#include "instructions/fn_NC.c"
+#include "instructions/fn_RE.c"
+#include "instructions/fn_FE.c"
+#include "instructions/fn_COIL.c"
+#include "instructions/fn_COILL.c"
+#include "instructions/fn_COILU.c"
+#include "instructions/fn_TON.c"
+#include "instructions/fn_TOF.c"
+#include "instructions/fn_TP.c"
+#include "instructions/fn_CTU.c"
+#include "instructions/fn_CTD.c"
+#include "instructions/fn_MOVE.c"
+#include "instructions/fn_SUB.c"
+#include "instructions/fn_ADD.c"
+#include "instructions/fn_MUL.c"
+#include "instructions/fn_DIV.c"
+#include "instructions/fn_MOD.c"
+#include "instructions/fn_SHL.c"
+#include "instructions/fn_SHR.c"
+#include "instructions/fn_ROL.c"
+#include "instructions/fn_ROR.c"
+#include "instructions/fn_AND.c"
+#include "instructions/fn_OR.c"
+#include "instructions/fn_XOR.c"
+#include "instructions/fn_NOT.c"
+#include "instructions/fn_EQ.c"
+#include "instructions/fn_GT.c"
+#include "instructions/fn_GE.c"
+#include "instructions/fn_LT.c"
+#include "instructions/fn_LE.c"
+#include "instructions/fn_NE.c"
+#include "instructions/fn_TMOVE.c"
+
+// Computed goto dispatch on GCC/Clang (define LADDER_DISPATCH_SWITCH to force the portable switch)
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(LADDER_DISPATCH_SWITCH)
+#define LADDER_DISPATCH_GOTO
+#endif
+
+#ifdef LADDER_DISPATCH_GOTO
+#define LADDER_DISPATCH_INS(name) ins_##name:
+#define LADDER_DISPATCH_OP(name)  op_##name:
+#define LADDER_DISPATCH_NEXT()    goto *dispatch[(++op)->op]
+#else
+#define LADDER_DISPATCH_INS(name) case LADDER_INS_##name:
+#define LADDER_DISPATCH_OP(name)  case LADDER_OP_##name:
+#define LADDER_DISPATCH_NEXT()    continue
+#endif
+
+#define LADDER_DISPATCH_LAST()                                  \
+            ladder_ctx->ladder.last.instr = op->code;           \
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_OK;    \
+            ladder_ctx->ladder.last.network = network;          \
+            ladder_ctx->ladder.last.cell_row = op->row;         \
+            ladder_ctx->ladder.last.cell_column = op->column
+
+// Power flow of a column is a row mask (LADDER_MAX_ROWS is 32): contacts read and write one bit, a vertical group merges with a few bit
+// operations. Cell states are the view kept for instructions run through their cell functions, hooks and printing. The mask before column 0 is
+// the left rail, always powered.
+#define LADDER_POWER(column)           power[(column) + 1]
+#define LADDER_POWER_BIT(column, row)  ((bool) (LADDER_POWER(column) >> (row) & 1))
+
+// Bound operations leave ladder.last untouched: the rung end restores the last visited cell and the next generic instruction updates it
+#define LADDER_BOUND_LEFT         LADDER_POWER_BIT(op->column - 1, op->row)
+#define LADDER_BOUND_SET(value)   LADDER_POWER(op->column) = (LADDER_POWER(op->column) & ~((uint32_t) 1 << op->row)) | ((uint32_t) (value) << op->row)
+
+#define LADDER_DISPATCH_COMPARE(name, cmp)                                                                                       \
+        LADDER_DISPATCH_OP(name##_BOUND) {                                                                                       \
+            const ladder_operand_t *operand = &cnet->operands[op->operand];                                                      \
+            LADDER_BOUND_SET(LADDER_BOUND_LEFT ? (ladder_operand_get(&operand[0]) cmp ladder_operand_get(&operand[1])) : false); \
+            LADDER_DISPATCH_NEXT();                                                                                              \
+        }
+
+#define LADDER_DISPATCH_ARITH(name, arith)                                                           \
+        LADDER_DISPATCH_OP(name##_BOUND) {                                                           \
+            const ladder_operand_t *operand = &cnet->operands[op->operand];                          \
+            bool left = LADDER_BOUND_LEFT;                                                           \
+            LADDER_BOUND_SET(left);                                                                  \
+            if (left) {                                                                              \
+                int32_t val = ladder_operand_get(&operand[0]) arith ladder_operand_get(&operand[1]); \
+                ladder_operand_set(&operand[2], &val);                                               \
+            }                                                                                        \
+            LADDER_DISPATCH_NEXT();                                                                  \
+        }
+
+#define LADDER_DISPATCH_INLINE(name)                                                                  \
+        LADDER_DISPATCH_INS(name)                                                                     \
+            LADDER_DISPATCH_CALL(name)
+
+#define LADDER_DISPATCH_CALL(name)                                                                    \
+            LADDER_DISPATCH_LAST();                                                                   \
+            ladder_power_view(net, power, op);                                                        \
+            ladder_power_frame(&frame, net, power, op);                                               \
+            ladder_ctx->ladder.last.err = ladder_inline_##name(&frame);                               \
+            ladder_power_take(net, power, op);                                                        \
+            if (ladder_ctx->ladder.last.err != LADDER_INS_ERR_OK)                                     \
+                goto fault;                                                                           \
+            LADDER_DISPATCH_NEXT();
+
+// Series contacts and coil on consecutive cells of a row: power passes from cell to cell in a register
+#define LADDER_DISPATCH_SERIES(name, first, second)                                                      \
+        LADDER_DISPATCH_OP(name) {                                                                       \
+            bool value = (first *(const uint8_t*) cnet->operands[op->operand].ptr) && LADDER_BOUND_LEFT; \
+            LADDER_BOUND_SET(value);                                                                     \
+            op++;                                                                                        \
+            value = value && (second *(const uint8_t*) cnet->operands[op->operand].ptr);                 \
+            LADDER_BOUND_SET(value);                                                                     \
+            op++;                                                                                        \
+            LADDER_BOUND_SET(value);                                                                     \
+            *(uint8_t*) cnet->operands[op->operand].ptr = value ? 1 : 0;                                 \
+            LADDER_DISPATCH_NEXT();                                                                      \
+        }
+
+// Cell states an instruction writes (own column) on its rows. The left power reaches it in the frame, straight from the mask
+static inline void ladder_power_view(ladder_network_t *net, const uint32_t *power, const ladder_op_t *op) {
+    for (uint32_t row = op->row; row <= op->row_end; row++)
+        net->cells[row][op->column].state = LADDER_POWER_BIT(op->column, row);
+}
+
+static inline void ladder_power_frame(ladder_frame_t *frame, ladder_network_t *net, const uint32_t *power, const ladder_op_t *op) {
+    frame->cell = &net->cells[op->row][op->column];
+    frame->data = frame->cell->data;
+    frame->column = op->column;
+    frame->row = op->row;
+    frame->left = LADDER_POWER(op->column - 1) >> op->row;
+}
+
+static inline void ladder_power_take(const ladder_network_t *net, uint32_t *power, const ladder_op_t *op) {
+    for (uint32_t row = op->row; row <= op->row_end; row++)
+        LADDER_POWER(op->column) = (LADDER_POWER(op->column) & ~((uint32_t) 1 << row)) | ((uint32_t) net->cells[row][op->column].state << row);
+}
+
+// Listed cells (the ones a scan can power) between two entries of the clear list
+static inline void ladder_power_flush(ladder_network_t *net, const ladder_compiled_network_t *cnet, uint32_t first, uint32_t last) {
+    for (uint32_t n = first; n < last; n++) {
+        uint32_t row = cnet->clear[n] >> 8, column = cnet->clear[n] & 0xff;
+        net->cells[row][column].state = (bool) (cnet->power[column + 1] >> row & 1);
+    }
+}
+
+static inline void ladder_power_load(const ladder_network_t *net, const ladder_compiled_network_t *cnet, uint32_t first, uint32_t last) {
+    for (uint32_t n = first; n < last; n++) {
+        uint32_t row = cnet->clear[n] >> 8, column = cnet->clear[n] & 0xff;
+        cnet->power[column + 1] = (cnet->power[column + 1] & ~((uint32_t) 1 << row)) | ((uint32_t) net->cells[row][column].state << row);
+    }
+}
+
+// Cell states listed from first to last entry of the clear list are stale until return: the ones read outside the masks are written first
+static bool ladder_exec_ops(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet, const ladder_op_t *op,
+        const ladder_op_t *stop, uint32_t first, uint32_t last) {
+    ladder_network_t *net = &(ladder_ctx->network[network]);
+    uint32_t *power = cnet->power;
+    ladder_frame_t frame = { .ctx = ladder_ctx, .net = net };
+
+#ifdef LADDER_DISPATCH_GOTO
+    static const void *const dispatch[LADDER_OP_QTY] = { //
+            [LADDER_INS_NOP]         = &&ins_NOP,         //
+            [LADDER_INS_CONN]        = &&ins_CONN,        //
+            [LADDER_INS_NEG]         = &&ins_NEG,         //
+            [LADDER_INS_NO]          = &&ins_NO,          //
+            [LADDER_INS_NC]          = &&ins_NC,          //
+            [LADDER_INS_RE]          = &&ins_RE,          //
+            [LADDER_INS_FE]          = &&ins_FE,          //
+            [LADDER_INS_COIL]        = &&ins_COIL,        //
+            [LADDER_INS_COILL]       = &&ins_COILL,       //
+            [LADDER_INS_COILU]       = &&ins_COILU,       //
+            [LADDER_INS_TON]         = &&ins_TON,         //
+            [LADDER_INS_TOF]         = &&ins_TOF,         //
+            [LADDER_INS_TP]          = &&ins_TP,          //
+            [LADDER_INS_CTU]         = &&ins_CTU,         //
+            [LADDER_INS_CTD]         = &&ins_CTD,         //
+            [LADDER_INS_MOVE]        = &&ins_MOVE,        //
+            [LADDER_INS_SUB]         = &&ins_SUB,         //
+            [LADDER_INS_ADD]         = &&ins_ADD,         //
+            [LADDER_INS_MUL]         = &&ins_MUL,         //
+            [LADDER_INS_DIV]         = &&ins_DIV,         //
+            [LADDER_INS_MOD]         = &&ins_MOD,         //
+            [LADDER_INS_SHL]         = &&ins_SHL,         //
+            [LADDER_INS_SHR]         = &&ins_SHR,         //
+            [LADDER_INS_ROL]         = &&ins_ROL,         //
+            [LADDER_INS_ROR]         = &&ins_ROR,         //
+            [LADDER_INS_AND]         = &&ins_AND,         //
+            [LADDER_INS_OR]          = &&ins_OR,          //
+            [LADDER_INS_XOR]         = &&ins_XOR,         //
+            [LADDER_INS_NOT]         = &&ins_NOT,         //
+            [LADDER_INS_EQ]          = &&ins_EQ,          //
+            [LADDER_INS_GT]          = &&ins_GT,          //
+            [LADDER_INS_GE]          = &&ins_GE,          //
+            [LADDER_INS_LT]          = &&ins_LT,          //
+            [LADDER_INS_LE]          = &&ins_LE,          //
+            [LADDER_INS_NE]          = &&ins_NE,          //
+            [LADDER_INS_FOREIGN]     = &&ins_FOREIGN,     //
+            [LADDER_INS_TMOVE]       = &&ins_TMOVE,       //
+            [LADDER_OP_MERGE]        = &&op_MERGE,        //
+            [LADDER_OP_INV]          = &&op_INV,          //
+            [LADDER_OP_RUNG_END]     = &&op_RUNG_END,     //
+            [LADDER_OP_END]          = &&op_END,          //
+            [LADDER_OP_WIRE]         = &&op_WIRE,         //
+            [LADDER_OP_NO_BOUND]     = &&op_NO_BOUND,     //
+            [LADDER_OP_NC_BOUND]     = &&op_NC_BOUND,     //
+            [LADDER_OP_RE_BOUND]     = &&op_RE_BOUND,     //
+            [LADDER_OP_FE_BOUND]     = &&op_FE_BOUND,     //
+            [LADDER_OP_COIL_BOUND]   = &&op_COIL_BOUND,   //
+            [LADDER_OP_COILL_BOUND]  = &&op_COILL_BOUND,  //
+            [LADDER_OP_COILU_BOUND]  = &&op_COILU_BOUND,  //
+            [LADDER_OP_EQ_BOUND]     = &&op_EQ_BOUND,     //
+            [LADDER_OP_NE_BOUND]     = &&op_NE_BOUND,     //
+            [LADDER_OP_GT_BOUND]     = &&op_GT_BOUND,     //
+            [LADDER_OP_GE_BOUND]     = &&op_GE_BOUND,     //
+            [LADDER_OP_LT_BOUND]     = &&op_LT_BOUND,     //
+            [LADDER_OP_LE_BOUND]     = &&op_LE_BOUND,     //
+            [LADDER_OP_ADD_BOUND]    = &&op_ADD_BOUND,    //
+            [LADDER_OP_MUL_BOUND]    = &&op_MUL_BOUND,    //
+            [LADDER_OP_NO_NO_COIL]   = &&op_NO_NO_COIL,   //
+            [LADDER_OP_NO_NC_COIL]   = &&op_NO_NC_COIL,   //
+            [LADDER_OP_EQ_MOVE]      = &&op_EQ_MOVE,      //
+            [LADDER_OP_RE_CTU]       = &&op_RE_CTU,       //
+            [LADDER_OP_CUSTOM]       = &&op_CUSTOM,       //
+            [LADDER_OP_CUSTOM_BOUND] = &&op_CUSTOM_BOUND, //
+            };
+
+    goto *dispatch[op->op];
+#else
+    for (;; op++) {
+        switch (op->op) {
+#endif
+        LADDER_DISPATCH_INLINE(NOP)
+        LADDER_DISPATCH_INLINE(CONN)
+        LADDER_DISPATCH_INLINE(NEG)
+        LADDER_DISPATCH_INLINE(NO)
+        LADDER_DISPATCH_INLINE(NC)
+        LADDER_DISPATCH_INLINE(RE)
+        LADDER_DISPATCH_INLINE(FE)
+        LADDER_DISPATCH_INLINE(COIL)
+        LADDER_DISPATCH_INLINE(COILL)
+        LADDER_DISPATCH_INLINE(COILU)
+        LADDER_DISPATCH_INLINE(TON)
+        LADDER_DISPATCH_INLINE(TOF)
+        LADDER_DISPATCH_INLINE(TP)
+        LADDER_DISPATCH_INLINE(CTU)
+        LADDER_DISPATCH_INLINE(CTD)
+        LADDER_DISPATCH_INLINE(MOVE)
+        LADDER_DISPATCH_INLINE(SUB)
+        LADDER_DISPATCH_INLINE(ADD)
+        LADDER_DISPATCH_INLINE(MUL)
+        LADDER_DISPATCH_INLINE(DIV)
+        LADDER_DISPATCH_INLINE(MOD)
+        LADDER_DISPATCH_INLINE(SHL)
+        LADDER_DISPATCH_INLINE(SHR)
+        LADDER_DISPATCH_INLINE(ROL)
+        LADDER_DISPATCH_INLINE(ROR)
+        LADDER_DISPATCH_INLINE(AND)
+        LADDER_DISPATCH_INLINE(OR)
+        LADDER_DISPATCH_INLINE(XOR)
+        LADDER_DISPATCH_INLINE(NOT)
+        LADDER_DISPATCH_INLINE(EQ)
+        LADDER_DISPATCH_INLINE(GT)
+        LADDER_DISPATCH_INLINE(GE)
+        LADDER_DISPATCH_INLINE(LT)
+        LADDER_DISPATCH_INLINE(LE)
+        LADDER_DISPATCH_INLINE(NE)
+        LADDER_DISPATCH_INLINE(TMOVE)
+
+        LADDER_DISPATCH_INS(FOREIGN)
+            LADDER_DISPATCH_LAST();
+            // may read and write any cell of the network
+            ladder_power_flush(net, cnet, first, last);
+            ladder_power_frame(&frame, net, power, op);
+            ladder_ctx->ladder.last.err = op->fn(&frame);
+            ladder_power_load(net, cnet, first, last);
+            if (ladder_ctx->ladder.last.err != LADDER_INS_ERR_OK)
+                goto fault;
+            LADDER_DISPATCH_NEXT();
+
+        // custom instructions see their rows as generic instructions do, operands bound by the compiler through the frame
+        LADDER_DISPATCH_OP(CUSTOM_BOUND)
+            frame.bound = &cnet->operands[op->operand];
+            /* fall through */
+        LADDER_DISPATCH_OP(CUSTOM)
+            LADDER_DISPATCH_LAST();
+            ladder_power_view(net, power, op);
+            ladder_power_frame(&frame, net, power, op);
+            ladder_ctx->ladder.last.err = op->fn(&frame);
+            frame.bound = NULL;
+            ladder_power_take(net, power, op);
+            if (ladder_ctx->ladder.last.err != LADDER_INS_ERR_OK)
+                goto fault;
+            LADDER_DISPATCH_NEXT();
+
+        LADDER_DISPATCH_OP(NO_BOUND)
+            LADDER_BOUND_SET(*(const uint8_t*) cnet->operands[op->operand].ptr && LADDER_BOUND_LEFT);
+            LADDER_DISPATCH_NEXT();
+
+        LADDER_DISPATCH_OP(NC_BOUND)
+            LADDER_BOUND_SET(!*(const uint8_t*) cnet->operands[op->operand].ptr && LADDER_BOUND_LEFT);
+            LADDER_DISPATCH_NEXT();
+
+        LADDER_DISPATCH_OP(RE_BOUND) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            LADDER_BOUND_SET((*(const uint8_t*) operand->ptr && !(*operand->prev & operand->prev_mask)) && LADDER_BOUND_LEFT);
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_OP(FE_BOUND) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            LADDER_BOUND_SET((!*(const uint8_t*) operand->ptr && (*operand->prev & operand->prev_mask)) && LADDER_BOUND_LEFT);
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_OP(COIL_BOUND) {
+            bool left = LADDER_BOUND_LEFT;
+            LADDER_BOUND_SET(left);
+            *(uint8_t*) cnet->operands[op->operand].ptr = left ? 1 : 0;
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_OP(COILL_BOUND) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            bool val = (*operand->prev & operand->prev_mask) || LADDER_BOUND_LEFT;
+            LADDER_BOUND_SET(val);
+            *(uint8_t*) operand->ptr = val ? 1 : 0;
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_OP(COILU_BOUND) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            bool val = (*operand->prev & operand->prev_mask) && !LADDER_BOUND_LEFT;
+            LADDER_BOUND_SET(val);
+            *(uint8_t*) operand->ptr = val ? 1 : 0;
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_COMPARE(EQ, ==)
+        LADDER_DISPATCH_COMPARE(NE, !=)
+        LADDER_DISPATCH_COMPARE(GT, >)
+        LADDER_DISPATCH_COMPARE(GE, >=)
+        LADDER_DISPATCH_COMPARE(LT, <)
+        LADDER_DISPATCH_COMPARE(LE, <=)
+        LADDER_DISPATCH_ARITH(ADD, +)
+        LADDER_DISPATCH_ARITH(MUL, *)
+
+        LADDER_DISPATCH_SERIES(NO_NO_COIL, , )
+        LADDER_DISPATCH_SERIES(NO_NC_COIL, , !)
+
+        LADDER_DISPATCH_OP(EQ_MOVE) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            LADDER_BOUND_SET(LADDER_BOUND_LEFT ? (ladder_operand_get(&operand[0]) == ladder_operand_get(&operand[1])) : false);
+            op++;
+            LADDER_DISPATCH_CALL(MOVE)
+        }
+
+        LADDER_DISPATCH_OP(RE_CTU) {
+            const ladder_operand_t *operand = &cnet->operands[op->operand];
+            LADDER_BOUND_SET((*(const uint8_t*) operand->ptr && !(*operand->prev & operand->prev_mask)) && LADDER_BOUND_LEFT);
+            op++;
+            LADDER_DISPATCH_CALL(CTU)
+        }
+
+        LADDER_DISPATCH_OP(WIRE)
+            LADDER_BOUND_SET(LADDER_POWER_BIT(op->operand - 1, op->row));
+            LADDER_DISPATCH_NEXT();
+
+        LADDER_DISPATCH_OP(MERGE) {
+            uint32_t column = LADDER_POWER(op->column);
+            LADDER_POWER(op->column) = (column & op->operand) ? (column | op->operand) : (column & ~op->operand);
+            LADDER_DISPATCH_NEXT();
+        }
+
+        LADDER_DISPATCH_OP(INV)
+            LADDER_DISPATCH_LAST();
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+            goto fault;
+
+        LADDER_DISPATCH_OP(RUNG_END)
+            if (op->row_end) {
+                LADDER_DISPATCH_LAST();
+            }
+            if (ladder_ctx->on.scan_end != NULL) {
+                ladder_power_flush(net, cnet, first, last);
+                ladder_ctx->on.scan_end(ladder_ctx);
+            }
+            if (op == stop)
+                return true;
+            LADDER_DISPATCH_NEXT();
+
+        LADDER_DISPATCH_OP(END)
+#ifndef LADDER_DISPATCH_GOTO
+        default:
+#endif
+            return true;
+#ifndef LADDER_DISPATCH_GOTO
+        }
+    }
+#endif
+
+    fault:
+    ladder_ctx->ladder.state = LADDER_ST_INV;
+    return false;
+}
+
+// Rungs before, between and after the groups run on the operations
+static bool ladder_exec_slices(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet, uint32_t first, uint32_t last) {
+    const ladder_op_t *op = cnet->ops;
+
+    for (uint32_t s = 0; s < cnet->slices_qty; s++) {
+        const ladder_slice_t *slice = &cnet->slice[s];
+        if (&cnet->ops[slice->first_op] != op && !ladder_exec_ops(ladder_ctx, network, cnet, op, &cnet->ops[slice->first_op - 1], first, last))
+            return false;
+        ladder_slice_exec(cnet, slice);
+        op = &cnet->ops[slice->last_op];
+        LADDER_DISPATCH_LAST();
+        op++;
+    }
+
+    return ladder_exec_ops(ladder_ctx, network, cnet, op, NULL, first, last);
+}
+
+bool ladder_exec_rungs(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet, const ladder_op_t *op, const ladder_op_t *stop,
+        uint32_t row_start, uint32_t row_end) {
+    ladder_network_t *net = &(ladder_ctx->network[network]);
+    uint32_t first = cnet->clear_start[row_start], last = cnet->clear_start[row_end + 1];
+    ladder_ctx->exec_network = net;
+
+    // cells out of the clear list are never powered
+    if (row_start == 0 && row_end + 1 == net->rows) {
+        memset(&cnet->power[1], 0, net->cols * sizeof(uint32_t));
+    } else {
+        for (uint32_t n = first; n < last; n++)
+            cnet->power[(cnet->clear[n] & 0xff) + 1] &= ~((uint32_t) 1 << (cnet->clear[n] >> 8));
+    }
+
+    // groups of rungs skip the rung end hook
+    bool ok;
+    if (op == cnet->ops && stop == NULL && cnet->slices_qty > 0 && ladder_ctx->on.scan_end == NULL)
+        ok = ladder_exec_slices(ladder_ctx, network, cnet, first, last);
+    else
+        ok = ladder_exec_ops(ladder_ctx, network, cnet, op, stop, first, last);
+    ladder_power_flush(net, cnet, first, last);
+
+    return ok;
+}
+
+bool ladder_exec_network(ladder_ctx_t *ladder_ctx, uint32_t network, const ladder_compiled_network_t *cnet) {
+    return ladder_exec_rungs(ladder_ctx, network, cnet, cnet->ops, NULL, 0, ladder_ctx->network[network].rows - 1);
+}
+
+void ladder_scan_compiled(ladder_ctx_t *ladder_ctx) {
+    // per instruction hook needs every cell (including NOP) visited: keep the interpreter
+    if (ladder_ctx->on.instruction != NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled == NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks; network++) {
+        if (ladder_ctx->network[network].cells == NULL) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);
+            }
+            return;
+        }
+        if (!ladder_ctx->network[network].enable)
+            continue;
+
+        bool ok = compiled->network[network].interpreted ?
+                ladder_scan_network(ladder_ctx, network) : ladder_exec_network(ladder_ctx, network, &compiled->network[network]);
+        if (!ok)
+            return;
+    }
+}
+
+#endif /* OPTIONAL_COMPILED */
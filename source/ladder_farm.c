@@ -0,0 +1,220 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_FARM
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ladder_batch.h"
+#include "ladder_farm.h"
+
+typedef struct ladder_farm_job_s {
+         ladder_ctx_t *ladder_ctx; /**< Program */
+             uint64_t ticks;       /**< Task cycles of each run */
+             uint32_t period_ms;   /**< Virtual time of a cycle */
+    ladder_batch_io_t io;          /**< Scenario */
+        ladder_farm_t *farm;       /**< Results */
+          atomic_uint next;        /**< First run of the next batch */
+          atomic_bool fail;        /**< A batch could not be created */
+} ladder_farm_job_t;
+
+// Runs of a batch: io functions see run numbers instead of lanes
+typedef struct ladder_farm_chunk_s {
+    ladder_farm_job_t *job;
+             uint32_t first;
+} ladder_farm_chunk_t;
+
+static uint64_t ladder_farm_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000ULL + (uint64_t) ts.tv_nsec / 1000ULL;
+}
+
+static void ladder_farm_read(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg) {
+    ladder_farm_chunk_t *chunk = (ladder_farm_chunk_t*) arg;
+    if (chunk->job->io.read != NULL)
+        chunk->job->io.read(ladder_ctx, chunk->first + lane, id, tick, chunk->job->io.arg);
+}
+
+static void ladder_farm_write(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg) {
+    ladder_farm_chunk_t *chunk = (ladder_farm_chunk_t*) arg;
+    if (chunk->job->io.write != NULL)
+        chunk->job->io.write(ladder_ctx, chunk->first + lane, id, tick, chunk->job->io.arg);
+}
+
+static void ladder_farm_result(ladder_farm_result_t *result, const ladder_ctx_t *lane, uint64_t scans, uint64_t exec_us) {
+    result->scans = scans;
+    result->exec_us = exec_us;
+    result->state = lane->ladder.state;
+    result->instr = lane->ladder.last.instr;
+    result->network = lane->ladder.last.network;
+    result->cell_column = lane->ladder.last.cell_column;
+    result->cell_row = lane->ladder.last.cell_row;
+    result->err = lane->ladder.last.err;
+
+    uint32_t q = 0, qw = 0;
+    for (uint32_t n = 0; n < lane->hw.io.fn_write_qty; n++) {
+        const ladder_hw_output_vals_t *output = &lane->output[n];
+        if (output->q_qty > 0 && output->Q != NULL)
+            memcpy(&result->Q[q], output->Q, output->q_qty * sizeof(uint8_t));
+        if (output->qw_qty > 0 && output->QW != NULL)
+            memcpy(&result->QW[qw], output->QW, output->qw_qty * sizeof(int32_t));
+        q += output->q_qty;
+        qw += output->qw_qty;
+    }
+}
+
+static void* ladder_farm_worker(void *arg) {
+    ladder_farm_job_t *job = (ladder_farm_job_t*) arg;
+    ladder_farm_t *farm = job->farm;
+
+    for (;;) {
+        uint32_t first = atomic_fetch_add_explicit(&job->next, LADDER_BATCH_LANES, memory_order_relaxed);
+        if (first >= farm->runs || atomic_load_explicit(&job->fail, memory_order_relaxed))
+            break;
+        uint32_t lanes = farm->runs - first < LADDER_BATCH_LANES ? farm->runs - first : LADDER_BATCH_LANES;
+
+        ladder_farm_chunk_t chunk = { .job = job, .first = first };
+        ladder_batch_io_t io = { .read = ladder_farm_read, .write = ladder_farm_write, .arg = &chunk };
+        uint64_t start = ladder_farm_now();
+        ladder_batch_t *batch = ladder_batch_init(job->ladder_ctx, lanes, &io);
+        if (batch == NULL) {
+            atomic_store_explicit(&job->fail, true, memory_order_relaxed);
+            break;
+        }
+
+        // a lane counts the cycle that ends its task
+        uint64_t scans[LADDER_BATCH_LANES] = { 0 };
+        uint64_t running = lanes == 64 ? UINT64_MAX : ((uint64_t) 1 << lanes) - 1;
+        for (uint64_t t = 0; t < job->ticks && running != 0; t++) {
+            for (uint32_t l = 0; l < lanes; l++)
+                scans[l] += running >> l & 1;
+            running = ladder_batch_run(batch, 1, job->period_ms);
+        }
+        uint64_t exec_us = (ladder_farm_now() - start) / lanes;
+
+        for (uint32_t l = 0; l < lanes; l++)
+            ladder_farm_result(&farm->result[first + l], ladder_batch_lane(batch, l), scans[l], exec_us);
+        ladder_batch_deinit(batch);
+    }
+
+    return NULL;
+}
+
+ladder_farm_t* ladder_farm_run(ladder_ctx_t *ladder_ctx, uint32_t runs, uint64_t ticks, uint32_t period_ms, uint32_t workers,
+        const ladder_batch_io_t *io) {
+    if (ladder_ctx == NULL || runs == 0)
+        return NULL;
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1)
+        online = 1;
+    if (workers == 0)
+        workers = (uint32_t) online;
+    if (workers > (runs + LADDER_BATCH_LANES - 1) / LADDER_BATCH_LANES)
+        workers = (runs + LADDER_BATCH_LANES - 1) / LADDER_BATCH_LANES;
+
+    uint32_t q_qty = 0, qw_qty = 0;
+    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+        q_qty += ladder_ctx->output[n].q_qty;
+        qw_qty += ladder_ctx->output[n].qw_qty;
+    }
+
+    // results table, then digital and analog outputs of every run
+    size_t size = (size_t) runs * (sizeof(ladder_farm_result_t) + qw_qty * sizeof(int32_t) + q_qty * sizeof(uint8_t));
+    ladder_farm_t *farm = calloc(1, sizeof(ladder_farm_t));
+    pthread_t *thread = calloc(workers, sizeof(pthread_t));
+    if (farm == NULL || thread == NULL || (farm->result = calloc(1, size)) == NULL) {
+        free(thread);
+        ladder_farm_free(farm);
+        return NULL;
+    }
+    farm->runs = runs;
+    farm->q_qty = q_qty;
+    farm->qw_qty = qw_qty;
+    int32_t *qw = (int32_t*) &farm->result[runs];
+    uint8_t *q = (uint8_t*) &qw[(size_t) runs * qw_qty];
+    for (uint32_t r = 0; r < runs; r++) {
+        farm->result[r].QW = &qw[(size_t) r * qw_qty];
+        farm->result[r].Q = &q[(size_t) r * q_qty];
+    }
+
+    ladder_farm_job_t job = { .ladder_ctx = ladder_ctx, .ticks = ticks, .period_ms = period_ms, .farm = farm };
+    if (io != NULL)
+        job.io = *io;
+    atomic_init(&job.next, 0);
+    atomic_init(&job.fail, false);
+
+    uint64_t start = ladder_farm_now();
+    uint32_t started = 0;
+    for (; started < workers; started++)
+        if (pthread_create(&thread[started], NULL, ladder_farm_worker, &job) != 0)
+            break;
+    // the caller works too when threads are not available
+    if (started == 0)
+        ladder_farm_worker(&job);
+    for (uint32_t t = 0; t < started; t++)
+        pthread_join(thread[t], NULL);
+    free(thread);
+    farm->exec_us = ladder_farm_now() - start;
+
+    if (atomic_load_explicit(&job.fail, memory_order_relaxed)) {
+        ladder_farm_free(farm);
+        return NULL;
+    }
+
+    for (uint32_t r = 0; r < runs; r++)
+        farm->scans += farm->result[r].scans;
+
+    return farm;
+}
+
+void ladder_farm_free(ladder_farm_t *farm) {
+    if (farm == NULL)
+        return;
+
+    free(farm->result);
+    free(farm);
+}
+
+#endif /* OPTIONAL_FARM */
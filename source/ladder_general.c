@@ -37,6 +37,11 @@
 
 #include "ladder.h"
 #include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_topology.h"
+#include "ladder_parallel.h"
+#include "ladder_bits.h"
+#include "ladder_arena.h"
 #ifdef OPTIONAL_CRON
 #include "ladderlib_cron.h"
 #endif
@@ -200,21 +205,21 @@ bool ladder_fault_clear(ladder_ctx_t *ladder_ctx) {
 void ladder_save_previous_values(ladder_ctx_t *ladder_ctx) {
     if (ladder_ctx == NULL) return;
 
-    // Save memory areas
-    if (ladder_ctx->ladder.quantity.m > 0 && ladder_ctx->memory.M != NULL && ladder_ctx->prev_scan_vals.Mh != NULL) {
-        memcpy(ladder_ctx->prev_scan_vals.Mh, ladder_ctx->memory.M, ladder_ctx->ladder.quantity.m * sizeof(uint8_t));
+    // Save memory areas (packed 64 flags per word with OPTIONAL_PACKED_HISTORY)
+    if (ladder_ctx->ladder.quantity.m > 0 && ladder_ctx->memory.M != NULL && LADDER_HISTORY(ladder_ctx, M) != NULL) {
+        ladder_history_save(LADDER_HISTORY(ladder_ctx, M), ladder_ctx->memory.M, ladder_ctx->ladder.quantity.m);
     }
-    if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->memory.Cd != NULL && ladder_ctx->prev_scan_vals.Cdh != NULL) {
-        memcpy(ladder_ctx->prev_scan_vals.Cdh, ladder_ctx->memory.Cd, ladder_ctx->ladder.quantity.c * sizeof(uint8_t));  // Modified: sizeof(uint8_t)
+    if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->memory.Cd != NULL && LADDER_HISTORY(ladder_ctx, Cd) != NULL) {
+        ladder_history_save(LADDER_HISTORY(ladder_ctx, Cd), ladder_ctx->memory.Cd, ladder_ctx->ladder.quantity.c);
     }
-    if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->memory.Cr != NULL && ladder_ctx->prev_scan_vals.Crh != NULL) {
-        memcpy(ladder_ctx->prev_scan_vals.Crh, ladder_ctx->memory.Cr, ladder_ctx->ladder.quantity.c * sizeof(uint8_t));  // Modified: sizeof(uint8_t)
+    if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->memory.Cr != NULL && LADDER_HISTORY(ladder_ctx, Cr) != NULL) {
+        ladder_history_save(LADDER_HISTORY(ladder_ctx, Cr), ladder_ctx->memory.Cr, ladder_ctx->ladder.quantity.c);
     }
-    if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->memory.Td != NULL && ladder_ctx->prev_scan_vals.Tdh != NULL) {
-        memcpy(ladder_ctx->prev_scan_vals.Tdh, ladder_ctx->memory.Td, ladder_ctx->ladder.quantity.t * sizeof(uint8_t));  // Modified: sizeof(uint8_t)
+    if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->memory.Td != NULL && LADDER_HISTORY(ladder_ctx, Td) != NULL) {
+        ladder_history_save(LADDER_HISTORY(ladder_ctx, Td), ladder_ctx->memory.Td, ladder_ctx->ladder.quantity.t);
     }
-    if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->memory.Tr != NULL && ladder_ctx->prev_scan_vals.Trh != NULL) {
-        memcpy(ladder_ctx->prev_scan_vals.Trh, ladder_ctx->memory.Tr, ladder_ctx->ladder.quantity.t * sizeof(uint8_t));  // Modified: sizeof(uint8_t)
+    if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->memory.Tr != NULL && LADDER_HISTORY(ladder_ctx, Tr) != NULL) {
+        ladder_history_save(LADDER_HISTORY(ladder_ctx, Tr), ladder_ctx->memory.Tr, ladder_ctx->ladder.quantity.t);
     }
 
     // Save outputs (added for consistency in history)
@@ -230,49 +235,209 @@ void ladder_save_previous_values(ladder_ctx_t *ladder_ctx) {
     }
 }
 
+bool ladder_flag_edges(ladder_ctx_t *ladder_ctx, ladder_register_t type, uint64_t *rising, uint64_t *falling) {
+    if (ladder_ctx == NULL)
+        return false;
+
+    const uint8_t *flags;
+    const void *prev;
+    uint32_t qty;
+
+    switch (type) {
+        case LADDER_REGISTER_M:
+            flags = ladder_ctx->memory.M;
+            prev = LADDER_HISTORY(ladder_ctx, M);
+            qty = ladder_ctx->ladder.quantity.m;
+            break;
+        case LADDER_REGISTER_Cd:
+            flags = (const uint8_t*) ladder_ctx->memory.Cd;
+            prev = LADDER_HISTORY(ladder_ctx, Cd);
+            qty = ladder_ctx->ladder.quantity.c;
+            break;
+        case LADDER_REGISTER_Cr:
+            flags = (const uint8_t*) ladder_ctx->memory.Cr;
+            prev = LADDER_HISTORY(ladder_ctx, Cr);
+            qty = ladder_ctx->ladder.quantity.c;
+            break;
+        case LADDER_REGISTER_Td:
+            flags = (const uint8_t*) ladder_ctx->memory.Td;
+            prev = LADDER_HISTORY(ladder_ctx, Td);
+            qty = ladder_ctx->ladder.quantity.t;
+            break;
+        case LADDER_REGISTER_Tr:
+            flags = (const uint8_t*) ladder_ctx->memory.Tr;
+            prev = LADDER_HISTORY(ladder_ctx, Tr);
+            qty = ladder_ctx->ladder.quantity.t;
+            break;
+        default:
+            return false;
+    }
+
+    if (qty > 0 && (flags == NULL || prev == NULL))
+        return false;
+
+    ladder_history_edges(flags, prev, rising, falling, qty);
+
+    return true;
+}
+
 void ladder_clear_memory(ladder_ctx_t *ladder_ctx) {
     if (ladder_ctx->ladder.quantity.m > 0) {
-        memset(ladder_ctx->prev_scan_vals.Mh, 0, ladder_ctx->ladder.quantity.m * sizeof(uint8_t));
+        memset(LADDER_HISTORY(ladder_ctx, M), 0, ladder_history_size(ladder_ctx->ladder.quantity.m));
         memset(ladder_ctx->memory.M, 0, ladder_ctx->ladder.quantity.m * sizeof(uint8_t));
     }
 
     if (ladder_ctx->ladder.quantity.c > 0) {
-        memset(ladder_ctx->prev_scan_vals.Cdh, 0, ladder_ctx->ladder.quantity.c * sizeof(bool));
+        memset(LADDER_HISTORY(ladder_ctx, Cd), 0, ladder_history_size(ladder_ctx->ladder.quantity.c));
         memset(ladder_ctx->memory.Cd, 0, ladder_ctx->ladder.quantity.c * sizeof(bool));
-        memset(ladder_ctx->prev_scan_vals.Crh, 0, ladder_ctx->ladder.quantity.c * sizeof(bool));
+        memset(LADDER_HISTORY(ladder_ctx, Cr), 0, ladder_history_size(ladder_ctx->ladder.quantity.c));
         memset(ladder_ctx->memory.Cr, 0, ladder_ctx->ladder.quantity.c * sizeof(bool));
     }
 
     if (ladder_ctx->ladder.quantity.t > 0) {
-        memset(ladder_ctx->prev_scan_vals.Tdh, 0, ladder_ctx->ladder.quantity.t * sizeof(bool));
+        memset(LADDER_HISTORY(ladder_ctx, Td), 0, ladder_history_size(ladder_ctx->ladder.quantity.t));
         memset(ladder_ctx->memory.Td, 0, ladder_ctx->ladder.quantity.t * sizeof(bool));
-        memset(ladder_ctx->prev_scan_vals.Trh, 0, ladder_ctx->ladder.quantity.t * sizeof(bool));
+        memset(LADDER_HISTORY(ladder_ctx, Tr), 0, ladder_history_size(ladder_ctx->ladder.quantity.t));
         memset(ladder_ctx->memory.Tr, 0, ladder_ctx->ladder.quantity.t * sizeof(bool));
     }
 }
 
+// Memory released with the network pool or the program arena, not per cell
+static bool ladder_network_owns(const ladder_network_t *network, const void *ptr) {
+    if (network == NULL)
+        return false;
+    if (network->pool != NULL && (uintptr_t) ptr >= (uintptr_t) network->pool && (uintptr_t) ptr < (uintptr_t) (network->pool + network->pool_qty))
+        return true;
+
+    return ladder_arena_owns((const ladder_arena_t*) network->arena, ptr);
+}
+
+void ladder_cell_data_free(ladder_network_t *network, ladder_cell_t *cell) {
+    if (cell == NULL || cell->data == NULL)
+        return;
+
+    for (uint32_t d = 0; d < cell->data_qty; d++) {
+        if (cell->data[d].type == LADDER_REGISTER_S && cell->data[d].value.cstr != NULL) {
+            if (!ladder_network_owns(network, cell->data[d].value.cstr))
+                free((void*) cell->data[d].value.cstr);
+            cell->data[d].value.cstr = NULL;
+        }
+    }
+
+    if (!ladder_network_owns(network, cell->data))
+        free(cell->data);
+
+    cell->data = NULL;
+    cell->data_qty = 0;
+}
+
+bool ladder_network_alloc(ladder_network_t *network, uint32_t rows, uint32_t cols) {
+    if (network == NULL || rows < 1 || cols < 1)
+        return false;
+
+    ladder_network_free(network);
+
+    if ((size_t) rows * cols > (SIZE_MAX - (size_t) rows * sizeof(ladder_cell_t*)) / sizeof(ladder_cell_t) - 1)
+        return false;
+
+    // row pointers first, cells after them (pointer array size keeps cells aligned)
+    size_t head = ((rows * sizeof(ladder_cell_t*) + _Alignof(ladder_cell_t) - 1) / _Alignof(ladder_cell_t)) * _Alignof(ladder_cell_t);
+    uint8_t *block = calloc(1, head + (size_t) rows * cols * sizeof(ladder_cell_t));
+    if (block == NULL)
+        return false;
+
+    network->cells = (ladder_cell_t**) block;
+    for (uint32_t r = 0; r < rows; r++)
+        network->cells[r] = (ladder_cell_t*) (block + head) + (size_t) r * cols;
+
+    network->rows = rows;
+    network->cols = cols;
+
+    return true;
+}
+
+void ladder_network_free(ladder_network_t *network) {
+    if (network == NULL)
+        return;
+
+    if (network->cells != NULL)
+        for (uint32_t i = 0; i < network->rows * network->cols; i++)
+            ladder_cell_data_free(network, ladder_network_cell(network, i));
+
+    free(network->cells);
+    free(network->pool);
+    network->cells = NULL;
+    network->pool = NULL;
+    network->pool_qty = 0;
+}
+
+bool ladder_program_compact(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->network == NULL)
+        return false;
+
+    for (uint32_t nt = 0; nt < ladder_ctx->ladder.quantity.networks; nt++) {
+        ladder_network_t *network = &ladder_ctx->network[nt];
+        if (network->cells == NULL)
+            continue;
+
+        uint32_t cells_qty = network->rows * network->cols;
+        uint32_t qty = 0;
+        for (uint32_t i = 0; i < cells_qty; i++)
+            if (ladder_network_cell(network, i)->data != NULL)
+                qty += ladder_network_cell(network, i)->data_qty;
+
+        ladder_value_t *pool = NULL;
+        if (qty > 0 && (pool = malloc(qty * sizeof(ladder_value_t))) == NULL)
+            return false;
+
+        // values (and their strings) move to the new pool in cell order
+        uint32_t pos = 0;
+        for (uint32_t i = 0; i < cells_qty; i++) {
+            ladder_cell_t *cell = ladder_network_cell(network, i);
+            if (cell->data == NULL)
+                continue;
+
+            memcpy(pool + pos, cell->data, cell->data_qty * sizeof(ladder_value_t));
+            if (!ladder_network_owns(network, cell->data))
+                free(cell->data);
+            cell->data = cell->data_qty > 0 ? pool + pos : NULL;
+            pos += cell->data_qty;
+        }
+
+        free(network->pool);
+        network->pool = pool;
+        network->pool_qty = qty;
+    }
+
+    ladder_program_changed(ladder_ctx);
+
+    return true;
+}
+
 void ladder_clear_program(ladder_ctx_t *ladder_ctx) {
+    ladder_program_changed(ladder_ctx);
+    ladder_ctx->ladder.optimize = false;
+
     for (uint32_t nt = 0; nt < ladder_ctx->ladder.quantity.networks; nt++) {
-        for (uint32_t r = 0; r < ladder_ctx->network[nt].rows; r++) {
-            for (uint32_t c = 0; c < ladder_ctx->network[nt].cols; c++) {
-                ladder_ctx->network[nt].cells[r][c].code = LADDER_INS_NOP;
-                ladder_ctx->network[nt].cells[r][c].vertical_bar = false;
-                ladder_ctx->network[nt].cells[r][c].state = false;
-                if (ladder_ctx->network[nt].cells[r][c].data != NULL) {
-                    for (uint32_t d = 0; d < ladder_ctx->network[nt].cells[r][c].data_qty; d++) {
-                        if (ladder_ctx->network[nt].cells[r][c].data[d].type == LADDER_REGISTER_S&&
-                        ladder_ctx->network[nt].cells[r][c].data[d].value.cstr != NULL) {
-                            free((void*) ladder_ctx->network[nt].cells[r][c].data[d].value.cstr);
-                            ladder_ctx->network[nt].cells[r][c].data[d].value.cstr = NULL;
-                        }
-                    }
-                    free(ladder_ctx->network[nt].cells[r][c].data);
-                    ladder_ctx->network[nt].cells[r][c].data = NULL;
-                    ladder_ctx->network[nt].cells[r][c].data_qty = 0;
-                }
-            }
+        ladder_network_t *network = &ladder_ctx->network[nt];
+        if (network->cells == NULL)
+            continue;
+
+        for (uint32_t i = 0; i < network->rows * network->cols; i++) {
+            ladder_cell_t *cell = ladder_network_cell(network, i);
+            cell->code = LADDER_INS_NOP;
+            cell->vertical_bar = false;
+            cell->state = false;
+            ladder_cell_data_free(network, cell);
         }
+
+        free(network->pool);
+        network->pool = NULL;
+        network->pool_qty = 0;
     }
+
+    // cells no longer point into the arena: release the whole program at once
+    ladder_arena_free(ladder_ctx);
 }
 
 bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t net_rows_qty, uint32_t networks_qty, uint32_t qty_m, uint32_t qty_c,
@@ -291,6 +456,7 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
     ladder_ctx->hw.io.fn_write_qty = 0;
     ladder_ctx->foreign.qty = 0;
     ladder_ctx->foreign.fn = NULL;
+    ladder_ctx->custom = NULL;
 
     ladder_ctx->scan_internals.actual_scan_time = 0;
     ladder_ctx->scan_internals.start_time = 0;
@@ -324,41 +490,13 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
             goto cleanup;
 
         for (uint32_t nt = 0; nt < networks_qty; nt++) {
-            ladder_ctx->network[nt].rows = net_rows_qty;
-            ladder_ctx->network[nt].cols = net_columns_qty;
-
-            if (net_rows_qty > SIZE_MAX / sizeof(ladder_cell_t*)) {
-                goto cleanup;
-            }
-            ladder_ctx->network[nt].cells = calloc(net_rows_qty, sizeof(ladder_cell_t*));
-            if (ladder_ctx->network[nt].cells == NULL) {
+            if (!ladder_network_alloc(&ladder_ctx->network[nt], net_rows_qty, net_columns_qty))
                 goto cleanup;
-            }
-            for (uint32_t cl = 0; cl < net_rows_qty; cl++) {
-                if (net_columns_qty > SIZE_MAX / sizeof(ladder_cell_t)) {
-                    goto cleanup;
-                }
-                ladder_ctx->network[nt].cells[cl] = calloc(net_columns_qty, sizeof(ladder_cell_t));
-                if (ladder_ctx->network[nt].cells[cl] == NULL) {
-                    goto cleanup;
-                }
-            }
-
-            for (uint32_t column = 0; column < net_columns_qty; column++) {
-                for (uint32_t row = 0; row < net_rows_qty; row++) {
-                    ladder_ctx->network[nt].cells[row][column].vertical_bar = false;
-                    ladder_ctx->network[nt].cells[row][column].state = false;
-                    ladder_ctx->network[nt].cells[row][column].data_qty = 0;
-                    ladder_ctx->network[nt].cells[row][column].data = NULL;
-                }
-            }
         }
     }
 
-    if (qty_m > SIZE_MAX / sizeof(uint8_t))
-        goto cleanup;
-    ladder_ctx->prev_scan_vals.Mh = calloc(qty_m, sizeof(uint8_t));
-    if (ladder_ctx->prev_scan_vals.Mh == NULL)
+    LADDER_HISTORY(ladder_ctx, M) = calloc(ladder_history_size(qty_m), 1);
+    if (LADDER_HISTORY(ladder_ctx, M) == NULL)
         goto cleanup;
 
     if (qty_m > SIZE_MAX / sizeof(uint8_t))
@@ -367,10 +505,8 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
     if (ladder_ctx->memory.M == NULL)
         goto cleanup;
 
-    if (qty_c > SIZE_MAX / sizeof(bool))
-        goto cleanup;
-    ladder_ctx->prev_scan_vals.Crh = calloc(qty_c, sizeof(bool));
-    if (ladder_ctx->prev_scan_vals.Crh == NULL)
+    LADDER_HISTORY(ladder_ctx, Cr) = calloc(ladder_history_size(qty_c), 1);
+    if (LADDER_HISTORY(ladder_ctx, Cr) == NULL)
         goto cleanup;
 
     if (qty_c > SIZE_MAX / sizeof(bool))
@@ -379,10 +515,8 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
     if (ladder_ctx->memory.Cr == NULL)
         goto cleanup;
 
-    if (qty_c > SIZE_MAX / sizeof(bool))
-        goto cleanup;
-    ladder_ctx->prev_scan_vals.Cdh = calloc(qty_c, sizeof(bool));
-    if (ladder_ctx->prev_scan_vals.Cdh == NULL)
+    LADDER_HISTORY(ladder_ctx, Cd) = calloc(ladder_history_size(qty_c), 1);
+    if (LADDER_HISTORY(ladder_ctx, Cd) == NULL)
         goto cleanup;
 
     if (qty_c > SIZE_MAX / sizeof(bool))
@@ -391,10 +525,8 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
     if (ladder_ctx->memory.Cd == NULL)
         goto cleanup;
 
-    if (qty_t > SIZE_MAX / sizeof(bool))
-        goto cleanup;
-    ladder_ctx->prev_scan_vals.Trh = calloc(qty_t, sizeof(bool));
-    if (ladder_ctx->prev_scan_vals.Trh == NULL)
+    LADDER_HISTORY(ladder_ctx, Tr) = calloc(ladder_history_size(qty_t), 1);
+    if (LADDER_HISTORY(ladder_ctx, Tr) == NULL)
         goto cleanup;
 
     if (qty_t > SIZE_MAX / sizeof(bool))
@@ -403,10 +535,8 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
     if (ladder_ctx->memory.Tr == NULL)
         goto cleanup;
 
-    if (qty_t > SIZE_MAX / sizeof(bool))
-        goto cleanup;
-    ladder_ctx->prev_scan_vals.Tdh = calloc(qty_t, sizeof(bool));
-    if (ladder_ctx->prev_scan_vals.Tdh == NULL)
+    LADDER_HISTORY(ladder_ctx, Td) = calloc(ladder_history_size(qty_t), 1);
+    if (LADDER_HISTORY(ladder_ctx, Td) == NULL)
         goto cleanup;
 
     if (qty_t > SIZE_MAX / sizeof(bool))
@@ -466,30 +596,14 @@ bool ladder_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t net_columns_qty, uint8_t
 bool ladder_ctx_deinit(ladder_ctx_t *ladder_ctx) {
     ladder_clear_memory(ladder_ctx);
     ladder_clear_program(ladder_ctx);
+#ifdef OPTIONAL_PARALLEL
+    ladder_parallel_pool_free(ladder_ctx);
+#endif
 
     // Free networks, including cells and their data
     if (ladder_ctx->network != NULL) {
-        for (uint32_t nt = 0; nt < ladder_ctx->ladder.quantity.networks; nt++) {
-            for (uint32_t r = 0; r < ladder_ctx->network[nt].rows; r++) {
-                for (uint32_t c = 0; c < ladder_ctx->network[nt].cols; c++) {
-                    if (ladder_ctx->network[nt].cells[r][c].data != NULL) {
-                        // Free any allocated strings (cstr) before freeing the data array
-                        // This prevents memory leaks from strdup calls in other parts of the code (e.g., JSON parsing)
-                        for (uint32_t d = 0; d < ladder_ctx->network[nt].cells[r][c].data_qty; d++) {
-                            if (ladder_ctx->network[nt].cells[r][c].data[d].type == LADDER_REGISTER_S&&
-                            ladder_ctx->network[nt].cells[r][c].data[d].value.cstr != NULL) {
-                                free((void*) ladder_ctx->network[nt].cells[r][c].data[d].value.cstr);
-                                ladder_ctx->network[nt].cells[r][c].data[d].value.cstr = NULL; // Prevent dangling pointer
-                            }
-                        }
-                        free(ladder_ctx->network[nt].cells[r][c].data);
-                        ladder_ctx->network[nt].cells[r][c].data = NULL;
-                    }
-                }
-                free(ladder_ctx->network[nt].cells[r]);
-            }
-            free(ladder_ctx->network[nt].cells);
-        }
+        for (uint32_t nt = 0; nt < ladder_ctx->ladder.quantity.networks; nt++)
+            ladder_network_free(&ladder_ctx->network[nt]);
         free(ladder_ctx->network);
     }
 
@@ -504,16 +618,16 @@ bool ladder_ctx_deinit(ladder_ctx_t *ladder_ctx) {
     free(ladder_ctx->memory.Td);
     ladder_ctx->memory.Td = NULL;
 
-    free(ladder_ctx->prev_scan_vals.Mh);
-    ladder_ctx->prev_scan_vals.Mh = NULL;
-    free(ladder_ctx->prev_scan_vals.Crh);
-    ladder_ctx->prev_scan_vals.Crh = NULL;
-    free(ladder_ctx->prev_scan_vals.Cdh);
-    ladder_ctx->prev_scan_vals.Cdh = NULL;
-    free(ladder_ctx->prev_scan_vals.Trh);
-    ladder_ctx->prev_scan_vals.Trh = NULL;
-    free(ladder_ctx->prev_scan_vals.Tdh);
-    ladder_ctx->prev_scan_vals.Tdh = NULL;
+    free(LADDER_HISTORY(ladder_ctx, M));
+    LADDER_HISTORY(ladder_ctx, M) = NULL;
+    free(LADDER_HISTORY(ladder_ctx, Cr));
+    LADDER_HISTORY(ladder_ctx, Cr) = NULL;
+    free(LADDER_HISTORY(ladder_ctx, Cd));
+    LADDER_HISTORY(ladder_ctx, Cd) = NULL;
+    free(LADDER_HISTORY(ladder_ctx, Tr));
+    LADDER_HISTORY(ladder_ctx, Tr) = NULL;
+    free(LADDER_HISTORY(ladder_ctx, Td));
+    LADDER_HISTORY(ladder_ctx, Td) = NULL;
 
     free(ladder_ctx->registers.C);
     ladder_ctx->registers.C = NULL;
@@ -532,6 +646,8 @@ bool ladder_ctx_deinit(ladder_ctx_t *ladder_ctx) {
     }
     free(ladder_ctx->foreign.fn);
     ladder_ctx->foreign.fn = NULL;
+    free(ladder_ctx->custom);
+    ladder_ctx->custom = NULL;
 
     for (uint32_t f = 0; f < ladder_ctx->hw.io.fn_read_qty; f++) {
         if (ladder_ctx->hw.io.init_read[f]) {
@@ -635,6 +751,11 @@ bool ladder_add_read_fn(ladder_ctx_t *ladder_ctx, _io_read read, _io_init read_i
     }
 
     ladder_ctx->hw.io.fn_read_qty = new_qty;
+    // module arrays were reallocated: operands bound by the compiler are stale and the program must be checked again
+#ifdef OPTIONAL_COMPILED
+    ladder_compiled_free(ladder_ctx);
+#endif
+    ladder_ctx->ladder.sealed = false;
     return true;
 }
 
@@ -699,6 +820,11 @@ bool ladder_add_write_fn(ladder_ctx_t *ladder_ctx, _io_write write, _io_init wri
     }
 
     ladder_ctx->hw.io.fn_write_qty = new_qty;
+    // module arrays were reallocated: operands bound by the compiler are stale and the program must be checked again
+#ifdef OPTIONAL_COMPILED
+    ladder_compiled_free(ladder_ctx);
+#endif
+    ladder_ctx->ladder.sealed = false;
     return true;
 }
 
@@ -737,6 +863,43 @@ bool ladder_add_foreign(ladder_ctx_t *ladder_ctx, _foreign_fn_init fn_init, void
     ladder_ctx->foreign.fn = tmp_fn;
     memcpy(&(ladder_ctx->foreign.fn[ladder_ctx->foreign.qty]), &fn_new, sizeof(ladder_foreign_function_t));
     ++ladder_ctx->foreign.qty;
+    // foreign descriptions are part of the checked program
+    ladder_ctx->ladder.sealed = false;
+
+    return true;
+}
+
+bool ladder_add_instruction(ladder_ctx_t *ladder_ctx, const ladder_custom_t *instruction) {
+    if (ladder_ctx == NULL || instruction == NULL || instruction->exec == NULL)
+        return false;
+
+    if (instruction->code < LADDER_INS_CUSTOM || instruction->code >= LADDER_INS_CUSTOM + LADDER_CUSTOM_MAX
+            || instruction->description.cells < 1 || instruction->description.cells > LADDER_MAX_ROWS
+            || instruction->description.data_qty > LADDER_CUSTOM_DATA) {
+        ladder_ctx->ladder.last.err = LADDER_INS_ERR_OUTOFRANGE;
+        return false;
+    }
+
+    for (uint32_t d = 0; d < instruction->description.data_qty; d++)
+        if (instruction->signature[d] > LADDER_SIG_WRITE) {
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_OUTOFRANGE;
+            return false;
+        }
+
+    if (ladder_ctx->custom == NULL && (ladder_ctx->custom = calloc(LADDER_CUSTOM_MAX, sizeof(ladder_custom_t))) == NULL)
+        return false;
+
+    // a code is registered once: compiled programs keep the function
+    ladder_custom_t *custom = &ladder_ctx->custom[instruction->code - LADDER_INS_CUSTOM];
+    if (custom->exec != NULL) {
+        ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+        return false;
+    }
+
+    // cells holding the code were invalid until now
+    ladder_program_changed(ladder_ctx);
+    memcpy(custom, instruction, sizeof(ladder_custom_t));
+    custom->name[sizeof(custom->name) - 1] = '\0';
 
     return true;
 }
@@ -772,6 +935,13 @@ bool ladder_fn_cell(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t row, ui
             ladder_ctx->ladder.last.err = LADDER_INS_ERR_NOFOREIGN;
             return false;
         } else memcpy(&actual_ioc, &(ladder_ctx->foreign.fn[foreign_id]).description, sizeof(ladder_instructions_iocd_t));
+    } else if (function >= LADDER_INS_INV) {
+        const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, function);
+        if (custom == NULL) {
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+            return false;
+        }
+        memcpy(&actual_ioc, &custom->description, sizeof(ladder_instructions_iocd_t));
     } else memcpy(&actual_ioc, &(ladder_fn_iocd[function]), sizeof(ladder_instructions_iocd_t));
 
     // Safe check for multi-cell span to avoid overflow: cells > available rows from row.
@@ -788,21 +958,11 @@ bool ladder_fn_cell(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t row, ui
         }
     }
 
+    ladder_program_changed(ladder_ctx);
+
     // After validation, free any existing data on all spanned cells (defensive)
-    for (uint8_t r = 0; r < actual_ioc.cells; r++) {
-        if (ladder_ctx->network[network].cells[row + r][column].data != NULL) {
-            for (uint32_t d = 0; d < ladder_ctx->network[network].cells[row + r][column].data_qty; d++) {
-                if (ladder_ctx->network[network].cells[row + r][column].data[d].type == LADDER_REGISTER_S&&
-                ladder_ctx->network[network].cells[row + r][column].data[d].value.cstr != NULL) {
-                    free((void*) ladder_ctx->network[network].cells[row + r][column].data[d].value.cstr);
-                    ladder_ctx->network[network].cells[row + r][column].data[d].value.cstr = NULL;
-                }
-            }
-            free(ladder_ctx->network[network].cells[row + r][column].data);
-            ladder_ctx->network[network].cells[row + r][column].data = NULL;
-            ladder_ctx->network[network].cells[row + r][column].data_qty = 0;
-        }
-    }
+    for (uint8_t r = 0; r < actual_ioc.cells; r++)
+        ladder_cell_data_free(&ladder_ctx->network[network], &ladder_ctx->network[network].cells[row + r][column]);
 
     ladder_ctx->network[network].cells[row][column].code = function;
     ladder_ctx->network[network].cells[row][column].data_qty = actual_ioc.data_qty;
@@ -840,3 +1000,81 @@ bool ladder_fn_cell(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t row, ui
 
     return true;
 }
+
+bool ladder_set_engine(ladder_ctx_t *ladder_ctx, ladder_scan_engine_t engine) {
+    if (ladder_ctx == NULL)
+        return false;
+
+    switch (engine) {
+        case LADDER_ENGINE_INTERPRETER:
+#ifdef OPTIONAL_COMPILED
+        case LADDER_ENGINE_COMPILED:
+        case LADDER_ENGINE_INCREMENTAL:
+#endif
+#ifdef OPTIONAL_PARALLEL
+        case LADDER_ENGINE_PARALLEL:
+#endif
+#ifdef OPTIONAL_JIT
+        case LADDER_ENGINE_JIT:
+#endif
+            break;
+        case LADDER_ENGINE_GENERATED:
+            if (ladder_ctx->generated != NULL)
+                break;
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_NULL;
+            return false;
+        default:
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_OUTOFRANGE;
+            return false;
+    }
+
+    ladder_ctx->ladder.engine = engine;
+
+    return true;
+}
+
+#ifdef OPTIONAL_PARALLEL
+bool ladder_set_workers(ladder_ctx_t *ladder_ctx, uint32_t workers) {
+    if (ladder_ctx == NULL)
+        return false;
+
+    ladder_parallel_pool_free(ladder_ctx);
+    ladder_ctx->ladder.workers = workers;
+
+    return true;
+}
+#endif
+
+#ifdef OPTIONAL_JIT
+bool ladder_set_jit_check(ladder_ctx_t *ladder_ctx, bool check) {
+    if (ladder_ctx == NULL)
+        return false;
+
+    ladder_ctx->ladder.jit_check = check;
+
+    return true;
+}
+#endif
+
+bool ladder_set_generated(ladder_ctx_t *ladder_ctx, _generated_scan scan) {
+    if (ladder_ctx == NULL)
+        return false;
+
+    ladder_ctx->generated = scan;
+    if (scan == NULL && ladder_ctx->ladder.engine == LADDER_ENGINE_GENERATED)
+        ladder_ctx->ladder.engine = LADDER_ENGINE_INTERPRETER;
+
+    return true;
+}
+
+void ladder_program_changed(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL)
+        return;
+
+    // the program has to be checked again before running unchecked
+    ladder_ctx->ladder.sealed = false;
+    ladder_topology_free(ladder_ctx);
+#ifdef OPTIONAL_COMPILED
+    ladder_compiled_free(ladder_ctx);
+#endif
+}
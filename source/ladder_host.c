@@ -0,0 +1,385 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_HOST
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ladder_host.h"
+
+#define LADDER_HOST_IDLE_US  1000       // longest sleep of an idle worker
+#define LADDER_HOST_STEAL_US 200        // lateness after which an idle worker takes a scan owned by another worker
+#define LADDER_HOST_NEVER    UINT64_MAX // release time of ended contexts
+
+typedef struct ladder_host_slot_s {
+    _Atomic(ladder_ctx_t*) ctx;     /**< Context (NULL: free slot) */
+               atomic_bool busy;    /**< Claimed by a worker or by add, remove and stats */
+               atomic_uint waiters; /**< Add, remove or stats waiting for the slot: workers leave it alone */
+         _Atomic(uint64_t) release; /**< Next release time in us */
+                  uint32_t owner;   /**< Worker owning the context */
+       ladder_host_stats_t stats;   /**< Statistics (updated while claimed) */
+} ladder_host_slot_t;
+
+typedef struct ladder_host_worker_s {
+     ladder_host_t *host;
+          uint32_t index;
+          uint32_t contexts; /**< Contexts owned (protected by host lock) */
+         pthread_t thread;
+} ladder_host_worker_t;
+
+struct ladder_host_s {
+                uint32_t workers_qty;  /**< Worker threads */
+    ladder_host_worker_t *worker;      /**< Worker threads */
+                uint32_t contexts_qty; /**< Slots */
+      ladder_host_slot_t *slot;        /**< Contexts */
+         pthread_mutex_t lock;         /**< Serializes add and remove */
+             atomic_bool quit;         /**< Stop workers */
+};
+
+static uint64_t ladder_host_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000ULL + (uint64_t) ts.tv_nsec / 1000ULL;
+}
+
+static bool ladder_host_claim(ladder_host_slot_t *slot) {
+    bool expected = false;
+    return atomic_compare_exchange_strong_explicit(&slot->busy, &expected, true, memory_order_acquire, memory_order_relaxed);
+}
+
+static void ladder_host_release(ladder_host_slot_t *slot) {
+    atomic_store_explicit(&slot->busy, false, memory_order_release);
+}
+
+// Claim a slot used by add, remove and stats: a running scan ends first
+static void ladder_host_wait(ladder_host_slot_t *slot) {
+    const struct timespec ts = { .tv_sec = 0, .tv_nsec = 50000L };
+
+    atomic_fetch_add_explicit(&slot->waiters, 1, memory_order_relaxed);
+    while (!ladder_host_claim(slot))
+        nanosleep(&ts, NULL);
+    atomic_fetch_sub_explicit(&slot->waiters, 1, memory_order_relaxed);
+}
+
+static ladder_host_slot_t* ladder_host_find(ladder_host_t *host, ladder_ctx_t *ladder_ctx) {
+    for (uint32_t n = 0; n < host->contexts_qty; n++)
+        if (atomic_load_explicit(&host->slot[n].ctx, memory_order_relaxed) == ladder_ctx)
+            return &host->slot[n];
+
+    return NULL;
+}
+
+// Earliest due context: owned ones first, then the late ones of other workers. The slot is returned claimed.
+static ladder_host_slot_t* ladder_host_pick(ladder_host_t *host, uint32_t index, uint64_t now, uint64_t *next) {
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        ladder_host_slot_t *best = NULL;
+        uint64_t best_release = LADDER_HOST_NEVER;
+
+        for (uint32_t n = 0; n < host->contexts_qty; n++) {
+            ladder_host_slot_t *slot = &host->slot[n];
+            if (atomic_load_explicit(&slot->ctx, memory_order_acquire) == NULL || (slot->owner == index) != (pass == 0))
+                continue;
+
+            uint64_t release = atomic_load_explicit(&slot->release, memory_order_relaxed);
+            if (pass == 0 && release < *next)
+                *next = release;
+            if (release > now || (pass == 1 && now - release < LADDER_HOST_STEAL_US))
+                continue;
+            if (release < best_release && !atomic_load_explicit(&slot->busy, memory_order_relaxed)
+                    && atomic_load_explicit(&slot->waiters, memory_order_relaxed) == 0) {
+                best = slot;
+                best_release = release;
+            }
+        }
+
+        if (best != NULL && ladder_host_claim(best)) {
+            // released or scanned by another worker meanwhile
+            if (atomic_load_explicit(&best->ctx, memory_order_acquire) != NULL && atomic_load_explicit(&best->release, memory_order_relaxed) <= now)
+                return best;
+            ladder_host_release(best);
+        }
+    }
+
+    return NULL;
+}
+
+static void ladder_host_scan(ladder_host_slot_t *slot, uint32_t index) {
+    ladder_ctx_t *ladder_ctx = atomic_load_explicit(&slot->ctx, memory_order_acquire);
+    ladder_host_stats_t *stats = &slot->stats;
+    uint64_t release = atomic_load_explicit(&slot->release, memory_order_relaxed);
+    uint64_t period = ladder_ctx->scan_internals.target_scan_ms > 0 ? (uint64_t) ladder_ctx->scan_internals.target_scan_ms * 1000ULL : 0;
+    bool running = ladder_ctx->ladder.state == LADDER_ST_RUNNING;
+
+    uint64_t start = ladder_host_now();
+    bool ok = ladder_task_step(ladder_ctx);
+    uint64_t end = ladder_host_now();
+
+    if (running) {
+        stats->scans++;
+        stats->last_exec_us = end - start;
+        if (stats->last_exec_us > stats->max_exec_us)
+            stats->max_exec_us = stats->last_exec_us;
+        if (start - release > stats->max_late_us)
+            stats->max_late_us = start - release;
+        if (period > 0 && end > release + period)
+            stats->misses++;
+        if (slot->owner != index)
+            stats->stolen++;
+    }
+
+    // next release on the period grid: a late context keeps only the last release already passed
+    if (period == 0) {
+        release = end;
+    } else {
+        release += period;
+        if (end > release + period) {
+            uint64_t drop = (end - release) / period;
+            release += drop * period;
+            if (running)
+                stats->skipped += drop;
+        }
+    }
+
+    if (!ok || ladder_ctx->ladder.state == LADDER_ST_EXIT_TSK) {
+        if (ladder_ctx->ladder.state != LADDER_ST_NULLFN && ladder_ctx->on.end_task != NULL)
+            ladder_ctx->on.end_task(ladder_ctx);
+        stats->ended = true;
+        release = LADDER_HOST_NEVER;
+    }
+
+    atomic_store_explicit(&slot->release, release, memory_order_relaxed);
+}
+
+static void* ladder_host_worker(void *arg) {
+    ladder_host_worker_t *worker = (ladder_host_worker_t*) arg;
+    ladder_host_t *host = worker->host;
+
+    while (!atomic_load_explicit(&host->quit, memory_order_acquire)) {
+        uint64_t now = ladder_host_now();
+        uint64_t next = now + LADDER_HOST_IDLE_US;
+
+        ladder_host_slot_t *slot = ladder_host_pick(host, worker->index, now, &next);
+        if (slot != NULL) {
+            ladder_host_scan(slot, worker->index);
+            ladder_host_release(slot);
+            continue;
+        }
+
+        // sleep until the next owned release
+        if (next > now) {
+            uint64_t sleep_us = next - now;
+            struct timespec ts = { .tv_sec = 0, .tv_nsec = (long) (sleep_us > LADDER_HOST_IDLE_US ? LADDER_HOST_IDLE_US : sleep_us) * 1000L };
+            nanosleep(&ts, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+ladder_host_t* ladder_host_init(uint32_t workers, uint32_t contexts_qty) {
+    if (contexts_qty == 0)
+        return NULL;
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1)
+        online = 1;
+    if (workers == 0)
+        workers = (uint32_t) online;
+
+    ladder_host_t *host = calloc(1, sizeof(ladder_host_t));
+    if (host == NULL)
+        return NULL;
+    host->worker = calloc(workers, sizeof(ladder_host_worker_t));
+    host->slot = calloc(contexts_qty, sizeof(ladder_host_slot_t));
+    if (host->worker == NULL || host->slot == NULL || pthread_mutex_init(&host->lock, NULL) != 0) {
+        free(host->worker);
+        free(host->slot);
+        free(host);
+        return NULL;
+    }
+
+    host->contexts_qty = contexts_qty;
+    for (uint32_t n = 0; n < contexts_qty; n++) {
+        atomic_init(&host->slot[n].ctx, NULL);
+        atomic_init(&host->slot[n].busy, false);
+        atomic_init(&host->slot[n].waiters, 0);
+        atomic_init(&host->slot[n].release, LADDER_HOST_NEVER);
+    }
+    atomic_init(&host->quit, false);
+
+    for (uint32_t t = 0; t < workers; t++) {
+        host->worker[t].host = host;
+        host->worker[t].index = t;
+        if (pthread_create(&host->worker[t].thread, NULL, ladder_host_worker, &host->worker[t]) != 0)
+            break;
+#ifdef __linux__
+        cpu_set_t cpu;
+        CPU_ZERO(&cpu);
+        CPU_SET(t % (uint32_t) online, &cpu);
+        pthread_setaffinity_np(host->worker[t].thread, sizeof(cpu_set_t), &cpu);
+#endif
+        host->workers_qty++;
+    }
+
+    if (host->workers_qty == 0) {
+        ladder_host_deinit(host);
+        return NULL;
+    }
+
+    return host;
+}
+
+void ladder_host_deinit(ladder_host_t *host) {
+    if (host == NULL)
+        return;
+
+    atomic_store_explicit(&host->quit, true, memory_order_release);
+    for (uint32_t t = 0; t < host->workers_qty; t++)
+        pthread_join(host->worker[t].thread, NULL);
+
+    pthread_mutex_destroy(&host->lock);
+    free(host->worker);
+    free(host->slot);
+    free(host);
+}
+
+bool ladder_host_add(ladder_host_t *host, ladder_ctx_t *ladder_ctx) {
+    if (host == NULL || ladder_ctx == NULL)
+        return false;
+
+    pthread_mutex_lock(&host->lock);
+    if (ladder_host_find(host, ladder_ctx) != NULL) {
+        pthread_mutex_unlock(&host->lock);
+        return false;
+    }
+
+    ladder_host_slot_t *slot = ladder_host_find(host, NULL);
+    if (slot == NULL) {
+        pthread_mutex_unlock(&host->lock);
+        return false;
+    }
+
+    uint32_t owner = 0;
+    for (uint32_t t = 1; t < host->workers_qty; t++)
+        if (host->worker[t].contexts < host->worker[owner].contexts)
+            owner = t;
+
+    ladder_host_wait(slot);
+    host->worker[owner].contexts++;
+    slot->owner = owner;
+    memset(&slot->stats, 0, sizeof(ladder_host_stats_t));
+    atomic_store_explicit(&slot->release, ladder_host_now(), memory_order_relaxed);
+    atomic_store_explicit(&slot->ctx, ladder_ctx, memory_order_release);
+    ladder_host_release(slot);
+    pthread_mutex_unlock(&host->lock);
+
+    return true;
+}
+
+bool ladder_host_remove(ladder_host_t *host, ladder_ctx_t *ladder_ctx) {
+    if (host == NULL || ladder_ctx == NULL)
+        return false;
+
+    pthread_mutex_lock(&host->lock);
+    ladder_host_slot_t *slot = ladder_host_find(host, ladder_ctx);
+    if (slot == NULL) {
+        pthread_mutex_unlock(&host->lock);
+        return false;
+    }
+
+    ladder_host_wait(slot);
+    atomic_store_explicit(&slot->ctx, NULL, memory_order_relaxed);
+    atomic_store_explicit(&slot->release, LADDER_HOST_NEVER, memory_order_relaxed);
+    host->worker[slot->owner].contexts--;
+    ladder_host_release(slot);
+    pthread_mutex_unlock(&host->lock);
+
+    return true;
+}
+
+bool ladder_host_stop(ladder_host_t *host, ladder_ctx_t *ladder_ctx) {
+    if (host == NULL || ladder_ctx == NULL)
+        return false;
+
+    pthread_mutex_lock(&host->lock);
+    ladder_host_slot_t *slot = ladder_host_find(host, ladder_ctx);
+    if (slot == NULL) {
+        pthread_mutex_unlock(&host->lock);
+        return false;
+    }
+
+    ladder_host_wait(slot);
+    if (!slot->stats.ended)
+        ladder_ctx->ladder.state = LADDER_ST_EXIT_TSK;
+    ladder_host_release(slot);
+    pthread_mutex_unlock(&host->lock);
+
+    return true;
+}
+
+bool ladder_host_stats(ladder_host_t *host, ladder_ctx_t *ladder_ctx, ladder_host_stats_t *stats) {
+    if (host == NULL || ladder_ctx == NULL || stats == NULL)
+        return false;
+
+    pthread_mutex_lock(&host->lock);
+    ladder_host_slot_t *slot = ladder_host_find(host, ladder_ctx);
+    if (slot == NULL) {
+        pthread_mutex_unlock(&host->lock);
+        return false;
+    }
+
+    ladder_host_wait(slot);
+    *stats = slot->stats;
+    ladder_host_release(slot);
+    pthread_mutex_unlock(&host->lock);
+
+    return true;
+}
+
+#endif /* OPTIONAL_HOST */
@@ -0,0 +1,637 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_bind.h"
+#include "ladder_compile.h"
+#include "ladder_incremental.h"
+#include "ladder_topology.h"
+
+#ifdef OPTIONAL_COMPILED
+
+#define LADDER_INC_NO_SLOT UINT32_MAX
+#define LADDER_INC_NO_UNIT UINT32_MAX
+
+#define LADDER_INC_ALWAYS  0x01 /**< Time dependent, edge or internal state: execute on every scan */
+#define LADDER_INC_TIMER   0x02 /**< data[0] is a timer: writes Td, Tr and accumulator */
+#define LADDER_INC_COUNTER 0x04 /**< data[0] is a counter: writes C, Cd and Cr */
+#define LADDER_INC_UNKNOWN 0x08 /**< Reads and writes outside of its operands */
+
+// Operand roles: bit n of read/write refers to data[n]
+static const struct {
+    uint8_t flags;
+    uint8_t read;
+    uint8_t write;
+} ladder_incremental_roles[LADDER_INS_INV] = { //
+        [LADDER_INS_NO]      = { 0, 0x01, 0x00 },                                      //
+        [LADDER_INS_NC]      = { 0, 0x01, 0x00 },                                      //
+        [LADDER_INS_RE]      = { LADDER_INC_ALWAYS, 0x01, 0x00 },                      //
+        [LADDER_INS_FE]      = { LADDER_INC_ALWAYS, 0x01, 0x00 },                      //
+        [LADDER_INS_COIL]    = { 0, 0x00, 0x01 },                                      //
+        [LADDER_INS_COILL]   = { LADDER_INC_ALWAYS, 0x00, 0x01 },                      //
+        [LADDER_INS_COILU]   = { LADDER_INC_ALWAYS, 0x00, 0x01 },                      //
+        [LADDER_INS_TON]     = { LADDER_INC_ALWAYS | LADDER_INC_TIMER, 0x00, 0x00 },   //
+        [LADDER_INS_TOF]     = { LADDER_INC_ALWAYS | LADDER_INC_TIMER, 0x00, 0x00 },   //
+        [LADDER_INS_TP]      = { LADDER_INC_ALWAYS | LADDER_INC_TIMER, 0x00, 0x00 },   //
+        [LADDER_INS_CTU]     = { LADDER_INC_ALWAYS | LADDER_INC_COUNTER, 0x00, 0x00 }, //
+        [LADDER_INS_CTD]     = { LADDER_INC_ALWAYS | LADDER_INC_COUNTER, 0x00, 0x00 }, //
+        [LADDER_INS_MOVE]    = { 0, 0x01, 0x02 },                                      //
+        [LADDER_INS_SUB]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_ADD]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_MUL]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_DIV]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_MOD]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_SHL]     = { 0, 0x03, 0x01 },                                      //
+        [LADDER_INS_SHR]     = { 0, 0x03, 0x01 },                                      //
+        [LADDER_INS_ROL]     = { 0, 0x03, 0x01 },                                      //
+        [LADDER_INS_ROR]     = { 0, 0x03, 0x01 },                                      //
+        [LADDER_INS_AND]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_OR]      = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_XOR]     = { 0, 0x03, 0x04 },                                      //
+        [LADDER_INS_NOT]     = { 0, 0x01, 0x02 },                                      //
+        [LADDER_INS_EQ]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_GT]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_GE]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_LT]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_LE]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_NE]      = { 0, 0x03, 0x00 },                                      //
+        [LADDER_INS_FOREIGN] = { LADDER_INC_ALWAYS | LADDER_INC_UNKNOWN, 0x00, 0x00 }, //
+        [LADDER_INS_TMOVE]   = { LADDER_INC_ALWAYS | LADDER_INC_UNKNOWN, 0x00, 0x00 }, //
+        };
+
+typedef struct ladder_incremental_list_s {
+    uint32_t qty;
+    uint32_t size;
+    uint32_t *value;
+} ladder_incremental_list_t;
+
+static bool ladder_incremental_push(ladder_incremental_list_t *list, uint32_t value) {
+    if (list->qty == list->size) {
+        uint32_t new_size = list->size == 0 ? 64 : list->size * 2;
+        uint32_t *tmp = realloc(list->value, new_size * sizeof(uint32_t));
+        if (tmp == NULL)
+            return false;
+        list->value = tmp;
+        list->size = new_size;
+    }
+    list->value[list->qty++] = value;
+
+    return true;
+}
+
+static void ladder_incremental_region(ladder_incremental_t *incremental, void *base, uint32_t stride, uint32_t size, uint32_t qty) {
+    ladder_incremental_region_t *region = &incremental->region[incremental->regions_qty++];
+    region->base = (uint8_t*) base;
+    region->stride = stride;
+    region->size = size;
+    region->qty = (base == NULL) ? 0 : qty;
+    region->slot = incremental->slots_qty;
+    region->shadow = 0;
+    incremental->slots_qty += region->qty;
+}
+
+// Slot of a register address (as returned by the operand binder)
+static uint32_t ladder_incremental_slot(const ladder_incremental_t *incremental, const void *ptr) {
+    const uint8_t *p = (const uint8_t*) ptr;
+
+    for (uint32_t n = 0; n < incremental->regions_qty; n++) {
+        const ladder_incremental_region_t *region = &incremental->region[n];
+        if (region->qty == 0 || p < region->base || p >= region->base + (size_t) region->stride * region->qty)
+            continue;
+        if ((size_t) (p - region->base) % region->stride != 0)
+            continue;
+        return region->slot + (uint32_t) ((size_t) (p - region->base) / region->stride);
+    }
+
+    return LADDER_INC_NO_SLOT;
+}
+
+static const ladder_incremental_region_t* ladder_incremental_slot_region(const ladder_incremental_t *incremental, uint32_t slot) {
+    for (uint32_t n = 0; n < incremental->regions_qty; n++)
+        if (slot >= incremental->region[n].slot && slot < incremental->region[n].slot + incremental->region[n].qty)
+            return &incremental->region[n];
+
+    return NULL;
+}
+
+// Register slots of the timer or counter addressed by data[0] of TON/TOF/TP/CTU/CTD. False if an index is not valid.
+static bool ladder_incremental_block(ladder_ctx_t *ladder_ctx, const ladder_incremental_t *incremental, const ladder_cell_t *cell, bool timer,
+        uint32_t slot[3]) {
+    const ladder_register_t timer_regs[3] = { LADDER_REGISTER_Td, LADDER_REGISTER_Tr, LADDER_REGISTER_T };
+    const ladder_register_t counter_regs[3] = { LADDER_REGISTER_Cd, LADDER_REGISTER_Cr, LADDER_REGISTER_C };
+
+    if (cell->data == NULL || cell->data_qty < 1)
+        return false;
+
+    for (uint32_t n = 0; n < 3; n++) {
+        ladder_value_t value = cell->data[0];
+        ladder_operand_t operand;
+        value.type = timer ? timer_regs[n] : counter_regs[n];
+        if (!ladder_bind_read(ladder_ctx, &value, &operand) || operand.ptr == NULL)
+            return false;
+        slot[n] = ladder_incremental_slot(incremental, operand.ptr);
+        if (slot[n] == LADDER_INC_NO_SLOT)
+            return false;
+    }
+
+    return true;
+}
+
+// Instructions returning an error from the operand types (the scan is aborted on every execution)
+static bool ladder_incremental_faults(ladder_ctx_t *ladder_ctx, const ladder_cell_t *cell) {
+    ladder_operand_t operand;
+
+    switch (cell->code) {
+        case LADDER_INS_SHL:
+        case LADDER_INS_SHR:
+        case LADDER_INS_ROL:
+        case LADDER_INS_ROR:
+            if (cell->data == NULL || cell->data_qty < 1)
+                return true;
+            ladder_bind_write(ladder_ctx, &cell->data[0], &operand);
+            return operand.ptr == NULL;
+        case LADDER_INS_MOVE: {
+            if (cell->data == NULL || cell->data_qty < 2)
+                return true;
+            ladder_register_t src = cell->data[0].type;
+            ladder_register_t dst = cell->data[1].type;
+            bool src_int = src == LADDER_REGISTER_D || src == LADDER_REGISTER_IW || src == LADDER_REGISTER_QW || src == LADDER_REGISTER_C
+                    || src == LADDER_REGISTER_T;
+            bool dst_int = dst == LADDER_REGISTER_D || dst == LADDER_REGISTER_IW || dst == LADDER_REGISTER_QW || dst == LADDER_REGISTER_C
+                    || dst == LADDER_REGISTER_T;
+            if (src == LADDER_REGISTER_R && (uint32_t) cell->data[0].value.i32 >= ladder_ctx->ladder.quantity.r)
+                return true;
+            if (src_int ? !dst_int : (src != LADDER_REGISTER_R || dst != LADDER_REGISTER_R))
+                return true;
+            ladder_bind_write(ladder_ctx, &cell->data[1], &operand);
+            return operand.ptr == NULL;
+        }
+        default:
+            return false;
+    }
+}
+
+// Collect read and write slots of one cell
+static bool ladder_incremental_cell(ladder_ctx_t *ladder_ctx, ladder_incremental_t *incremental, uint32_t unit_index, const ladder_cell_t *cell,
+        ladder_incremental_list_t *pairs, ladder_incremental_list_t *writes) {
+    ladder_incremental_unit_t *unit = &incremental->unit[unit_index];
+    uint8_t flags, read_mask, write_mask;
+
+    if (cell->code < LADDER_INS_INV) {
+        flags = ladder_incremental_roles[cell->code].flags;
+        read_mask = ladder_incremental_roles[cell->code].read;
+        write_mask = ladder_incremental_roles[cell->code].write;
+    } else {
+        // custom instructions: roles from the operand signature, internal state with side effects
+        const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, cell->code);
+        flags = custom->side_effects ? LADDER_INC_ALWAYS : 0;
+        read_mask = write_mask = 0;
+        for (uint32_t d = 0; d < custom->description.data_qty; d++) {
+            if (custom->signature[d] == LADDER_SIG_READ)
+                read_mask |= 1 << d;
+            else if (custom->signature[d] == LADDER_SIG_WRITE)
+                write_mask |= 1 << d;
+            else
+                flags |= LADDER_INC_ALWAYS | LADDER_INC_UNKNOWN;
+        }
+    }
+
+    if (flags & LADDER_INC_ALWAYS)
+        unit->always = true;
+    if (flags & LADDER_INC_UNKNOWN)
+        unit->unknown_writes = true;
+    if (ladder_incremental_faults(ladder_ctx, cell)) {
+        unit->always = true;
+        unit->unresolved = true;
+    }
+
+    if (flags & (LADDER_INC_TIMER | LADDER_INC_COUNTER)) {
+        uint32_t slot[3];
+        if (!ladder_incremental_block(ladder_ctx, incremental, cell, (flags & LADDER_INC_TIMER) != 0, slot)) {
+            unit->unknown_writes = true;
+        } else {
+            for (uint32_t n = 0; n < 3; n++)
+                if (!ladder_incremental_push(pairs, slot[n]) || !ladder_incremental_push(pairs, unit_index << 1) || !ladder_incremental_push(writes, slot[n]))
+                    return false;
+        }
+    }
+
+    for (uint32_t d = 0; d < 8; d++) {
+        bool read = (read_mask >> d) & 1;
+        bool write = (write_mask >> d) & 1;
+        ladder_operand_t operand;
+
+        if (!read && !write)
+            continue;
+
+        if (cell->data == NULL || d >= cell->data_qty) {
+            // missing operands read as 0, writes are not predictable
+            if (write) {
+                unit->always = true;
+                unit->unknown_writes = true;
+            }
+            continue;
+        }
+
+        if (read) {
+            // operands with error paths report them on every scan
+            if (!ladder_bind_read(ladder_ctx, &cell->data[d], &operand)) {
+                unit->always = true;
+                unit->unresolved = true;
+            } else if (operand.ptr != NULL) {
+                uint32_t slot = ladder_incremental_slot(incremental, operand.ptr);
+                if (slot == LADDER_INC_NO_SLOT) {
+                    unit->always = true;
+                    unit->unresolved = true;
+                } else if (!ladder_incremental_push(pairs, slot) || !ladder_incremental_push(pairs, (unit_index << 1) | 1)) {
+                    return false;
+                }
+            }
+        }
+
+        if (write) {
+            ladder_bind_write(ladder_ctx, &cell->data[d], &operand);
+            if (operand.ptr == NULL) {
+                // custom instructions may report the failed write
+                if (cell->code >= LADDER_INS_INV) {
+                    unit->always = true;
+                    unit->unresolved = true;
+                }
+                continue;
+            }
+            uint32_t slot = ladder_incremental_slot(incremental, operand.ptr);
+            if (slot == LADDER_INC_NO_SLOT) {
+                unit->unknown_writes = true;
+                continue;
+            }
+            if (!ladder_incremental_push(pairs, slot) || !ladder_incremental_push(pairs, unit_index << 1) || !ladder_incremental_push(writes, slot))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// A multi cell instruction owned by a row above the rung joins the rung to the previous unit: it shares cell states with it
+static bool ladder_incremental_joined(const ladder_network_t *net, const ladder_topology_rung_t *rung) {
+    for (uint32_t row = rung->row_start; row <= rung->row_end; row++) {
+        for (uint32_t column = 0; column < net->cols; column++) {
+            if (net->cells[row][column].code != LADDER_INS_MULTI)
+                continue;
+            uint32_t owner = row;
+            while (owner > 0 && net->cells[owner][column].code == LADDER_INS_MULTI)
+                owner--;
+            if (owner < rung->row_start || net->cells[owner][column].code == LADDER_INS_MULTI)
+                return true;
+        }
+    }
+
+    return false;
+}
+
+static bool ladder_incremental_network(ladder_ctx_t *ladder_ctx, ladder_incremental_t *incremental, const ladder_compiled_t *compiled, uint32_t n,
+        ladder_incremental_list_t *pairs, ladder_incremental_list_t *writes) {
+    ladder_incremental_network_t *inet = &incremental->network[n];
+    const ladder_compiled_network_t *cnet = &compiled->network[n];
+    ladder_network_t *net = &ladder_ctx->network[n];
+
+    inet->unit_first = incremental->units_qty;
+    inet->units_qty = 0;
+    inet->full = cnet->interpreted || net->cells == NULL;
+    if (inet->full)
+        return true;
+
+    // invalid code aborts the scan where the interpreter does: keep the network whole
+    for (uint32_t o = 0; o < cnet->ops_qty; o++)
+        if (cnet->ops[o].op == LADDER_OP_INV) {
+            inet->full = true;
+            return true;
+        }
+
+    const ladder_topology_network_t *tnet = ladder_topology_get(ladder_ctx, n);
+    if (tnet == NULL)
+        return false;
+
+    uint32_t op = 0, reach = 0;
+    ladder_incremental_unit_t *unit = NULL;
+    for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+        const ladder_topology_rung_t *rung = &tnet->rung[r];
+        uint32_t first_op = op;
+
+        while (op < cnet->ops_qty && cnet->ops[op].op != LADDER_OP_RUNG_END)
+            op++;
+        if (op == cnet->ops_qty) {
+            inet->full = true;
+            return true;
+        }
+
+        // vertical groups of a rung may reach rows of the next ones: their merge writes those cell states
+        if (unit == NULL || (rung->row_start > reach && !ladder_incremental_joined(net, rung))) {
+            if (unit != NULL)
+                unit->row_end = rung->row_start - 1;
+            unit = &incremental->unit[incremental->units_qty++];
+            memset(unit, 0, sizeof(ladder_incremental_unit_t));
+            unit->network = n;
+            unit->first_op = first_op;
+            unit->row_start = (inet->units_qty == 0) ? 0 : rung->row_start;
+            unit->writes_start = writes->qty;
+            inet->units_qty++;
+        }
+        unit->last_op = op++;
+        unit->row_end = net->rows - 1;
+        if (rung->row_end > reach)
+            reach = rung->row_end;
+        for (uint32_t column = 0; column < rung->live_end; column++)
+            if (rung->column[column].group_end > reach)
+                reach = rung->column[column].group_end;
+
+        // rows below a multi-cell instruction on column 0 belong to no rung but are executed with the rung above them
+        uint32_t row_first = (r == 0) ? 0 : rung->row_start;
+        uint32_t row_last = (r + 1 < tnet->rungs_qty) ? tnet->rung[r + 1].row_start - 1 : net->rows - 1;
+        for (uint32_t row = row_first; row <= row_last; row++)
+            for (uint32_t column = 0; column < net->cols; column++) {
+                const ladder_cell_t *cell = &net->cells[row][column];
+                if (cell->code >= LADDER_INS_INV && ladder_custom_get(ladder_ctx, cell->code) == NULL)
+                    continue;
+                if (!ladder_incremental_cell(ladder_ctx, incremental, incremental->units_qty - 1, cell, pairs, writes))
+                    return false;
+            }
+        unit->writes_qty = writes->qty - unit->writes_start;
+    }
+
+    return true;
+}
+
+ladder_incremental_t* ladder_incremental_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled) {
+    ladder_incremental_list_t pairs = { 0 }, writes = { 0 };
+    uint32_t read_qty = ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0;
+    uint32_t write_qty = ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0;
+    uint32_t rungs_qty = 0;
+
+    ladder_incremental_t *incremental = calloc(1, sizeof(ladder_incremental_t));
+    if (incremental == NULL)
+        return NULL;
+
+    for (uint32_t n = 0; n < compiled->networks_qty; n++) {
+        if (ladder_ctx->network[n].cells == NULL)
+            continue;
+        const ladder_topology_network_t *tnet = ladder_topology_get(ladder_ctx, n);
+        if (tnet == NULL)
+            goto fail;
+        rungs_qty += tnet->rungs_qty;
+    }
+
+    incremental->region = calloc(9 + 2 * (read_qty + write_qty), sizeof(ladder_incremental_region_t));
+    incremental->unit = calloc(rungs_qty + 1, sizeof(ladder_incremental_unit_t));
+    incremental->network = calloc(compiled->networks_qty, sizeof(ladder_incremental_network_t));
+    if (incremental->region == NULL || incremental->unit == NULL || incremental->network == NULL)
+        goto fail;
+    incremental->networks_qty = compiled->networks_qty;
+
+    ladder_incremental_region(incremental, ladder_ctx->memory.M, sizeof(uint8_t), sizeof(uint8_t), ladder_ctx->ladder.quantity.m);
+    ladder_incremental_region(incremental, ladder_ctx->memory.Cd, sizeof(bool), sizeof(bool), ladder_ctx->ladder.quantity.c);
+    ladder_incremental_region(incremental, ladder_ctx->memory.Cr, sizeof(bool), sizeof(bool), ladder_ctx->ladder.quantity.c);
+    ladder_incremental_region(incremental, ladder_ctx->memory.Td, sizeof(bool), sizeof(bool), ladder_ctx->ladder.quantity.t);
+    ladder_incremental_region(incremental, ladder_ctx->memory.Tr, sizeof(bool), sizeof(bool), ladder_ctx->ladder.quantity.t);
+    ladder_incremental_region(incremental, ladder_ctx->registers.C, sizeof(uint32_t), sizeof(uint32_t), ladder_ctx->ladder.quantity.c);
+    ladder_incremental_region(incremental, ladder_ctx->timers == NULL ? NULL : &ladder_ctx->timers[0].acc, sizeof(ladder_timer_t), sizeof(uint32_t),
+            ladder_ctx->ladder.quantity.t);
+    ladder_incremental_region(incremental, ladder_ctx->registers.D, sizeof(int32_t), sizeof(int32_t), ladder_ctx->ladder.quantity.d);
+    ladder_incremental_region(incremental, ladder_ctx->registers.R, sizeof(float), sizeof(float), ladder_ctx->ladder.quantity.r);
+    for (uint32_t module = 0; module < read_qty; module++) {
+        ladder_incremental_region(incremental, ladder_ctx->input[module].I, sizeof(uint8_t), sizeof(uint8_t), ladder_ctx->input[module].i_qty);
+        ladder_incremental_region(incremental, ladder_ctx->input[module].IW, sizeof(int32_t), sizeof(int32_t), ladder_ctx->input[module].iw_qty);
+    }
+    for (uint32_t module = 0; module < write_qty; module++) {
+        ladder_incremental_region(incremental, ladder_ctx->output[module].Q, sizeof(uint8_t), sizeof(uint8_t), ladder_ctx->output[module].q_qty);
+        ladder_incremental_region(incremental, ladder_ctx->output[module].QW, sizeof(int32_t), sizeof(int32_t), ladder_ctx->output[module].qw_qty);
+    }
+
+    size_t shadow_size = 0;
+    for (uint32_t n = 0; n < incremental->regions_qty; n++) {
+        incremental->region[n].shadow = (uint32_t) shadow_size;
+        shadow_size += (size_t) incremental->region[n].size * incremental->region[n].qty;
+    }
+    incremental->shadow = malloc(shadow_size + 1);
+    if (incremental->shadow == NULL)
+        goto fail;
+    for (uint32_t n = 0; n < incremental->regions_qty; n++) {
+        const ladder_incremental_region_t *region = &incremental->region[n];
+        for (uint32_t idx = 0; idx < region->qty; idx++)
+            memcpy(incremental->shadow + region->shadow + idx * region->size, region->base + (size_t) idx * region->stride, region->size);
+    }
+
+    for (uint32_t n = 0; n < compiled->networks_qty; n++)
+        if (!ladder_incremental_network(ladder_ctx, incremental, compiled, n, &pairs, &writes))
+            goto fail;
+
+    // slot users (counting sort of slot/user pairs)
+    incremental->users_start = calloc(incremental->slots_qty + 1, sizeof(uint32_t));
+    incremental->users = malloc((pairs.qty / 2 + 1) * sizeof(uint32_t));
+    incremental->pending = malloc(incremental->units_qty + 1);
+    if (incremental->users_start == NULL || incremental->users == NULL || incremental->pending == NULL)
+        goto fail;
+    for (uint32_t p = 0; p < pairs.qty; p += 2)
+        incremental->users_start[pairs.value[p] + 1]++;
+    for (uint32_t slot = 0; slot < incremental->slots_qty; slot++)
+        incremental->users_start[slot + 1] += incremental->users_start[slot];
+    for (uint32_t p = 0; p < pairs.qty; p += 2)
+        incremental->users[incremental->users_start[pairs.value[p]]++] = pairs.value[p + 1];
+    for (uint32_t slot = incremental->slots_qty; slot > 0; slot--)
+        incremental->users_start[slot] = incremental->users_start[slot - 1];
+    incremental->users_start[0] = 0;
+
+    incremental->writes = writes.value;
+    writes.value = NULL;
+    free(pairs.value);
+
+    // first scan executes everything
+    memset(incremental->pending, 1, incremental->units_qty + 1);
+
+    return incremental;
+
+    fail:
+    free(pairs.value);
+    free(writes.value);
+    ladder_incremental_free(incremental);
+    return NULL;
+}
+
+void ladder_incremental_free(ladder_incremental_t *incremental) {
+    if (incremental == NULL)
+        return;
+
+    free(incremental->region);
+    free(incremental->shadow);
+    free(incremental->users_start);
+    free(incremental->users);
+    free(incremental->writes);
+    free(incremental->unit);
+    free(incremental->pending);
+    free(incremental->network);
+    free(incremental);
+}
+
+/////////////////////////////////////////////////////////////////
+
+// Schedule readers of a changed slot and the other units writing it (they would overwrite the new value)
+static inline void ladder_incremental_mark(ladder_incremental_t *incremental, uint32_t slot, uint32_t self) {
+    for (uint32_t u = incremental->users_start[slot]; u < incremental->users_start[slot + 1]; u++) {
+        uint32_t user = incremental->users[u];
+        if ((user & 1) || (user >> 1) != self)
+            incremental->pending[user >> 1] = 1;
+    }
+}
+
+static inline void ladder_incremental_check(ladder_incremental_t *incremental, const ladder_incremental_region_t *region, uint32_t idx, uint32_t self) {
+    const uint8_t *value = region->base + (size_t) idx * region->stride;
+    uint8_t *shadow = incremental->shadow + region->shadow + (size_t) idx * region->size;
+
+    if (memcmp(value, shadow, region->size) == 0)
+        return;
+
+    memcpy(shadow, value, region->size);
+    ladder_incremental_mark(incremental, region->slot + idx, self);
+}
+
+static void ladder_incremental_detect_all(ladder_incremental_t *incremental, uint32_t self) {
+    for (uint32_t n = 0; n < incremental->regions_qty; n++) {
+        const ladder_incremental_region_t *region = &incremental->region[n];
+        // empty tables keep a NULL base
+        if (region->qty == 0)
+            continue;
+        if (region->stride == region->size && memcmp(region->base, incremental->shadow + region->shadow, (size_t) region->size * region->qty) == 0)
+            continue;
+        for (uint32_t idx = 0; idx < region->qty; idx++)
+            ladder_incremental_check(incremental, region, idx, self);
+    }
+}
+
+static void ladder_incremental_detect_unit(ladder_incremental_t *incremental, uint32_t unit_index) {
+    const ladder_incremental_unit_t *unit = &incremental->unit[unit_index];
+
+    if (unit->unknown_writes) {
+        ladder_incremental_detect_all(incremental, unit_index);
+        return;
+    }
+
+    for (uint32_t w = 0; w < unit->writes_qty; w++) {
+        uint32_t slot = incremental->writes[unit->writes_start + w];
+        const ladder_incremental_region_t *region = ladder_incremental_slot_region(incremental, slot);
+        ladder_incremental_check(incremental, region, slot - region->slot, unit_index);
+    }
+}
+
+
+void ladder_scan_incremental(ladder_ctx_t *ladder_ctx) {
+    // per instruction hook needs every cell (including NOP) visited: keep the interpreter
+    if (ladder_ctx->on.instruction != NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled != NULL && compiled->incremental == NULL)
+        compiled->incremental = ladder_incremental_build(ladder_ctx, compiled);
+    if (compiled == NULL || compiled->incremental == NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+    ladder_incremental_t *incremental = (ladder_incremental_t*) compiled->incremental;
+
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    // registers changed since the previous scan (I/O, application, history)
+    ladder_incremental_detect_all(incremental, LADDER_INC_NO_UNIT);
+    incremental->executed = 0;
+
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks; network++) {
+        ladder_network_t *net = &ladder_ctx->network[network];
+        ladder_incremental_network_t *inet = &incremental->network[network];
+        const ladder_compiled_network_t *cnet = &compiled->network[network];
+
+        if (net->cells == NULL) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);
+            }
+            return;
+        }
+
+        if (!net->enable) {
+            inet->enabled = false;
+            continue;
+        }
+
+        // enabled again: cell states and outputs may be stale
+        if (!inet->enabled) {
+            memset(&incremental->pending[inet->unit_first], 1, inet->units_qty);
+            inet->enabled = true;
+        }
+
+        if (inet->full) {
+            bool ok;
+            if (cnet->interpreted) {
+                ok = ladder_scan_network(ladder_ctx, network);
+            } else {
+                ok = ladder_exec_network(ladder_ctx, network, cnet);
+            }
+            if (!ok)
+                return;
+            ladder_incremental_detect_all(incremental, LADDER_INC_NO_UNIT);
+            continue;
+        }
+
+        for (uint32_t u = inet->unit_first; u < inet->unit_first + inet->units_qty; u++) {
+            if (!incremental->pending[u])
+                continue;
+
+            const ladder_incremental_unit_t *unit = &incremental->unit[u];
+            if (!ladder_exec_rungs(ladder_ctx, network, cnet, &cnet->ops[unit->first_op], &cnet->ops[unit->last_op], unit->row_start, unit->row_end))
+                return;
+
+            incremental->pending[u] = unit->always;
+            incremental->executed++;
+            ladder_incremental_detect_unit(incremental, u);
+        }
+    }
+}
+
+#endif /* OPTIONAL_COMPILED */
@@ -0,0 +1,781 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_JIT
+
+#include "ladder_internals.h"
+#include "ladder_instructions.h"
+#include "ladder_compile.h"
+#include "ladder_jit.h"
+#include "ladder_topology.h"
+
+#ifdef LADDER_JIT_AVAILABLE
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Generated code keeps the context in rbx, the network row pointers in r12, an operand anchor in r13 and the current row in r14.
+// Power flows left to right in cl: the left cell is only read back from memory after a call or when the row changes.
+// Cell states and ladder.last are written exactly as ladder_exec_rungs does, generic instructions are called through jit_call.
+
+#define LADDER_JIT_CELL(column, field) ((int32_t) ((column) * sizeof(ladder_cell_t) + offsetof(ladder_cell_t, field)))
+#define LADDER_JIT_CTX(field)          ((int32_t) offsetof(ladder_ctx_t, field))
+#define LADDER_JIT_FIELD(field)        LADDER_JIT_CTX(field), sizeof(((ladder_ctx_t*) 0)->field)
+
+#define LADDER_JIT_NONE UINT32_MAX // nothing cached
+
+#define LADDER_JIT_EAX 0
+#define LADDER_JIT_ECX 1
+
+typedef struct ladder_jit_buf_s {
+     uint8_t *data;   /**< Code */
+      size_t len;     /**< Code length */
+      size_t cap;     /**< Allocated bytes */
+        bool nomem;   /**< Allocation failed */
+        bool fail;    /**< Operation can't be translated */
+   uintptr_t anchor;  /**< Address in r13 */
+    uint32_t row;     /**< Row pointer in r14 */
+    uint32_t column;  /**< Column of the cells whose state is in cl */
+    uint32_t row_lo;  /**< First row of the cells whose state is in cl */
+    uint32_t row_hi;  /**< Last row of the cells whose state is in cl */
+} ladder_jit_buf_t;
+
+static void jit_bytes(ladder_jit_buf_t *buf, const void *bytes, size_t n) {
+    if (buf->nomem)
+        return;
+
+    if (buf->len + n > buf->cap) {
+        size_t cap = buf->cap == 0 ? 4096 : buf->cap * 2;
+        while (cap < buf->len + n)
+            cap *= 2;
+        uint8_t *data = realloc(buf->data, cap);
+        if (data == NULL) {
+            buf->nomem = true;
+            return;
+        }
+        buf->data = data;
+        buf->cap = cap;
+    }
+
+    memcpy(buf->data + buf->len, bytes, n);
+    buf->len += n;
+}
+
+#define JIT(buf, ...) do {                                    \
+            const uint8_t jit_seq_[] = { __VA_ARGS__ };       \
+            jit_bytes((buf), jit_seq_, sizeof(jit_seq_));     \
+        } while (0)
+
+static inline void jit_u32(ladder_jit_buf_t *buf, uint32_t value) {
+    const uint8_t bytes[4] = { (uint8_t) value, (uint8_t) (value >> 8), (uint8_t) (value >> 16), (uint8_t) (value >> 24) };
+    jit_bytes(buf, bytes, 4);
+}
+
+static inline void jit_u64(ladder_jit_buf_t *buf, uint64_t value) {
+    jit_u32(buf, (uint32_t) value);
+    jit_u32(buf, (uint32_t) (value >> 32));
+}
+
+// jump to an already emitted position
+static void jit_jump(ladder_jit_buf_t *buf, uint8_t cond, size_t target) {
+    if (cond == 0) {
+        JIT(buf, 0xe9);
+    } else {
+        JIT(buf, 0x0f, cond);
+    }
+    jit_u32(buf, (uint32_t) (int32_t) ((int64_t) target - (int64_t) (buf->len + 4)));
+}
+
+// forward jump: returns the displacement to patch
+static size_t jit_jump_forward(ladder_jit_buf_t *buf, uint8_t cond) {
+    JIT(buf, 0x0f, cond);
+    jit_u32(buf, 0);
+
+    return buf->len - 4;
+}
+
+static void jit_patch(ladder_jit_buf_t *buf, size_t at) {
+    if (buf->nomem)
+        return;
+
+    uint32_t rel = (uint32_t) (buf->len - (at + 4));
+    memcpy(buf->data + at, &rel, 4);
+}
+
+// mov <size> [rbx + offset], imm
+static void jit_store_ctx(ladder_jit_buf_t *buf, int32_t offset, size_t size, uint32_t value) {
+    switch (size) {
+        case 1:
+            JIT(buf, 0xc6, 0x83);
+            jit_u32(buf, (uint32_t) offset);
+            JIT(buf, (uint8_t) value);
+            return;
+        case 2:
+            JIT(buf, 0x66, 0xc7, 0x83);
+            jit_u32(buf, (uint32_t) offset);
+            JIT(buf, (uint8_t) value, (uint8_t) (value >> 8));
+            return;
+        case 4:
+            JIT(buf, 0xc7, 0x83);
+            break;
+        case 8:
+            JIT(buf, 0x48, 0xc7, 0x83);
+            break;
+        default:
+            buf->fail = true;
+            return;
+    }
+    jit_u32(buf, (uint32_t) offset);
+    jit_u32(buf, value);
+}
+
+// mov <size> [rbx + offset], eax
+static void jit_store_ctx_eax(ladder_jit_buf_t *buf, int32_t offset, size_t size) {
+    switch (size) {
+        case 1:
+            JIT(buf, 0x88, 0x83);
+            break;
+        case 2:
+            JIT(buf, 0x66, 0x89, 0x83);
+            break;
+        case 4:
+            JIT(buf, 0x89, 0x83);
+            break;
+        default:
+            buf->fail = true;
+            return;
+    }
+    jit_u32(buf, (uint32_t) offset);
+}
+
+// ladder.last as set by LADDER_DISPATCH_LAST
+static void jit_last(ladder_jit_buf_t *buf, uint32_t network, const ladder_op_t *op) {
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.instr), op->code);
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.err), LADDER_INS_ERR_OK);
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.network), network);
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.cell_row), op->row);
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.cell_column), op->column);
+}
+
+// Instruction with a memory operand at an absolute address: [r13 + disp32] near the anchor, [r9] otherwise.
+// prefix: 0x66/0xf3 or 0, reg: ModRM reg field. Immediates follow.
+static void jit_mem(ladder_jit_buf_t *buf, uint8_t prefix, uint8_t opcode0, uint8_t opcode1, uint8_t reg, const void *ptr) {
+    int64_t disp = (int64_t) ((uintptr_t) ptr - buf->anchor);
+    bool near = disp >= INT32_MIN && disp <= INT32_MAX;
+
+    if (!near) {
+        JIT(buf, 0x49, 0xb9);                                       // movabs r9, ptr
+        jit_u64(buf, (uint64_t) (uintptr_t) ptr);
+    }
+    if (prefix != 0)
+        JIT(buf, prefix);
+    JIT(buf, 0x41, opcode0);
+    if (opcode1 != 0)
+        JIT(buf, opcode1);
+    if (near) {
+        JIT(buf, (uint8_t) (0x85 | (reg << 3)));
+        jit_u32(buf, (uint32_t) (int32_t) disp);
+    } else {
+        JIT(buf, (uint8_t) (0x01 | (reg << 3)));
+    }
+}
+
+// r14 = cells[row]
+static void jit_row(ladder_jit_buf_t *buf, uint32_t row) {
+    if (buf->row == row)
+        return;
+
+    JIT(buf, 0x4d, 0x8b, 0xb4, 0x24);                               // mov r14, [r12 + row * 8]
+    jit_u32(buf, row * sizeof(ladder_cell_t*));
+    buf->row = row;
+}
+
+// cl = cells[row][column].state
+static void jit_load_state(ladder_jit_buf_t *buf, uint32_t row, uint32_t column) {
+    jit_row(buf, row);
+    JIT(buf, 0x41, 0x0f, 0xb6, 0x8e);                               // movzx ecx, byte [r14 + state]
+    jit_u32(buf, (uint32_t) LADDER_JIT_CELL(column, state));
+    buf->column = column;
+    buf->row_lo = buf->row_hi = row;
+}
+
+// cl = power from the left cell
+static void jit_left(ladder_jit_buf_t *buf, const ladder_op_t *op) {
+    if (op->column == 0) {
+        JIT(buf, 0xb9, 0x01, 0x00, 0x00, 0x00);                     // mov ecx, 1
+        buf->column = LADDER_JIT_NONE;
+        return;
+    }
+
+    if (buf->column == op->column - 1 && op->row >= buf->row_lo && op->row <= buf->row_hi)
+        return;
+
+    jit_load_state(buf, op->row, op->column - 1);
+}
+
+// cells[row][column].state = cl
+static void jit_store_state(ladder_jit_buf_t *buf, uint32_t row, uint32_t column) {
+    jit_row(buf, row);
+    JIT(buf, 0x41, 0x88, 0x8e);                                     // mov [r14 + state], cl
+    jit_u32(buf, (uint32_t) LADDER_JIT_CELL(column, state));
+    buf->column = column;
+    buf->row_lo = buf->row_hi = row;
+}
+
+// cl is lost on calls
+static inline void jit_clobber(ladder_jit_buf_t *buf) {
+    buf->column = LADDER_JIT_NONE;
+}
+
+// eax = ladder_operand_get(operand)
+static void jit_operand_get(ladder_jit_buf_t *buf, const ladder_operand_t *operand) {
+    switch (operand->kind) {
+        case LADDER_OPERAND_CONST:
+            JIT(buf, 0xb8);                                         // mov eax, value
+            jit_u32(buf, (uint32_t) operand->value);
+            break;
+        case LADDER_OPERAND_U8:
+        case LADDER_OPERAND_BOOL:
+            jit_mem(buf, 0, 0x0f, 0xb6, LADDER_JIT_EAX, operand->ptr); // movzx eax, byte [ptr]
+            break;
+        case LADDER_OPERAND_U32:
+        case LADDER_OPERAND_I32:
+            jit_mem(buf, 0, 0x8b, 0, LADDER_JIT_EAX, operand->ptr);    // mov eax, [ptr]
+            break;
+        case LADDER_OPERAND_REAL:
+            jit_mem(buf, 0xf3, 0x0f, 0x2c, LADDER_JIT_EAX, operand->ptr); // cvttss2si eax, [ptr]
+            break;
+        case LADDER_OPERAND_TIMER:
+            jit_mem(buf, 0, 0x8b, 0, LADDER_JIT_EAX, operand->ptr);    // mov eax, [ptr]
+            JIT(buf, 0x85, 0xc0, 0x79, 0x05);                       // test eax, eax / jns +5
+            JIT(buf, 0xb8, 0xff, 0xff, 0xff, 0x7f);                 // mov eax, INT32_MAX
+            break;
+        default:
+            JIT(buf, 0x31, 0xc0);                                   // xor eax, eax
+            break;
+    }
+}
+
+// ladder_operand_set(operand, &eax)
+static void jit_operand_set(ladder_jit_buf_t *buf, const ladder_operand_t *operand) {
+    if (operand->ptr == NULL)
+        return;
+
+    switch (operand->size) {
+        case 1:
+            jit_mem(buf, 0, 0x88, 0, LADDER_JIT_EAX, operand->ptr);
+            break;
+        case 2:
+            jit_mem(buf, 0x66, 0x89, 0, LADDER_JIT_EAX, operand->ptr);
+            break;
+        case 4:
+            jit_mem(buf, 0, 0x89, 0, LADDER_JIT_EAX, operand->ptr);
+            break;
+        default:
+            buf->fail = true;
+            break;
+    }
+}
+
+// al = *ptr != 0 (setcc 0x95) or == 0 (0x94)
+static void jit_bit(ladder_jit_buf_t *buf, const ladder_operand_t *operand, uint8_t setcc) {
+    jit_mem(buf, 0, 0x80, 0, 7, operand->ptr);                      // cmp byte [ptr], 0
+    JIT(buf, 0x00, 0x0f, setcc, 0xc0);                              // setcc al
+}
+
+// al = (*prev & prev_mask) != 0 (setcc 0x95) or == 0 (0x94)
+static void jit_prev(ladder_jit_buf_t *buf, const ladder_operand_t *operand, uint8_t setcc) {
+    jit_mem(buf, 0, 0xf6, 0, 0, operand->prev);                     // test byte [prev], mask
+    JIT(buf, operand->prev_mask, 0x0f, setcc, 0xc0);                // setcc al
+}
+
+// Generic instructions take a frame: generated code keeps every cell state up to date, so it is filled from the network as the interpreter does
+static ladder_ins_err_t jit_call(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row, ladder_fn_t fn) {
+    ladder_frame_t frame;
+
+    ladder_frame_cell(&frame, ladder_ctx, column, row);
+    return fn(&frame);
+}
+
+static void jit_op(ladder_jit_buf_t *buf, uint32_t network, const ladder_compiled_network_t *cnet, const ladder_op_t *op, size_t fault, size_t exit) {
+    const ladder_operand_t *operand = op->op >= LADDER_OP_NO_BOUND ? &cnet->operands[op->operand] : NULL;
+    static const uint8_t compare[] = { 0x94, 0x95, 0x9f, 0x9d, 0x9c, 0x9e }; // sete, setne, setg, setge, setl, setle
+
+    switch (op->op) {
+        case LADDER_OP_NO_BOUND:
+        case LADDER_OP_NC_BOUND:
+            jit_left(buf, op);
+            jit_bit(buf, operand, op->op == LADDER_OP_NO_BOUND ? 0x95 : 0x94);
+            JIT(buf, 0x20, 0xc1);                                   // and cl, al
+            jit_store_state(buf, op->row, op->column);
+            break;
+
+        case LADDER_OP_RE_BOUND:
+        case LADDER_OP_FE_BOUND:
+            jit_left(buf, op);
+            jit_bit(buf, operand, op->op == LADDER_OP_RE_BOUND ? 0x95 : 0x94);
+            JIT(buf, 0x20, 0xc1);                                   // and cl, al
+            jit_prev(buf, operand, op->op == LADDER_OP_RE_BOUND ? 0x94 : 0x95);
+            JIT(buf, 0x20, 0xc1);                                   // and cl, al
+            jit_store_state(buf, op->row, op->column);
+            break;
+
+        case LADDER_OP_COIL_BOUND:
+            jit_left(buf, op);
+            jit_store_state(buf, op->row, op->column);
+            jit_mem(buf, 0, 0x88, 0, LADDER_JIT_ECX, operand->ptr); // mov [ptr], cl
+            break;
+
+        case LADDER_OP_COILL_BOUND:
+        case LADDER_OP_COILU_BOUND:
+            jit_left(buf, op);
+            jit_prev(buf, operand, 0x95);
+            if (op->op == LADDER_OP_COILL_BOUND) {
+                JIT(buf, 0x08, 0xc1);                               // or cl, al
+            } else {
+                JIT(buf, 0x80, 0xf1, 0x01, 0x20, 0xc1);             // xor cl, 1 / and cl, al
+            }
+            jit_store_state(buf, op->row, op->column);
+            jit_mem(buf, 0, 0x88, 0, LADDER_JIT_ECX, operand->ptr); // mov [ptr], cl
+            break;
+
+        case LADDER_OP_EQ_BOUND:
+        case LADDER_OP_NE_BOUND:
+        case LADDER_OP_GT_BOUND:
+        case LADDER_OP_GE_BOUND:
+        case LADDER_OP_LT_BOUND:
+        case LADDER_OP_LE_BOUND:
+            jit_left(buf, op);
+            jit_operand_get(buf, &operand[1]);
+            JIT(buf, 0x89, 0xc2);                                   // mov edx, eax
+            jit_operand_get(buf, &operand[0]);
+            JIT(buf, 0x39, 0xd0);                                   // cmp eax, edx
+            JIT(buf, 0x0f, compare[op->op - LADDER_OP_EQ_BOUND], 0xc0, 0x20, 0xc1); // setcc al / and cl, al
+            jit_store_state(buf, op->row, op->column);
+            break;
+
+        case LADDER_OP_ADD_BOUND:
+        case LADDER_OP_MUL_BOUND: {
+            jit_left(buf, op);
+            jit_store_state(buf, op->row, op->column);
+            JIT(buf, 0x84, 0xc9);                                   // test cl, cl
+            size_t skip = jit_jump_forward(buf, 0x84);              // jz
+            jit_operand_get(buf, &operand[1]);
+            JIT(buf, 0x89, 0xc2);                                   // mov edx, eax
+            jit_operand_get(buf, &operand[0]);
+            if (op->op == LADDER_OP_ADD_BOUND) {
+                JIT(buf, 0x01, 0xd0);                               // add eax, edx
+            } else {
+                JIT(buf, 0x0f, 0xaf, 0xc2);                         // imul eax, edx
+            }
+            jit_operand_set(buf, &operand[2]);
+            jit_patch(buf, skip);
+            break;
+        }
+
+        case LADDER_OP_WIRE: {
+            ladder_op_t from = *op;
+            from.column = op->operand;
+            jit_left(buf, &from);
+            jit_store_state(buf, op->row, op->column);
+            break;
+        }
+
+        case LADDER_OP_MERGE:
+            jit_load_state(buf, op->row, op->column);
+            for (uint32_t gr = op->row + 1; gr <= op->row_end; gr++) {
+                jit_row(buf, gr);
+                JIT(buf, 0x41, 0x0a, 0x8e);                         // or cl, [r14 + state]
+                jit_u32(buf, (uint32_t) LADDER_JIT_CELL(op->column, state));
+            }
+            for (uint32_t gr = op->row; gr <= op->row_end; gr++)
+                jit_store_state(buf, gr, op->column);
+            buf->row_lo = op->row;
+            buf->row_hi = op->row_end;
+            break;
+
+        case LADDER_OP_INV:
+            jit_last(buf, network, op);
+            jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.last.err), LADDER_INS_ERR_FAIL);
+            jit_jump(buf, 0, fault);
+            break;
+
+        case LADDER_OP_RUNG_END:
+            if (op->row_end)
+                jit_last(buf, network, op);
+            JIT(buf, 0x48, 0x8b, 0x83);                             // mov rax, [rbx + on.scan_end]
+            jit_u32(buf, (uint32_t) LADDER_JIT_CTX(on.scan_end));
+            JIT(buf, 0x48, 0x85, 0xc0, 0x74, 0x05);                 // test rax, rax / jz +5
+            JIT(buf, 0x48, 0x89, 0xdf, 0xff, 0xd0);                 // mov rdi, rbx / call rax
+            jit_clobber(buf);
+            break;
+
+        case LADDER_OP_END:
+            JIT(buf, 0xb8, 0x01, 0x00, 0x00, 0x00);                 // mov eax, 1
+            jit_jump(buf, 0, exit);
+            break;
+
+        default: {
+            // generic instruction (foreign function or custom instruction) called through jit_call with the context, column, row and function.
+            // Custom instructions read their operands from the cell.
+            bool indirect = op->op == LADDER_INS_FOREIGN || op->op == LADDER_OP_CUSTOM || op->op == LADDER_OP_CUSTOM_BOUND;
+            ladder_fn_t fn = indirect ? op->fn : op->op < LADDER_OP_MERGE ? ladder_function[op->op] : NULL;
+            if (fn == NULL) {
+                buf->fail = true;
+                return;
+            }
+            jit_last(buf, network, op);
+            JIT(buf, 0x48, 0x89, 0xdf, 0xbe);                       // mov rdi, rbx / mov esi, column
+            jit_u32(buf, op->column);
+            JIT(buf, 0xba);                                         // mov edx, row
+            jit_u32(buf, op->row);
+            JIT(buf, 0x48, 0xb9);                                   // movabs rcx, fn
+            jit_u64(buf, (uint64_t) (uintptr_t) fn);
+            JIT(buf, 0x48, 0xb8);                                   // movabs rax, jit_call
+            jit_u64(buf, (uint64_t) (uintptr_t) jit_call);
+            JIT(buf, 0xff, 0xd0);                                   // call rax
+            jit_clobber(buf);
+            jit_store_ctx_eax(buf, LADDER_JIT_FIELD(ladder.last.err));
+            JIT(buf, 0x85, 0xc0);                                   // test eax, eax
+            jit_jump(buf, 0x85, fault);                             // jnz fault
+            break;
+        }
+    }
+}
+
+// Network function: fault path first so every jump to it is backwards, then entry, operations and common exit
+static size_t jit_network(ladder_jit_buf_t *buf, uint32_t network, const ladder_compiled_network_t *cnet) {
+    size_t fault = buf->len;
+    jit_store_ctx(buf, LADDER_JIT_FIELD(ladder.state), LADDER_ST_INV);
+    JIT(buf, 0x31, 0xc0);                                           // xor eax, eax
+    size_t exit = buf->len;
+    JIT(buf, 0x41, 0x5f, 0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5c, 0x5b, 0xc3); // pop r15 / pop r14 / pop r13 / pop r12 / pop rbx / ret
+
+    // anchor on the first operand: register banks are usually within 2 GB of it
+    buf->anchor = 0;
+    for (uint32_t n = 0; n < cnet->operands_qty && buf->anchor == 0; n++)
+        buf->anchor = (uintptr_t) cnet->operands[n].ptr;
+    buf->row = LADDER_JIT_NONE;
+    buf->column = LADDER_JIT_NONE;
+
+    size_t entry = buf->len;
+    JIT(buf, 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57); // push rbx / r12 / r13 / r14 / r15 (r15 aligns the stack for calls)
+    JIT(buf, 0x48, 0x89, 0xfb, 0x49, 0x89, 0xf4);                   // mov rbx, rdi / mov r12, rsi
+    JIT(buf, 0x49, 0xbd);                                           // movabs r13, anchor
+    jit_u64(buf, (uint64_t) buf->anchor);
+
+    for (uint32_t n = 0; n < cnet->ops_qty; n++) {
+        // fused operations are translated one by one
+        ladder_op_t op = cnet->ops[n];
+        op.op = ladder_op_unfused(op.op);
+        jit_op(buf, network, cnet, &op, fault, exit);
+        if (cnet->ops[n].op == LADDER_OP_END)
+            break;
+    }
+
+    return entry;
+}
+
+ladder_jit_t* ladder_jit_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled) {
+    if (ladder_ctx == NULL || compiled == NULL)
+        return NULL;
+
+    ladder_jit_t *jit = calloc(1, sizeof(ladder_jit_t));
+    if (jit == NULL)
+        return NULL;
+
+    jit->networks_qty = compiled->networks_qty;
+    jit->entry = calloc(compiled->networks_qty > 0 ? compiled->networks_qty : 1, sizeof(ladder_jit_fn_t));
+    size_t *offset = calloc(compiled->networks_qty > 0 ? compiled->networks_qty : 1, sizeof(size_t));
+    if (jit->entry == NULL || offset == NULL) {
+        free(offset);
+        ladder_jit_free(jit);
+        return NULL;
+    }
+
+    ladder_jit_buf_t buf = { 0 };
+    for (uint32_t network = 0; network < compiled->networks_qty; network++) {
+        offset[network] = SIZE_MAX;
+        const ladder_compiled_network_t *cnet = &compiled->network[network];
+        if (cnet->interpreted || cnet->ops == NULL)
+            continue;
+
+        // a network that can't be translated is left to the compiled engine
+        size_t start = buf.len;
+        size_t entry = jit_network(&buf, network, cnet);
+        if (buf.nomem)
+            break;
+        if (buf.fail) {
+            buf.fail = false;
+            buf.len = start;
+            continue;
+        }
+        offset[network] = entry;
+    }
+
+    if (!buf.nomem && buf.len > 0) {
+        long page = sysconf(_SC_PAGESIZE);
+        size_t size = (buf.len + (size_t) page - 1) & ~((size_t) page - 1);
+        void *code = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (code != MAP_FAILED) {
+            memcpy(code, buf.data, buf.len);
+            if (mprotect(code, size, PROT_READ | PROT_EXEC) == 0) {
+                jit->code = code;
+                jit->size = size;
+                for (uint32_t network = 0; network < compiled->networks_qty; network++)
+                    if (offset[network] != SIZE_MAX)
+                        jit->entry[network] = (ladder_jit_fn_t) (void*) (jit->code + offset[network]);
+            } else {
+                munmap(code, size);
+            }
+        }
+    }
+
+    free(buf.data);
+    free(offset);
+
+    return jit;
+}
+
+void ladder_jit_free(ladder_jit_t *jit) {
+    if (jit == NULL)
+        return;
+
+    if (jit->code != NULL)
+        munmap(jit->code, jit->size);
+    free(jit->entry);
+    free(jit->check);
+    free(jit);
+}
+
+#else
+
+ladder_jit_t* ladder_jit_build(ladder_ctx_t *ladder_ctx, const ladder_compiled_t *compiled) {
+    (void) ladder_ctx;
+    (void) compiled;
+
+    return NULL;
+}
+
+void ladder_jit_free(ladder_jit_t *jit) {
+    (void) jit;
+}
+
+#endif /* LADDER_JIT_AVAILABLE */
+
+typedef enum LADDER_JIT_STATE {
+    LADDER_JIT_STATE_SIZE,    /**< Count bytes */
+    LADDER_JIT_STATE_SAVE,    /**< Copy state to buffer */
+    LADDER_JIT_STATE_RESTORE, /**< Copy buffer to state */
+    LADDER_JIT_STATE_COMPARE, /**< Compare state with buffer */
+} ladder_jit_state_op_t;
+
+static _Thread_local uint64_t ladder_jit_now; // millis() seen by both executions of a checked scan
+
+static uint64_t ladder_jit_millis(void) {
+    return ladder_jit_now;
+}
+
+static size_t ladder_jit_region(uint8_t *buf, size_t pos, void *ptr, size_t size, ladder_jit_state_op_t op, bool *equal) {
+    if (ptr == NULL || size == 0)
+        return pos;
+
+    switch (op) {
+        case LADDER_JIT_STATE_SAVE:
+            memcpy(buf + pos, ptr, size);
+            break;
+        case LADDER_JIT_STATE_RESTORE:
+            memcpy(ptr, buf + pos, size);
+            break;
+        case LADDER_JIT_STATE_COMPARE:
+            if (memcmp(buf + pos, ptr, size) != 0)
+                *equal = false;
+            break;
+        default:
+            break;
+    }
+
+    return pos + size;
+}
+
+// Everything a scan can write: state, last executed cell, registers, timers, I/O values and cell states
+static size_t ladder_jit_state(ladder_ctx_t *ladder_ctx, uint8_t *buf, ladder_jit_state_op_t op, bool *equal) {
+    size_t pos = 0;
+
+#define LADDER_JIT_STATE(ptr, size) pos = ladder_jit_region(buf, pos, (ptr), (size), op, equal)
+    LADDER_JIT_STATE(&ladder_ctx->ladder.state, sizeof(ladder_ctx->ladder.state));
+    LADDER_JIT_STATE(&ladder_ctx->ladder.last, sizeof(ladder_ctx->ladder.last));
+    LADDER_JIT_STATE(ladder_ctx->memory.M, ladder_ctx->ladder.quantity.m * sizeof(uint8_t));
+    LADDER_JIT_STATE(ladder_ctx->memory.Cr, ladder_ctx->ladder.quantity.c * sizeof(bool));
+    LADDER_JIT_STATE(ladder_ctx->memory.Cd, ladder_ctx->ladder.quantity.c * sizeof(bool));
+    LADDER_JIT_STATE(ladder_ctx->memory.Tr, ladder_ctx->ladder.quantity.t * sizeof(bool));
+    LADDER_JIT_STATE(ladder_ctx->memory.Td, ladder_ctx->ladder.quantity.t * sizeof(bool));
+    LADDER_JIT_STATE(ladder_ctx->registers.C, ladder_ctx->ladder.quantity.c * sizeof(uint32_t));
+    LADDER_JIT_STATE(ladder_ctx->registers.D, ladder_ctx->ladder.quantity.d * sizeof(int32_t));
+    LADDER_JIT_STATE(ladder_ctx->registers.R, ladder_ctx->ladder.quantity.r * sizeof(float));
+    LADDER_JIT_STATE(ladder_ctx->timers, ladder_ctx->ladder.quantity.t * sizeof(ladder_timer_t));
+
+    if (ladder_ctx->input != NULL)
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
+            LADDER_JIT_STATE(ladder_ctx->input[n].I, ladder_ctx->input[n].i_qty * sizeof(uint8_t));
+            LADDER_JIT_STATE(ladder_ctx->input[n].IW, ladder_ctx->input[n].iw_qty * sizeof(int32_t));
+        }
+    if (ladder_ctx->output != NULL)
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+            LADDER_JIT_STATE(ladder_ctx->output[n].Q, ladder_ctx->output[n].q_qty * sizeof(uint8_t));
+            LADDER_JIT_STATE(ladder_ctx->output[n].QW, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
+        }
+
+    // the optimized program leaves removed cells unpowered
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks && !ladder_ctx->ladder.optimize; network++) {
+        ladder_network_t *net = &ladder_ctx->network[network];
+        if (net->cells == NULL)
+            continue;
+        for (uint32_t row = 0; row < net->rows; row++)
+            LADDER_JIT_STATE(net->cells[row], net->cols * sizeof(ladder_cell_t));
+    }
+#undef LADDER_JIT_STATE
+
+    return pos;
+}
+
+// Execute enabled networks natively (or all of them on the interpreter)
+static void ladder_jit_networks(ladder_ctx_t *ladder_ctx, ladder_compiled_t *compiled, ladder_jit_t *jit, bool native) {
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks; network++) {
+        ladder_network_t *net = &ladder_ctx->network[network];
+        if (net->cells == NULL) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);
+            }
+            return;
+        }
+        if (!net->enable)
+            continue;
+
+        const ladder_compiled_network_t *cnet = &compiled->network[network];
+        bool ok;
+        if (!native || cnet->interpreted) {
+            ok = ladder_scan_network(ladder_ctx, network);
+        } else if (jit->entry[network] == NULL) {
+            ok = ladder_exec_network(ladder_ctx, network, cnet);
+        } else {
+            ladder_topology_clear(net, cnet->clear, 0, cnet->clear_start[net->rows]);
+            ladder_ctx->exec_network = net;
+            ok = jit->entry[network](ladder_ctx, net->cells);
+        }
+        if (!ok)
+            return;
+    }
+}
+
+void ladder_scan_jit(ladder_ctx_t *ladder_ctx) {
+    // per instruction hook needs every cell (including NOP) visited: keep the interpreter
+    if (ladder_ctx->on.instruction != NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled == NULL) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    if (compiled->jit == NULL)
+        compiled->jit = ladder_jit_build(ladder_ctx, compiled);
+
+    ladder_jit_t *jit = (ladder_jit_t*) compiled->jit;
+    if (jit == NULL) {
+        ladder_scan_compiled(ladder_ctx);
+        return;
+    }
+
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    if (!ladder_ctx->ladder.jit_check) {
+        ladder_jit_networks(ladder_ctx, compiled, jit, true);
+        return;
+    }
+
+    // lockstep check: same starting state and time for both executions, the interpreter result is kept
+    size_t size = ladder_jit_state(ladder_ctx, NULL, LADDER_JIT_STATE_SIZE, NULL);
+    if (jit->check == NULL || jit->check_size != size) {
+        free(jit->check);
+        jit->check_size = 0;
+        jit->check = malloc(size > 0 ? 2 * size : 1);
+        if (jit->check == NULL) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);
+            }
+            return;
+        }
+        jit->check_size = size;
+    }
+
+    _millis millis = ladder_ctx->hw.time.millis;
+    if (millis != NULL) {
+        ladder_jit_now = millis();
+        ladder_ctx->hw.time.millis = ladder_jit_millis;
+    }
+
+    ladder_jit_state(ladder_ctx, jit->check, LADDER_JIT_STATE_SAVE, NULL);
+    ladder_jit_networks(ladder_ctx, compiled, jit, true);
+    ladder_jit_state(ladder_ctx, jit->check + size, LADDER_JIT_STATE_SAVE, NULL);
+    ladder_jit_state(ladder_ctx, jit->check, LADDER_JIT_STATE_RESTORE, NULL);
+    ladder_jit_networks(ladder_ctx, compiled, jit, false);
+
+    ladder_ctx->hw.time.millis = millis;
+
+    bool equal = true;
+    ladder_jit_state(ladder_ctx, jit->check + size, LADDER_JIT_STATE_COMPARE, &equal);
+    if (!equal) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+        if (ladder_ctx->on.panic != NULL) {
+            ladder_ctx->on.panic(ladder_ctx);
+        }
+    }
+}
+
+#endif /* OPTIONAL_JIT */
@@ -0,0 +1,409 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_optimize.h"
+
+#ifdef OPTIONAL_COMPILED
+
+// Cell power known at load time
+enum {
+    LADDER_POWER_OFF, // never powered (cells start cleared)
+    LADDER_POWER_ON,  // always powered
+    LADDER_POWER_ANY, // depends on registers
+};
+
+typedef struct ladder_optimize_s {
+    uint32_t cols;     /**< Network columns */
+     uint8_t *power;   /**< Cell power (LADDER_POWER_*) */
+     uint8_t *origin;  /**< Wired cells of the current rung: first column of the wire + 1 (0: not wired) */
+    uint32_t *needed;  /**< Rows whose cell state is read by a later operation, per column */
+        bool *removed; /**< Removed operations */
+} ladder_optimize_t;
+
+static uint8_t ladder_optimize_left(const ladder_optimize_t *opt, uint32_t row, uint32_t column) {
+    return column == 0 ? LADDER_POWER_ON : opt->power[row * opt->cols + column - 1];
+}
+
+// Bound read of a constant or of nothing (reads 0)
+static bool ladder_optimize_const(const ladder_operand_t *operand) {
+    return operand->kind == LADDER_OPERAND_CONST || operand->kind == LADDER_OPERAND_NONE;
+}
+
+static bool ladder_optimize_compare(uint8_t op, int32_t a, int32_t b) {
+    switch (op) {
+        case LADDER_OP_EQ_BOUND:
+            return a == b;
+        case LADDER_OP_NE_BOUND:
+            return a != b;
+        case LADDER_OP_GT_BOUND:
+            return a > b;
+        case LADDER_OP_GE_BOUND:
+            return a >= b;
+        case LADDER_OP_LT_BOUND:
+            return a < b;
+        default:
+            return a <= b;
+    }
+}
+
+// Connector (or compare always true) as a wire. A wire fed by another wire of the same rung starts where that one starts: columns on the
+// left of the current one are final until the rung ends (operations run column by column), unless a foreign function runs.
+static uint8_t ladder_optimize_wire(ladder_optimize_t *opt, ladder_op_t *op, ladder_optimize_report_t *report) {
+    uint32_t first = op->op == LADDER_OP_WIRE ? op->operand : op->column;
+
+    if (first > 0 && opt->origin[op->row * opt->cols + first - 1] != 0)
+        first = opt->origin[op->row * opt->cols + first - 1] - 1;
+    if (first < op->column)
+        report->wires++;
+
+    op->op = LADDER_OP_WIRE;
+    op->operand = first;
+    op->fn = NULL;
+    opt->origin[op->row * opt->cols + op->column] = (uint8_t) (first + 1);
+
+    return ladder_optimize_left(opt, op->row, first);
+}
+
+// Forward pass: fold constants, follow cell power and drop operations that leave an unpowered cell unpowered without side effects
+static void ladder_optimize_power(ladder_optimize_t *opt, uint32_t rows, ladder_compiled_network_t *cnet, ladder_optimize_report_t *report) {
+    uint32_t rung_ops = 0;
+    bool rung_powered = false;
+
+    for (uint32_t i = 0; i < cnet->ops_qty; i++) {
+        ladder_op_t *op = &cnet->ops[i];
+        ladder_operand_t *operand = op->op >= LADDER_OP_NO_BOUND ? &cnet->operands[op->operand] : NULL;
+        uint32_t cell = op->row * opt->cols + op->column;
+
+        if (op->op == LADDER_OP_RUNG_END) {
+            if (rung_ops > 0 && !rung_powered)
+                report->dead_rungs++;
+            rung_ops = 0;
+            rung_powered = false;
+            memset(opt->origin, 0, rows * opt->cols);
+            continue;
+        }
+        if (op->op == LADDER_OP_END || op->op == LADDER_OP_INV)
+            continue;
+
+        if (op->op == LADDER_OP_MERGE) {
+            bool on = false, any = false, changed = false;
+            for (uint32_t gr = op->row; gr <= op->row_end; gr++) {
+                on |= opt->power[gr * opt->cols + op->column] == LADDER_POWER_ON;
+                any |= opt->power[gr * opt->cols + op->column] == LADDER_POWER_ANY;
+            }
+            uint8_t group = on ? LADDER_POWER_ON : any ? LADDER_POWER_ANY : LADDER_POWER_OFF;
+            for (uint32_t gr = op->row; gr <= op->row_end; gr++) {
+                changed |= opt->power[gr * opt->cols + op->column] != group || group == LADDER_POWER_ANY;
+                opt->power[gr * opt->cols + op->column] = group;
+                opt->origin[gr * opt->cols + op->column] = 0;
+            }
+            if (!changed) {
+                opt->removed[i] = true;
+                report->removed++;
+            }
+            continue;
+        }
+
+        uint8_t left = ladder_optimize_left(opt, op->row, op->op == LADDER_OP_WIRE ? op->operand : op->column);
+        uint8_t result = LADDER_POWER_ANY;
+        bool pure = true;
+        rung_ops++;
+        opt->origin[cell] = 0;
+
+        switch (op->op) {
+            case LADDER_INS_CONN:
+            case LADDER_OP_WIRE:
+                result = ladder_optimize_wire(opt, op, report);
+                break;
+
+            case LADDER_OP_NO_BOUND:
+            case LADDER_OP_NC_BOUND:
+            case LADDER_OP_RE_BOUND:
+            case LADDER_OP_FE_BOUND:
+                result = left == LADDER_POWER_OFF ? LADDER_POWER_OFF : LADDER_POWER_ANY;
+                break;
+
+            case LADDER_OP_EQ_BOUND:
+            case LADDER_OP_NE_BOUND:
+            case LADDER_OP_GT_BOUND:
+            case LADDER_OP_GE_BOUND:
+            case LADDER_OP_LT_BOUND:
+            case LADDER_OP_LE_BOUND:
+                if (ladder_optimize_const(&operand[0]) && ladder_optimize_const(&operand[1])) {
+                    report->folded++;
+                    if (ladder_optimize_compare(op->op, ladder_operand_get(&operand[0]), ladder_operand_get(&operand[1])))
+                        result = ladder_optimize_wire(opt, op, report);
+                    else
+                        result = LADDER_POWER_OFF;
+                } else {
+                    result = left == LADDER_POWER_OFF ? LADDER_POWER_OFF : LADDER_POWER_ANY;
+                }
+                break;
+
+            case LADDER_OP_ADD_BOUND:
+            case LADDER_OP_MUL_BOUND:
+                if (ladder_optimize_const(&operand[0]) && ladder_optimize_const(&operand[1])
+                        && !(operand[1].kind == LADDER_OPERAND_CONST && operand[1].value == (op->op == LADDER_OP_ADD_BOUND ? 0 : 1))) {
+                    // wrap around as the 32 bits instruction does
+                    uint32_t a = (uint32_t) ladder_operand_get(&operand[0]), b = (uint32_t) ladder_operand_get(&operand[1]);
+                    operand[0].kind = LADDER_OPERAND_CONST;
+                    operand[0].value = (int32_t) (op->op == LADDER_OP_ADD_BOUND ? a + b : a * b);
+                    operand[1].kind = LADDER_OPERAND_CONST;
+                    operand[1].value = op->op == LADDER_OP_ADD_BOUND ? 0 : 1;
+                    report->folded++;
+                }
+                // the result is only written with power
+                result = left;
+                pure = left == LADDER_POWER_OFF;
+                break;
+
+            case LADDER_OP_COIL_BOUND:
+                result = left;
+                pure = false;
+                break;
+
+            case LADDER_OP_COILL_BOUND:
+            case LADDER_OP_COILU_BOUND:
+                pure = false;
+                break;
+
+            case LADDER_INS_FOREIGN:
+                // may read and set any cell
+                memset(opt->power, LADDER_POWER_ANY, rows * opt->cols);
+                memset(opt->origin, 0, rows * opt->cols);
+                rung_powered = true;
+                continue;
+
+            default:
+                // generic instructions set the states of their column (multi-cell instructions use the rows below)
+                for (uint32_t r = 0; r < rows; r++) {
+                    opt->power[r * opt->cols + op->column] = LADDER_POWER_ANY;
+                    opt->origin[r * opt->cols + op->column] = 0;
+                }
+                rung_powered = true;
+                continue;
+        }
+
+        rung_powered |= result != LADDER_POWER_OFF;
+        if (pure && result == LADDER_POWER_OFF && opt->power[cell] == LADDER_POWER_OFF) {
+            opt->removed[i] = true;
+            opt->origin[cell] = 0;
+            report->removed++;
+            continue;
+        }
+        opt->power[cell] = result;
+    }
+}
+
+// Backward pass: drop operations without side effects whose cell state is never read afterwards. States are cleared before the network
+// runs, nothing reads them after it.
+static void ladder_optimize_needed(ladder_optimize_t *opt, ladder_compiled_network_t *cnet, ladder_optimize_report_t *report) {
+    memset(opt->needed, 0, opt->cols * sizeof(uint32_t));
+
+    for (uint32_t i = cnet->ops_qty; i-- > 0;) {
+        const ladder_op_t *op = &cnet->ops[i];
+        uint32_t bit = (uint32_t) 1 << op->row;
+        uint32_t source = op->column;
+
+        if (opt->removed[i])
+            continue;
+
+        switch (op->op) {
+            case LADDER_OP_RUNG_END:
+            case LADDER_OP_END:
+            case LADDER_OP_INV:
+                continue;
+
+            case LADDER_OP_MERGE: {
+                uint32_t group = op->operand;
+                if ((opt->needed[op->column] & group) == 0) {
+                    opt->removed[i] = true;
+                    report->removed++;
+                } else {
+                    opt->needed[op->column] |= group;
+                }
+                continue;
+            }
+
+            case LADDER_OP_WIRE:
+                source = op->operand;
+                /* fall through */
+            case LADDER_OP_NO_BOUND:
+            case LADDER_OP_NC_BOUND:
+            case LADDER_OP_RE_BOUND:
+            case LADDER_OP_FE_BOUND:
+            case LADDER_OP_EQ_BOUND:
+            case LADDER_OP_NE_BOUND:
+            case LADDER_OP_GT_BOUND:
+            case LADDER_OP_GE_BOUND:
+            case LADDER_OP_LT_BOUND:
+            case LADDER_OP_LE_BOUND:
+                if ((opt->needed[op->column] & bit) == 0) {
+                    opt->removed[i] = true;
+                    report->removed++;
+                    continue;
+                }
+                /* fall through */
+            case LADDER_OP_COIL_BOUND:
+            case LADDER_OP_COILL_BOUND:
+            case LADDER_OP_COILU_BOUND:
+            case LADDER_OP_ADD_BOUND:
+            case LADDER_OP_MUL_BOUND:
+                opt->needed[op->column] &= ~bit;
+                if (source > 0)
+                    opt->needed[source - 1] |= bit;
+                continue;
+
+            case LADDER_INS_FOREIGN:
+                memset(opt->needed, 0xff, opt->cols * sizeof(uint32_t));
+                continue;
+
+            default:
+                // generic instructions read their column and the one on the left, on any row of a multi-cell instruction
+                opt->needed[op->column] = UINT32_MAX;
+                if (op->column > 0)
+                    opt->needed[op->column - 1] = UINT32_MAX;
+                continue;
+        }
+    }
+}
+
+bool ladder_optimize_network(ladder_ctx_t *ladder_ctx, uint32_t network, ladder_compiled_network_t *cnet, ladder_optimize_report_t *report) {
+    ladder_network_t *net = &ladder_ctx->network[network];
+    if (cnet->interpreted || cnet->ops == NULL || net->cells == NULL)
+        return true;
+
+    ladder_optimize_t opt = { .cols = net->cols };
+    size_t cells = (size_t) net->rows * net->cols;
+    opt.power = calloc(cells, sizeof(uint8_t));
+    opt.origin = calloc(cells, sizeof(uint8_t));
+    opt.needed = calloc(net->cols, sizeof(uint32_t));
+    opt.removed = calloc(cnet->ops_qty, sizeof(bool));
+    bool ok = opt.power != NULL && opt.origin != NULL && opt.needed != NULL && opt.removed != NULL;
+
+    if (ok) {
+        ladder_optimize_power(&opt, net->rows, cnet, report);
+        ladder_optimize_needed(&opt, cnet, report);
+
+        uint32_t qty = 0;
+        for (uint32_t i = 0; i < cnet->ops_qty; i++)
+            if (!opt.removed[i])
+                cnet->ops[qty++] = cnet->ops[i];
+        report->ops_before += cnet->ops_qty;
+        report->ops_after += qty;
+        cnet->ops_qty = qty;
+    }
+
+    free(opt.power);
+    free(opt.origin);
+    free(opt.needed);
+    free(opt.removed);
+
+    return ok;
+}
+
+// Sequence on consecutive cells of a row and the operation running it
+typedef struct ladder_optimize_fusion_s {
+    uint8_t fused;  /**< Fused operation */
+    uint8_t qty;    /**< Operations in the sequence */
+    uint8_t op[3];  /**< Operations in the sequence */
+} ladder_optimize_fusion_t;
+
+static const ladder_optimize_fusion_t ladder_optimize_fusion[LADDER_FUSE_QTY] = { //
+        [LADDER_FUSE_NO_NO_COIL] = { LADDER_OP_NO_NO_COIL, 3, { LADDER_OP_NO_BOUND, LADDER_OP_NO_BOUND, LADDER_OP_COIL_BOUND } }, //
+        [LADDER_FUSE_NO_NC_COIL] = { LADDER_OP_NO_NC_COIL, 3, { LADDER_OP_NO_BOUND, LADDER_OP_NC_BOUND, LADDER_OP_COIL_BOUND } }, //
+        [LADDER_FUSE_EQ_MOVE]    = { LADDER_OP_EQ_MOVE,    2, { LADDER_OP_EQ_BOUND, LADDER_INS_MOVE } },                        //
+        [LADDER_FUSE_RE_CTU]     = { LADDER_OP_RE_CTU,     2, { LADDER_OP_RE_BOUND, LADDER_INS_CTU } },                         //
+        };
+
+static bool ladder_optimize_fusable(const ladder_compiled_network_t *cnet, uint32_t first, const ladder_optimize_fusion_t *fusion) {
+    if (first + fusion->qty > cnet->ops_qty)
+        return false;
+
+    const ladder_op_t *op = &cnet->ops[first];
+    for (uint32_t n = 0; n < fusion->qty; n++)
+        if (op[n].op != fusion->op[n] || op[n].row != op[0].row || op[n].column != op[0].column + n)
+            return false;
+
+    return true;
+}
+
+void ladder_optimize_fuse(ladder_compiled_network_t *cnet, ladder_optimize_report_t *report) {
+    if (cnet->interpreted || cnet->ops == NULL)
+        return;
+
+    uint32_t s = 0;
+    for (uint32_t i = 0; i < cnet->ops_qty; i++) {
+        // grouped rungs run on the power masks
+        if (s < cnet->slices_qty && i == cnet->slice[s].first_op) {
+            i = cnet->slice[s++].last_op;
+            continue;
+        }
+
+        // the fused operation replaces the first one, the others stay in place and are skipped
+        for (uint32_t f = 0; f < LADDER_FUSE_QTY; f++) {
+            if (ladder_optimize_fusable(cnet, i, &ladder_optimize_fusion[f])) {
+                cnet->ops[i].op = ladder_optimize_fusion[f].fused;
+                report->fused[f]++;
+                i += ladder_optimize_fusion[f].qty - 1;
+                break;
+            }
+        }
+    }
+}
+
+bool ladder_program_optimize(ladder_ctx_t *ladder_ctx, ladder_optimize_report_t *report) {
+    if (ladder_ctx == NULL || ladder_ctx->network == NULL)
+        return false;
+
+    ladder_ctx->ladder.optimize = true;
+    ladder_compiled_free(ladder_ctx);
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled == NULL)
+        return false;
+
+    if (report != NULL)
+        *report = compiled->optimized;
+
+    return true;
+}
+
+#endif /* OPTIONAL_COMPILED */
@@ -0,0 +1,461 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_PARALLEL
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_incremental.h"
+#include "ladder_parallel.h"
+
+#define LADDER_PARALLEL_SPIN       4096       // polls before a waiting thread yields (caller) or sleeps (workers)
+#define LADDER_PARALLEL_NO_NETWORK UINT32_MAX // ladder.last.network before a worker executes a network
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LADDER_PARALLEL_PAUSE() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define LADDER_PARALLEL_PAUSE() __asm__ volatile("yield")
+#else
+#define LADDER_PARALLEL_PAUSE()
+#endif
+
+typedef struct ladder_parallel_pool_s ladder_parallel_pool_t;
+
+typedef struct ladder_parallel_thread_s {
+    ladder_parallel_pool_t *pool;
+                  uint32_t index;
+                 pthread_t thread;
+} ladder_parallel_thread_t;
+
+struct ladder_parallel_pool_s {
+                         uint32_t workers;  /**< Threads including the caller */
+         ladder_parallel_thread_t *thread;  /**< Worker threads (index 0 is the caller) */
+                     ladder_ctx_t *ctx;     /**< Context copy used by each thread */
+                  pthread_mutex_t lock;     /**< Protects sleepers */
+                   pthread_cond_t wake;     /**< Signaled on new phase when workers sleep */
+                         uint32_t sleepers; /**< Workers waiting on wake */
+                      atomic_uint phase;    /**< Levels started on the pool */
+                      atomic_bool quit;     /**< Stop workers */
+                      atomic_uint next;     /**< Next network of the level */
+                      atomic_uint done;     /**< Workers finished with the level */
+          const ladder_compiled_t *compiled;
+                ladder_parallel_t *schedule;
+    const ladder_parallel_level_t *level;
+};
+
+ladder_parallel_t* ladder_parallel_build(ladder_ctx_t *ladder_ctx, ladder_compiled_t *compiled) {
+    if (compiled->incremental == NULL)
+        compiled->incremental = ladder_incremental_build(ladder_ctx, compiled);
+    const ladder_incremental_t *incremental = (const ladder_incremental_t*) compiled->incremental;
+    if (incremental == NULL)
+        return NULL;
+
+    uint32_t networks_qty = compiled->networks_qty;
+    uint32_t accesses_qty = incremental->users_start[incremental->slots_qty];
+    ladder_parallel_t *parallel = calloc(1, sizeof(ladder_parallel_t));
+    uint32_t *network_level = calloc(networks_qty + 1, sizeof(uint32_t));
+    uint32_t *access_start = calloc(networks_qty + 1, sizeof(uint32_t));
+    uint32_t *access = malloc((accesses_qty + 1) * sizeof(uint32_t));
+    uint32_t *written = calloc(incremental->slots_qty + 1, sizeof(uint32_t));
+    uint32_t *read = calloc(incremental->slots_qty + 1, sizeof(uint32_t));
+    bool *barrier = calloc(networks_qty + 1, sizeof(bool));
+
+    if (parallel == NULL || network_level == NULL || access_start == NULL || access == NULL || written == NULL || read == NULL || barrier == NULL)
+        goto fail;
+
+    parallel->level = calloc(networks_qty + 1, sizeof(ladder_parallel_level_t));
+    parallel->order = calloc(networks_qty + 1, sizeof(uint32_t));
+    parallel->result = calloc(networks_qty + 1, sizeof(ladder_parallel_result_t));
+    if (parallel->level == NULL || parallel->order == NULL || parallel->result == NULL)
+        goto fail;
+
+    // networks that may fault or touch untracked registers keep their place in program order
+    for (uint32_t n = 0; n < networks_qty; n++)
+        barrier[n] = incremental->network[n].full;
+    for (uint32_t u = 0; u < incremental->units_qty; u++)
+        if (incremental->unit[u].unresolved || incremental->unit[u].unknown_writes)
+            barrier[incremental->unit[u].network] = true;
+
+    // register accesses of each network (counting sort of slot users): slot << 1, plus 1 on read
+    for (uint32_t slot = 0; slot < incremental->slots_qty; slot++)
+        for (uint32_t u = incremental->users_start[slot]; u < incremental->users_start[slot + 1]; u++)
+            access_start[incremental->unit[incremental->users[u] >> 1].network + 1]++;
+    for (uint32_t n = 0; n < networks_qty; n++)
+        access_start[n + 1] += access_start[n];
+    for (uint32_t slot = 0; slot < incremental->slots_qty; slot++)
+        for (uint32_t u = incremental->users_start[slot]; u < incremental->users_start[slot + 1]; u++)
+            access[access_start[incremental->unit[incremental->users[u] >> 1].network]++] = (slot << 1) | (incremental->users[u] & 1);
+    for (uint32_t n = networks_qty; n > 0; n--)
+        access_start[n] = access_start[n - 1];
+    access_start[0] = 0;
+
+    // level of each network: after the last writer of what it reads, after the last reader and writer of what it writes
+    uint32_t floor = 0;
+    for (uint32_t n = 0; n < networks_qty; n++) {
+        uint32_t level = floor;
+
+        if (barrier[n]) {
+            level = parallel->levels_qty;
+            floor = level + 1;
+        } else {
+            for (uint32_t a = access_start[n]; a < access_start[n + 1]; a++) {
+                uint32_t slot = access[a] >> 1;
+                if (written[slot] > level)
+                    level = written[slot];
+                if (!(access[a] & 1) && read[slot] > level)
+                    level = read[slot];
+            }
+            for (uint32_t a = access_start[n]; a < access_start[n + 1]; a++) {
+                uint32_t slot = access[a] >> 1;
+                if (!(access[a] & 1))
+                    written[slot] = level + 1;
+                else if (read[slot] < level + 1)
+                    read[slot] = level + 1;
+            }
+        }
+
+        network_level[n] = level;
+        if (level + 1 > parallel->levels_qty)
+            parallel->levels_qty = level + 1;
+    }
+
+    // networks by level (counting sort keeps program order inside a level)
+    for (uint32_t n = 0; n < networks_qty; n++) {
+        parallel->level[network_level[n]].qty++;
+        parallel->level[network_level[n]].barrier |= barrier[n];
+    }
+    for (uint32_t l = 1; l < parallel->levels_qty; l++)
+        parallel->level[l].first = parallel->level[l - 1].first + parallel->level[l - 1].qty;
+    memset(access_start, 0, (networks_qty + 1) * sizeof(uint32_t));
+    for (uint32_t n = 0; n < networks_qty; n++)
+        parallel->order[parallel->level[network_level[n]].first + access_start[network_level[n]]++] = n;
+
+    free(network_level);
+    free(access_start);
+    free(access);
+    free(written);
+    free(read);
+    free(barrier);
+
+    return parallel;
+
+    fail:
+    free(network_level);
+    free(access_start);
+    free(access);
+    free(written);
+    free(read);
+    free(barrier);
+    ladder_parallel_free(parallel);
+    return NULL;
+}
+
+void ladder_parallel_free(ladder_parallel_t *parallel) {
+    if (parallel == NULL)
+        return;
+
+    free(parallel->level);
+    free(parallel->order);
+    free(parallel->result);
+    free(parallel);
+}
+
+/////////////////////////////////////////////////////////////////
+
+// Execute networks of the current level until none is left
+static void ladder_parallel_run(ladder_parallel_pool_t *pool, uint32_t index) {
+    ladder_ctx_t *ladder_ctx = &pool->ctx[index];
+    const ladder_parallel_level_t *level = pool->level;
+
+    for (;;) {
+        uint32_t n = atomic_fetch_add_explicit(&pool->next, 1, memory_order_relaxed);
+        if (n >= level->qty)
+            return;
+
+        uint32_t network = pool->schedule->order[level->first + n];
+        ladder_parallel_result_t *result = &pool->schedule->result[network];
+        if (!ladder_ctx->network[network].enable)
+            continue;
+
+        ladder_ctx->ladder.last.network = LADDER_PARALLEL_NO_NETWORK;
+        result->ok = ladder_exec_network(ladder_ctx, network, &pool->compiled->network[network]);
+        result->executed = true;
+        result->touched = ladder_ctx->ladder.last.network != LADDER_PARALLEL_NO_NETWORK;
+        result->instr = ladder_ctx->ladder.last.instr;
+        result->err = ladder_ctx->ladder.last.err;
+        result->cell_column = ladder_ctx->ladder.last.cell_column;
+        result->cell_row = ladder_ctx->ladder.last.cell_row;
+    }
+}
+
+static void* ladder_parallel_worker(void *arg) {
+    ladder_parallel_thread_t *thread = (ladder_parallel_thread_t*) arg;
+    ladder_parallel_pool_t *pool = thread->pool;
+    uint32_t seen = 0;
+
+    for (;;) {
+        uint32_t phase = atomic_load_explicit(&pool->phase, memory_order_acquire);
+        for (uint32_t spin = 0; phase == seen && spin < LADDER_PARALLEL_SPIN; spin++) {
+            LADDER_PARALLEL_PAUSE();
+            phase = atomic_load_explicit(&pool->phase, memory_order_acquire);
+        }
+        if (phase == seen) {
+            pthread_mutex_lock(&pool->lock);
+            pool->sleepers++;
+            while ((phase = atomic_load_explicit(&pool->phase, memory_order_acquire)) == seen)
+                pthread_cond_wait(&pool->wake, &pool->lock);
+            pool->sleepers--;
+            pthread_mutex_unlock(&pool->lock);
+        }
+        if (atomic_load_explicit(&pool->quit, memory_order_acquire))
+            return NULL;
+
+        seen = phase;
+        ladder_parallel_run(pool, thread->index);
+        atomic_fetch_add_explicit(&pool->done, 1, memory_order_release);
+    }
+}
+
+// Start a new phase on the workers
+static void ladder_parallel_phase(ladder_parallel_pool_t *pool) {
+    atomic_fetch_add_explicit(&pool->phase, 1, memory_order_release);
+    pthread_mutex_lock(&pool->lock);
+    if (pool->sleepers > 0)
+        pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Worker threads of the context, started on first use
+static ladder_parallel_pool_t* ladder_parallel_pool(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx->parallel != NULL)
+        return (ladder_parallel_pool_t*) ladder_ctx->parallel;
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online < 1)
+        online = 1;
+    // more threads than processors only adds wake up latency to every level
+    uint32_t workers = (ladder_ctx->ladder.workers == 0 || ladder_ctx->ladder.workers > (uint32_t) online) ? (uint32_t) online : ladder_ctx->ladder.workers;
+
+    ladder_parallel_pool_t *pool = calloc(1, sizeof(ladder_parallel_pool_t));
+    if (pool == NULL)
+        return NULL;
+    pool->thread = calloc(workers, sizeof(ladder_parallel_thread_t));
+    pool->ctx = ladder_ctx_array(workers);
+    if (pool->thread == NULL || pool->ctx == NULL || pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool->thread);
+        free(pool->ctx);
+        free(pool);
+        return NULL;
+    }
+    if (pthread_cond_init(&pool->wake, NULL) != 0) {
+        pthread_mutex_destroy(&pool->lock);
+        free(pool->thread);
+        free(pool->ctx);
+        free(pool);
+        return NULL;
+    }
+    atomic_init(&pool->phase, 0);
+    atomic_init(&pool->quit, false);
+    atomic_init(&pool->next, 0);
+    atomic_init(&pool->done, 0);
+
+    // worker n is pinned to processor n: the caller keeps its own affinity
+    pool->workers = 1;
+    for (uint32_t t = 1; t < workers; t++) {
+        pool->thread[t].pool = pool;
+        pool->thread[t].index = t;
+        if (pthread_create(&pool->thread[t].thread, NULL, ladder_parallel_worker, &pool->thread[t]) != 0)
+            break;
+#ifdef __linux__
+        cpu_set_t cpu;
+        CPU_ZERO(&cpu);
+        CPU_SET(t % (uint32_t) online, &cpu);
+        pthread_setaffinity_np(pool->thread[t].thread, sizeof(cpu_set_t), &cpu);
+#endif
+        pool->workers++;
+    }
+
+    ladder_ctx->parallel = pool;
+
+    return pool;
+}
+
+void ladder_parallel_pool_free(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->parallel == NULL)
+        return;
+
+    ladder_parallel_pool_t *pool = (ladder_parallel_pool_t*) ladder_ctx->parallel;
+    atomic_store_explicit(&pool->quit, true, memory_order_release);
+    ladder_parallel_phase(pool);
+    for (uint32_t t = 1; t < pool->workers; t++)
+        pthread_join(pool->thread[t].thread, NULL);
+
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->thread);
+    free(pool->ctx);
+    free(pool);
+    ladder_ctx->parallel = NULL;
+}
+
+// Execute one level on all threads
+static void ladder_parallel_level(ladder_parallel_pool_t *pool, const ladder_parallel_level_t *level) {
+    pool->level = level;
+    atomic_store_explicit(&pool->next, 0, memory_order_relaxed);
+
+    // a single network is not worth waking the workers
+    if (level->qty == 1 || pool->workers == 1) {
+        ladder_parallel_run(pool, 0);
+        return;
+    }
+
+    atomic_store_explicit(&pool->done, 0, memory_order_relaxed);
+    ladder_parallel_phase(pool);
+    ladder_parallel_run(pool, 0);
+
+    for (uint32_t spin = 0; atomic_load_explicit(&pool->done, memory_order_acquire) < pool->workers - 1; spin++) {
+        if (spin < LADDER_PARALLEL_SPIN)
+            LADDER_PARALLEL_PAUSE();
+        else
+            sched_yield();
+    }
+}
+
+// Publish results of networks [from, to) executed on workers as the sequential scan leaves them: last visited network and instruction
+static void ladder_parallel_merge(ladder_ctx_t *ladder_ctx, const ladder_parallel_t *parallel, uint32_t from, uint32_t to) {
+    bool executed = false;
+
+    for (uint32_t n = to; n > from; n--) {
+        const ladder_parallel_result_t *result = &parallel->result[n - 1];
+        if (!result->executed)
+            continue;
+        if (!executed) {
+            ladder_ctx->exec_network = &ladder_ctx->network[n - 1];
+            executed = true;
+        }
+        if (result->touched) {
+            ladder_ctx->ladder.last.instr = result->instr;
+            ladder_ctx->ladder.last.err = result->err;
+            ladder_ctx->ladder.last.network = n - 1;
+            ladder_ctx->ladder.last.cell_column = result->cell_column;
+            ladder_ctx->ladder.last.cell_row = result->cell_row;
+            return;
+        }
+    }
+}
+
+void ladder_scan_parallel(ladder_ctx_t *ladder_ctx) {
+    // hooks observe rungs in program order
+    if (ladder_ctx->on.instruction != NULL || ladder_ctx->on.scan_end != NULL) {
+        ladder_scan_compiled(ladder_ctx);
+        return;
+    }
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled != NULL && compiled->parallel == NULL)
+        compiled->parallel = ladder_parallel_build(ladder_ctx, compiled);
+    ladder_parallel_pool_t *pool = ladder_parallel_pool(ladder_ctx);
+    if (compiled == NULL || compiled->parallel == NULL || pool == NULL) {
+        ladder_scan_compiled(ladder_ctx);
+        return;
+    }
+    ladder_parallel_t *parallel = (ladder_parallel_t*) compiled->parallel;
+
+    // missing networks panic where the sequential scan does
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks; network++)
+        if (ladder_ctx->network[network].cells == NULL) {
+            ladder_scan_compiled(ladder_ctx);
+            return;
+        }
+
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    pool->compiled = compiled;
+    pool->schedule = parallel;
+    for (uint32_t t = 0; t < pool->workers; t++)
+        pool->ctx[t] = *ladder_ctx;
+    for (uint32_t network = 0; network < compiled->networks_qty; network++)
+        parallel->result[network].executed = false;
+
+    uint32_t merged = 0;
+    for (uint32_t l = 0; l < parallel->levels_qty; l++) {
+        const ladder_parallel_level_t *level = &parallel->level[l];
+
+        if (level->barrier) {
+            uint32_t network = parallel->order[level->first];
+            if (!ladder_ctx->network[network].enable)
+                continue;
+
+            // every previous network ran on earlier levels
+            ladder_parallel_merge(ladder_ctx, parallel, merged, network);
+            merged = network + 1;
+
+            const ladder_compiled_network_t *cnet = &compiled->network[network];
+            if (!(cnet->interpreted ? ladder_scan_network(ladder_ctx, network) : ladder_exec_network(ladder_ctx, network, cnet)))
+                return;
+            continue;
+        }
+
+        ladder_parallel_level(pool, level);
+
+        for (uint32_t n = level->first; n < level->first + level->qty; n++) {
+            const ladder_parallel_result_t *result = &parallel->result[parallel->order[n]];
+            if (result->executed && !result->ok) {
+                ladder_parallel_merge(ladder_ctx, parallel, merged, parallel->order[n] + 1);
+                ladder_ctx->ladder.state = LADDER_ST_INV;
+                return;
+            }
+        }
+    }
+
+    ladder_parallel_merge(ladder_ctx, parallel, merged, compiled->networks_qty);
+}
+
+#endif /* OPTIONAL_PARALLEL */
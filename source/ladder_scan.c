@@ -37,11 +37,12 @@
 #include "ladder.h"
 #include "ladder_instructions.h"
 #include "ladder_internals.h"
+#include "ladder_topology.h"
 #ifdef OPTIONAL_CRON
 #include "ladderlib_cron.h"
 #endif
 
-static ladder_fn_t const ladder_function[] = { //
+ladder_fn_t const ladder_function[] = { //
         fn_NOP,     // 00
         fn_CONN,    // 01
         fn_NEG,     // 02
@@ -83,7 +84,7 @@ static ladder_fn_t const ladder_function[] = { //
 
 // Array to flag instructions with side effects or required execution on false input (e.g., accumulation, resets, or power inversion).
 // This makes the check exhaustive and easier to maintain/expand.
-static const bool has_side_effects_on_false[LADDER_INS_INV] = { //
+const bool has_side_effects_on_false[LADDER_INS_INV] = { //
         false, // LADDER_INS_NOP
         false, // LADDER_INS_CONN
         true,  // LADDER_INS_NEG (inverts false to true, must execute for correct power flow)
@@ -123,8 +124,7 @@ static const bool has_side_effects_on_false[LADDER_INS_INV] = { //
         true   // LADDER_INS_TMOVE (potential sides)
         };
 
-void ladder_scan(ladder_ctx_t *ladder_ctx) {
-    uint32_t network = 0;
+bool ladder_scan_begin(ladder_ctx_t *ladder_ctx) {
     ladder_ctx->exec_network = NULL;
 #ifdef OPTIONAL_CRON
 // Auto_reset clearing before evaluation to prevent race conditions where set flags are immediately cleared, ensuring triggers are not missed in fast scans.
@@ -136,7 +136,7 @@ void ladder_scan(ladder_ctx_t *ladder_ctx) {
 // evaluate cron for actual time
         if (ladderlib_cron_eval(ladder_ctx) != LADDER_INS_ERR_OK) {
             ladder_ctx->ladder.state = LADDER_ST_INV;
-            return;
+            return false;
         }
     }
 #endif
@@ -147,166 +147,240 @@ void ladder_scan(ladder_ctx_t *ladder_ctx) {
         if (ladder_ctx->on.panic != NULL) {
             ladder_ctx->on.panic(ladder_ctx);
         }
-        return;
+        return false;
     }
-    uint64_t cycle_count = 0;
-    for (network = 0; network < ladder_ctx->ladder.quantity.networks; network++) {
-// Reset cycle_count to 0 at the start of each network to monitor per-network iterations independently,
-// preventing false overflows in multi-network programs and aligning with granular watchdog practices in PLCs.
-        cycle_count = 0;
-// Unconditional null check for cells before accessing enable, to catch corruption even in disabled networks
-        if (ladder_ctx->network[network].cells == NULL) {
+
+    return true;
+}
+
+// Add watchdog cycles. Cycles are counted one by one only once the 80% threshold is reached, so warnings and abort happen exactly on the
+// cycle they would happen walking the network cell by cell.
+static inline bool ladder_scan_cycles(ladder_ctx_t *ladder_ctx, uint64_t *cycle_count, uint64_t cycles) {
+    if (*cycle_count + cycles <= (ladder_ctx->scan_internals.max_scan_cycles * 0.8)) {
+        *cycle_count += cycles;
+        return true;
+    }
+
+    while (cycles-- > 0) {
+        ++(*cycle_count);
+// Check for near-threshold (80% of max) to log potential high-usage via panic callback,
+// allowing diagnostics without immediate fault, as recommended in embedded watchdog best practices.
+        if (*cycle_count > (ladder_ctx->scan_internals.max_scan_cycles * 0.8)) {
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);  // Used as warning; future: add dedicated on.warning.
+            }
+        }
+        if (*cycle_count > ladder_ctx->scan_internals.max_scan_cycles) {
             ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_OVERFLOW;  // Reuse overflow error for cycle limit
             if (ladder_ctx->on.panic != NULL) {
                 ladder_ctx->on.panic(ladder_ctx);
             }
-            return;
+            return false;  // Abort scan early
         }
-        if (!ladder_ctx->network[network].enable)
-            continue;
-        ladder_ctx->exec_network = &(ladder_ctx->network[network]);
+    }
 
-// Clear all cell states to ensure fresh evaluation each scan cycle
-// This prevents retention of states from previous scans, which could lead to incorrect power flow
-        for (uint32_t column = 0; column < ladder_ctx->exec_network->cols; column++) {
-            for (uint32_t row = 0; row < ladder_ctx->exec_network->rows; row++) {
-                ladder_ctx->exec_network->cells[row][column].state = false;
-            }
-        }
-        uint32_t row = 0;
-        while (row < ladder_ctx->exec_network->rows) {
-// Increment cycle counter for row processing loop and check against max to prevent infinite loops
-            ++cycle_count;
-// Check for near-threshold (80% of max) to log potential high-usage via panic callback,
-// allowing diagnostics without immediate fault, as recommended in embedded watchdog best practices.
-            if (cycle_count > (ladder_ctx->scan_internals.max_scan_cycles * 0.8)) {
-                if (ladder_ctx->on.panic != NULL) {
-                    ladder_ctx->on.panic(ladder_ctx);  // Used as warning; future: add dedicated on.warning.
-                }
-            }
-            if (cycle_count > ladder_ctx->scan_internals.max_scan_cycles) {
-                ladder_ctx->ladder.state = LADDER_ST_ERROR;
-                ladder_ctx->ladder.last.err = LADDER_INS_ERR_OVERFLOW;  // Reuse overflow error for cycle limit
-                if (ladder_ctx->on.panic != NULL) {
-                    ladder_ctx->on.panic(ladder_ctx);
-                }
-                return;  // Abort scan early
-            }
-// Skip if this row is part of a multi-cell group from above (LADDER_INS_MULTI)
-            if (ladder_ctx->exec_network->cells[row][0].code == LADDER_INS_MULTI) {
-                row++;
-                continue;
-            }
-// Detect the vertical group starting at this row (for stacked multi-cell)
-            uint32_t group_start = row;
-            uint32_t group_end = row;
-            while (group_end + 1 < ladder_ctx->exec_network->rows && ladder_ctx->exec_network->cells[group_end + 1][0].vertical_bar) {
-                group_end++;
-            }
-// Detect if this is a lower branch (vertical_bar true in any column, but not if next row is MULTI for multi-cell distinction).
-            bool is_lower = false;
-            for (uint32_t c = 0; c < ladder_ctx->exec_network->cols; c++) {
-                if (ladder_ctx->exec_network->cells[row][c].vertical_bar) {
-                    bool is_multi = (row + 1 < ladder_ctx->exec_network->rows) && (ladder_ctx->exec_network->cells[row + 1][c].code == LADDER_INS_MULTI);
-                    if (!is_multi) {
-                        is_lower = true;
-                        break;
-                    }
-                }
-            }
-// Initialize power for this rung/group (left rail energized for main rungs, false for lower branches)
-            bool rung_power = !is_lower;
-// Inner loop: Scan left-to-right across columns for this rung
-            for (uint32_t column = 0; column < ladder_ctx->exec_network->cols; column++) {
-// Re-detect group for consistency (assume vertical structure consistent across columns)
-                uint32_t col_group_end = group_start;
-                while (col_group_end + 1 < ladder_ctx->exec_network->rows && ladder_ctx->exec_network->cells[col_group_end + 1][column].vertical_bar) {
-                    col_group_end++;
-                }
-// Check if safe to skip this column for the rung
-                bool skip_safe = true;
-                for (uint32_t gr = group_start; gr <= col_group_end; gr++) {
-// Increment cycle counter for group processing loop and check against max to prevent infinite loops
-                    ++cycle_count;
-// Check for near-threshold (80% of max) to log potential high-usage via panic callback,
-// allowing diagnostics without immediate fault, as recommended in embedded watchdog best practices.
-                    if (cycle_count > (ladder_ctx->scan_internals.max_scan_cycles * 0.8)) {
-                        if (ladder_ctx->on.panic != NULL) {
-                            ladder_ctx->on.panic(ladder_ctx);  // Used as warning; future: add dedicated on.warning.
-                        }
-                    }
-                    if (cycle_count > ladder_ctx->scan_internals.max_scan_cycles) {
-                        ladder_ctx->ladder.state = LADDER_ST_ERROR;
-                        ladder_ctx->ladder.last.err = LADDER_INS_ERR_OVERFLOW; // Reuse overflow error for cycle limit
-                        if (ladder_ctx->on.panic != NULL) {
-                            ladder_ctx->on.panic(ladder_ctx);
-                        }
-                        return; // Abort scan early
-                    }
-                    ladder_instruction_t code = ladder_ctx->exec_network->cells[gr][column].code;
-                    if (code == LADDER_INS_MULTI) {
-// Treat MULTI as potentially unsafe (part of multi-cell like timers/counters).
-                        skip_safe = false;
-                        break;
-                    }
-                    if (has_side_effects_on_false[code]) {
-                        skip_safe = false;
-                        break;
-                    }
-                }
-// Short-circuit only if no power and column is safe to skip (no side effects)
-                if (!rung_power && skip_safe) {
-                    continue;
-                }
-                bool group_output = false;
-                bool group_error = false;
-                for (uint32_t gr = group_start; gr <= col_group_end; gr++) {
-// Set current row for last instr tracking
-                    uint32_t current_row_for_exec = gr;
+    return true;
+}
+
+// The column walk stays inlined in the network loop once the instruction call fills a frame
+#if defined(__GNUC__) || defined(__clang__)
+#define LADDER_SCAN_INLINE inline __attribute__((always_inline))
+#else
+#define LADDER_SCAN_INLINE inline
+#endif
+
+// Instruction call on a frame filled from the network cells
+static inline ladder_ins_err_t ladder_scan_cell(ladder_ctx_t *ladder_ctx, ladder_instruction_t code, uint32_t column, uint32_t row) {
+    ladder_frame_t frame;
+
+    ladder_frame_cell(&frame, ladder_ctx, column, row);
+    if (code >= LADDER_INS_CUSTOM)
+        return ladder_ctx->custom[code - LADDER_INS_CUSTOM].exec(&frame);
+    return ladder_function[code](&frame);
+}
+
+// Scan loop variants. The walk is instantiated once per combination of installed hooks so the production loop (no hooks) carries no
+// per cell test nor ladder.last bookkeeping. Without per instruction and panic hooks nobody reads ladder.last during the walk: it is set at
+// the rung end and on the failing cell, as the traced walk leaves it.
+#define LADDER_SCAN_TRACE 0x01 // ladder.last follows every cell
+#define LADDER_SCAN_INSTR 0x02 // per instruction hook
+#define LADDER_SCAN_END   0x04 // rung end hook
+
+// Record the cell being executed
+static inline void ladder_scan_last(ladder_ctx_t *ladder_ctx, ladder_instruction_t code, uint32_t network, uint32_t row, uint32_t column) {
+    ladder_ctx->ladder.last.instr = code;
+    ladder_ctx->ladder.last.err = LADDER_INS_ERR_OK;
+    ladder_ctx->ladder.last.network = network;
+    ladder_ctx->ladder.last.cell_row = row;
+    ladder_ctx->ladder.last.cell_column = column;
+}
+
+// Execute the cells of one rung column and merge the group output. False on error (state set to INV).
+static LADDER_SCAN_INLINE bool ladder_scan_column(ladder_ctx_t *ladder_ctx, uint32_t network, uint32_t group_start, uint32_t column,
+        const ladder_topology_column_t *tc, const uint32_t variant) {
+    bool group_output = false;
+    for (uint32_t gr = group_start; gr <= tc->group_end; gr++) {
+        ladder_instruction_t code = ladder_ctx->exec_network->cells[gr][column].code;
 // save this execution
-                    ladder_ctx->ladder.last.instr = ladder_ctx->exec_network->cells[current_row_for_exec][column].code;
-                    ladder_ctx->ladder.last.err = LADDER_INS_ERR_OK;
-                    ladder_ctx->ladder.last.network = network;
-                    ladder_ctx->ladder.last.cell_row = current_row_for_exec;
-                    ladder_ctx->ladder.last.cell_column = column;
-                    ladder_instruction_t code = ladder_ctx->exec_network->cells[current_row_for_exec][column].code;
-// evaluation for an invalid code if the cell is not part of an instruction that uses more than one cell
-                    if (code >= LADDER_INS_INV && code != LADDER_INS_MULTI) {
-                        ladder_ctx->ladder.state = LADDER_ST_INV;
-                        ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
-                        group_error = true;
-                        break;  // Break loop on error to proceed to restore.
-                    }
+        if (variant & LADDER_SCAN_TRACE)
+            ladder_scan_last(ladder_ctx, code, network, gr, column);
+// evaluation for an invalid code if the cell is not part of an instruction that uses more than one cell nor a registered custom instruction
+        if (code >= LADDER_INS_INV && code != LADDER_INS_MULTI && ladder_custom_get(ladder_ctx, code) == NULL) {
+            if (!(variant & LADDER_SCAN_TRACE))
+                ladder_scan_last(ladder_ctx, code, network, gr, column);
+            ladder_ctx->ladder.state = LADDER_ST_INV;
+            ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+            return false;
+        }
 // execute instruction
-                    if (code != LADDER_INS_MULTI) {
-                        ladder_ctx->ladder.last.err = ladder_function[code](ladder_ctx, column, current_row_for_exec);
-                        if (ladder_ctx->ladder.last.err != LADDER_INS_ERR_OK) {
-                            group_error = true;
-                            break;
-                        }
-                        if (ladder_ctx->on.instruction != NULL)
-                            ladder_ctx->on.instruction(ladder_ctx);
-                    }
-                }
-// On group error, propagate error
-                if (group_error) {
-                    ladder_ctx->ladder.state = LADDER_ST_INV;
-                    return;
-                }
+        if (code != LADDER_INS_MULTI) {
+            ladder_ins_err_t err = ladder_scan_cell(ladder_ctx, code, column, gr);
+            if (variant & LADDER_SCAN_TRACE)
+                ladder_ctx->ladder.last.err = err;
+            if (err != LADDER_INS_ERR_OK) {
+                if (!(variant & LADDER_SCAN_TRACE))
+                    ladder_scan_last(ladder_ctx, code, network, gr, column);
+                ladder_ctx->ladder.last.err = err;
+                ladder_ctx->ladder.state = LADDER_ST_INV;
+                return false;
+            }
+            if ((variant & LADDER_SCAN_INSTR) && ladder_ctx->on.instruction != NULL)
+                ladder_ctx->on.instruction(ladder_ctx);
+        }
+    }
 // Captures multi-output settings (e.g., CTU sets state[row]=done, state[row+1]=overflow); used for power continuation.
-                group_output = false;
-                for (uint32_t gr = group_start; gr <= col_group_end; gr++) {
-                    group_output |= ladder_ctx->exec_network->cells[gr][column].state;
-                }
+    if (tc->group_end == group_start)
+        return true;
+    for (uint32_t gr = group_start; gr <= tc->group_end; gr++) {
+        group_output |= ladder_ctx->exec_network->cells[gr][column].state;
+    }
 // Set uniform group output to all rows in group (ORed flow to right)
-                for (uint32_t gr = group_start; gr <= col_group_end; gr++) {
-                    ladder_ctx->exec_network->cells[gr][column].state = group_output;
+    for (uint32_t gr = group_start; gr <= tc->group_end; gr++) {
+        ladder_ctx->exec_network->cells[gr][column].state = group_output;
+    }
+
+    return true;
+}
+
+static LADDER_SCAN_INLINE bool ladder_scan_walk(ladder_ctx_t *ladder_ctx, uint32_t network, const uint32_t variant) {
+// Reset cycle_count to 0 at the start of each network to monitor per-network iterations independently,
+// preventing false overflows in multi-network programs and aligning with granular watchdog practices in PLCs.
+    uint64_t cycle_count = 0;
+    ladder_ctx->exec_network = &(ladder_ctx->network[network]);
+
+// Rung groups, merges and skippable columns only change when the program is edited: they come from the topology cache
+    const ladder_topology_network_t *tnet = ladder_topology_get(ladder_ctx, network);
+    if (tnet == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;
+        if (ladder_ctx->on.panic != NULL) {
+            ladder_ctx->on.panic(ladder_ctx);
+        }
+        return false;
+    }
+
+// Clear cell states to ensure fresh evaluation each scan cycle
+// This prevents retention of states from previous scans, which could lead to incorrect power flow. Cells that can't be powered stay cleared.
+    ladder_topology_clear(ladder_ctx->exec_network, tnet->clear, 0, tnet->clear_start[tnet->rows]);
+    for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+        const ladder_topology_rung_t *rung = &tnet->rung[r];
+        uint32_t group_start = rung->row_start;
+// Watchdog: a rung under the warning threshold is accounted at once, otherwise column by column as the walk proceeds
+        bool per_column = (cycle_count + rung->cycles > (ladder_ctx->scan_internals.max_scan_cycles * 0.8));
+        if (!ladder_scan_cycles(ladder_ctx, &cycle_count, per_column ? rung->lead_cycles : rung->cycles))
+            return false;
+// Sparse walk: columns holding only NOP cells do nothing but update ladder.last, which is restored at the rung end. Per instruction hooks
+// and per column watchdog need the full walk.
+        if (!per_column && !(variant & LADDER_SCAN_INSTR)) {
+            for (uint32_t l = 0; l < rung->live_qty; l++)
+                if (!ladder_scan_column(ladder_ctx, network, group_start, rung->live[l], &rung->column[rung->live[l]], variant))
+                    return false;
+            if (rung->live_end > 0)
+                ladder_scan_last(ladder_ctx, ladder_ctx->exec_network->cells[rung->last_row][rung->last_column].code, network, rung->last_row,
+                        rung->last_column);
+        } else {
+// Inner loop: Scan left-to-right across columns for this rung. Columns past live_end are lower branch columns without side effects.
+// The watchdog may stop on any cell, so ladder.last follows every cell.
+            for (uint32_t column = 0; column < rung->live_end; column++) {
+                const ladder_topology_column_t *tc = &rung->column[column];
+                if (per_column && !ladder_scan_cycles(ladder_ctx, &cycle_count, tc->cycles))
+                    return false;
+// Short-circuit lower branches (no power) on columns safe to skip (no side effects)
+                if (tc->skip)
+                    continue;
+                if (!ladder_scan_column(ladder_ctx, network, group_start, column, tc, variant | LADDER_SCAN_TRACE))
+                    return false;
+            }
+// Skipped suffix still counts for the watchdog
+            if (per_column) {
+                for (uint32_t column = rung->live_end; column < tnet->cols; column++) {
+                    if (!ladder_scan_cycles(ladder_ctx, &cycle_count, rung->column[column].cycles))
+                        return false;
                 }
             }
-            if (ladder_ctx->on.scan_end != NULL)
-                ladder_ctx->on.scan_end(ladder_ctx);
-// Advance to next rung after processing the group
-            row = group_end + 1;
         }
+        if ((variant & LADDER_SCAN_END) && ladder_ctx->on.scan_end != NULL)
+            ladder_ctx->on.scan_end(ladder_ctx);
+    }
+
+// Multi-cell rows after the last rung
+    return ladder_scan_cycles(ladder_ctx, &cycle_count, tnet->tail_cycles);
+}
+
+#define LADDER_SCAN_VARIANT(variant)                                                          \
+static bool ladder_scan_walk_##variant(ladder_ctx_t *ladder_ctx, uint32_t network) {          \
+    return ladder_scan_walk(ladder_ctx, network, variant);                                    \
+}
+
+LADDER_SCAN_VARIANT(0)
+LADDER_SCAN_VARIANT(1)
+LADDER_SCAN_VARIANT(3)
+LADDER_SCAN_VARIANT(4)
+LADDER_SCAN_VARIANT(5)
+LADDER_SCAN_VARIANT(7)
+
+// Indexed by variant flags. The per instruction hook is always traced.
+static bool (*const ladder_scan_walk_variant[])(ladder_ctx_t*, uint32_t) = { //
+        ladder_scan_walk_0, // no hooks
+        ladder_scan_walk_1, // TRACE
+        ladder_scan_walk_3, // INSTR
+        ladder_scan_walk_3, // INSTR | TRACE
+        ladder_scan_walk_4, // END
+        ladder_scan_walk_5, // END | TRACE
+        ladder_scan_walk_7, // END | INSTR
+        ladder_scan_walk_7, // END | INSTR | TRACE
+        };
+
+bool ladder_scan_network(ladder_ctx_t *ladder_ctx, uint32_t network) {
+// The variant follows the hooks installed when the network starts: installing or removing a hook takes effect on the next network
+    uint32_t variant = 0;
+    if (ladder_ctx->on.instruction != NULL)
+        variant |= LADDER_SCAN_INSTR | LADDER_SCAN_TRACE;
+    if (ladder_ctx->on.panic != NULL)
+        variant |= LADDER_SCAN_TRACE;
+    if (ladder_ctx->on.scan_end != NULL)
+        variant |= LADDER_SCAN_END;
+
+    return ladder_scan_walk_variant[variant](ladder_ctx, network);
+}
+
+void ladder_scan(ladder_ctx_t *ladder_ctx) {
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    for (uint32_t network = 0; network < ladder_ctx->ladder.quantity.networks; network++) {
+// Unconditional null check for cells before accessing enable, to catch corruption even in disabled networks
+        if (ladder_ctx->network[network].cells == NULL) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            if (ladder_ctx->on.panic != NULL) {
+                ladder_ctx->on.panic(ladder_ctx);
+            }
+            return;
+        }
+        if (!ladder_ctx->network[network].enable)
+            continue;
+        if (!ladder_scan_network(ladder_ctx, network))
+            return;
     }
 }
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "ladder.h"
+#include "ladder_compile.h"
+#include "ladder_slice.h"
+#include "ladder_topology.h"
+
+#ifdef OPTIONAL_COMPILED
+
+/**
+ * @struct ladder_slice_rung_s
+ * @brief Compiled rung seen by the grouping pass
+ *
+ */
+typedef struct ladder_slice_rung_s {
+    uint32_t first_op;  /**< First operation */
+    uint32_t end_op;    /**< Rung end operation */
+    uint32_t row_start; /**< First row */
+    uint32_t height;    /**< Rows */
+        bool boolean;   /**< Only boolean operations on its own rows, with a coil */
+} ladder_slice_rung_t;
+
+static bool ladder_slice_flag_op(uint8_t op) {
+    return op == LADDER_OP_NO_BOUND || op == LADDER_OP_NC_BOUND || op == LADDER_OP_COIL_BOUND;
+}
+
+static bool ladder_slice_boolean(const ladder_compiled_network_t *cnet, const ladder_slice_rung_t *rung) {
+    uint32_t row_end = rung->row_start + rung->height - 1;
+    bool coil = false;
+
+    for (uint32_t o = rung->first_op; o < rung->end_op; o++) {
+        const ladder_op_t *op = &cnet->ops[o];
+        switch (op->op) {
+            case LADDER_INS_CONN:
+            case LADDER_INS_NEG:
+            case LADDER_OP_WIRE:
+            case LADDER_OP_NO_BOUND:
+            case LADDER_OP_NC_BOUND:
+                break;
+            case LADDER_OP_COIL_BOUND:
+                coil = true;
+                break;
+            case LADDER_OP_MERGE:
+                // a vertical group reaching the next rung shares cells with it
+                if (op->row_end > row_end)
+                    return false;
+                break;
+            default:
+                return false;
+        }
+        if (op->row < rung->row_start || op->row > row_end)
+            return false;
+    }
+
+    return coil;
+}
+
+// Same operations on the same cells relative to the first row of the rung
+static bool ladder_slice_same(const ladder_compiled_network_t *cnet, const ladder_slice_rung_t *a, const ladder_slice_rung_t *b) {
+    if (a->height != b->height || a->end_op - a->first_op != b->end_op - b->first_op)
+        return false;
+
+    for (uint32_t o = 0; o <= a->end_op - a->first_op; o++) {
+        const ladder_op_t *x = &cnet->ops[a->first_op + o], *y = &cnet->ops[b->first_op + o];
+        if (x->op != y->op || x->code != y->code || x->column != y->column || x->row - a->row_start != y->row - b->row_start)
+            return false;
+        if (x->op == LADDER_OP_MERGE && x->row_end - a->row_start != y->row_end - b->row_start)
+            return false;
+        if ((x->op == LADDER_OP_WIRE || x->op == LADDER_OP_RUNG_END) && (x->operand != y->operand || x->row_end != y->row_end))
+            return false;
+    }
+
+    return true;
+}
+
+// A flag written by a rung can't be read nor written by another rung of the group
+static bool ladder_slice_independent(const ladder_compiled_network_t *cnet, const ladder_slice_rung_t *rung, uint32_t lanes, const ladder_slice_rung_t *add) {
+    for (uint32_t o = add->first_op; o < add->end_op; o++) {
+        const ladder_op_t *x = &cnet->ops[o];
+        if (!ladder_slice_flag_op(x->op))
+            continue;
+        for (uint32_t l = 0; l < lanes; l++) {
+            for (uint32_t p = rung[l].first_op; p < rung[l].end_op; p++) {
+                const ladder_op_t *y = &cnet->ops[p];
+                if (ladder_slice_flag_op(y->op) && (x->op == LADDER_OP_COIL_BOUND || y->op == LADDER_OP_COIL_BOUND)
+                        && cnet->operands[x->operand].ptr == cnet->operands[y->operand].ptr)
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool ladder_slice_add(ladder_compiled_network_t *cnet, const ladder_slice_rung_t *rung, uint32_t lanes) {
+    ladder_slice_t *tmp = realloc(cnet->slice, (cnet->slices_qty + 1) * sizeof(ladder_slice_t));
+    if (tmp == NULL)
+        return false;
+    cnet->slice = tmp;
+
+    ladder_slice_t *slice = &cnet->slice[cnet->slices_qty];
+    slice->first_op = rung[0].first_op;
+    slice->last_op = rung[lanes - 1].end_op;
+    slice->ops_qty = rung[0].end_op - rung[0].first_op;
+    slice->row_start = rung[0].row_start;
+    slice->height = rung[0].height;
+    slice->lanes = lanes;
+    slice->lane_mask = 0;
+    for (uint32_t l = 0; l < lanes; l++)
+        slice->lane_mask |= (uint32_t) 1 << rung[l].row_start;
+
+    slice->flag = calloc((size_t) slice->ops_qty * lanes, sizeof(uint8_t*));
+    if (slice->flag == NULL)
+        return false;
+    cnet->slices_qty++;
+
+    for (uint32_t o = 0; o < slice->ops_qty; o++)
+        for (uint32_t l = 0; l < lanes; l++) {
+            const ladder_op_t *op = &cnet->ops[rung[l].first_op + o];
+            if (ladder_slice_flag_op(op->op))
+                slice->flag[o * lanes + l] = (uint8_t*) cnet->operands[op->operand].ptr;
+        }
+
+    return true;
+}
+
+bool ladder_slice_network(const ladder_topology_network_t *tnet, ladder_compiled_network_t *cnet) {
+    if (cnet->interpreted || cnet->ops == NULL || tnet->rungs_qty < 2)
+        return true;
+
+    ladder_slice_rung_t *rung = calloc(tnet->rungs_qty, sizeof(ladder_slice_rung_t));
+    if (rung == NULL)
+        return false;
+
+    // an invalid instruction ends the operations before the last rung
+    uint32_t rungs_qty = 0, first_op = 0;
+    for (uint32_t o = 0; o < cnet->ops_qty && rungs_qty < tnet->rungs_qty; o++) {
+        if (cnet->ops[o].op == LADDER_OP_INV || cnet->ops[o].op == LADDER_OP_END)
+            break;
+        if (cnet->ops[o].op != LADDER_OP_RUNG_END)
+            continue;
+        ladder_slice_rung_t *r = &rung[rungs_qty];
+        r->first_op = first_op;
+        r->end_op = o;
+        r->row_start = tnet->rung[rungs_qty].row_start;
+        r->height = tnet->rung[rungs_qty].row_end - r->row_start + 1;
+        r->boolean = ladder_slice_boolean(cnet, r);
+        first_op = o + 1;
+        rungs_qty++;
+    }
+
+    bool ok = true;
+    for (uint32_t r = 0; r < rungs_qty && ok;) {
+        uint32_t lanes = 1;
+        if (rung[r].boolean)
+            while (r + lanes < rungs_qty && rung[r + lanes].boolean && rung[r + lanes].row_start == rung[r].row_start + lanes * rung[r].height
+                    && ladder_slice_same(cnet, &rung[r], &rung[r + lanes]) && ladder_slice_independent(cnet, &rung[r], lanes, &rung[r + lanes]))
+                lanes++;
+        if (lanes > 1)
+            ok = ladder_slice_add(cnet, &rung[r], lanes);
+        r += lanes;
+    }
+
+    free(rung);
+    return ok;
+}
+
+static inline uint32_t ladder_slice_gather(const ladder_slice_t *slice, uint8_t *const *flag, uint32_t row) {
+    uint32_t word = 0;
+    for (uint32_t l = 0; l < slice->lanes; l++, row += slice->height)
+        word |= (uint32_t) (*flag[l] != 0) << row;
+
+    return word;
+}
+
+static inline void ladder_slice_scatter(const ladder_slice_t *slice, uint8_t *const *flag, uint32_t row, uint32_t word) {
+    for (uint32_t l = 0; l < slice->lanes; l++, row += slice->height)
+        *flag[l] = (word >> row) & 1;
+}
+
+void ladder_slice_exec(const ladder_compiled_network_t *cnet, const ladder_slice_t *slice) {
+    // column power masks start with the left rail
+    uint32_t *power = cnet->power;
+    const ladder_op_t *op = &cnet->ops[slice->first_op];
+    uint8_t *const *flag = slice->flag;
+
+    for (uint32_t o = 0; o < slice->ops_qty; o++, op++, flag += slice->lanes) {
+        uint32_t lanes = slice->lane_mask << (op->row - slice->row_start);
+        uint32_t left = power[op->column];
+        uint32_t value;
+
+        switch (op->op) {
+            case LADDER_OP_NO_BOUND:
+                value = left & ladder_slice_gather(slice, flag, op->row);
+                break;
+            case LADDER_OP_NC_BOUND:
+                value = left & ~ladder_slice_gather(slice, flag, op->row);
+                break;
+            case LADDER_INS_NEG:
+                value = ~left;
+                break;
+            case LADDER_OP_WIRE:
+                value = power[op->operand];
+                break;
+            case LADDER_OP_COIL_BOUND:
+                value = left;
+                ladder_slice_scatter(slice, flag, op->row, value);
+                break;
+            case LADDER_OP_MERGE: {
+                // OR the group rows of every lane on its first row, then broadcast
+                uint32_t column = power[op->column + 1], any = 0, group = 0, out = 0;
+                for (uint32_t r = 0; r <= (uint32_t) (op->row_end - op->row); r++)
+                    any |= (column >> r) & lanes;
+                for (uint32_t r = 0; r <= (uint32_t) (op->row_end - op->row); r++) {
+                    group |= lanes << r;
+                    out |= any << r;
+                }
+                power[op->column + 1] = (column & ~group) | out;
+                continue;
+            }
+            default: // LADDER_INS_CONN
+                value = left;
+                break;
+        }
+        power[op->column + 1] = (power[op->column + 1] & ~lanes) | (value & lanes);
+    }
+}
+
+void ladder_slice_free(ladder_compiled_network_t *cnet) {
+    for (uint32_t s = 0; s < cnet->slices_qty; s++)
+        free(cnet->slice[s].flag);
+    free(cnet->slice);
+    cnet->slice = NULL;
+    cnet->slices_qty = 0;
+}
+
+#endif /* OPTIONAL_COMPILED */
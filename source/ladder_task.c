@@ -36,246 +36,256 @@
 
 #include "ladder.h"
 #include "ladder_internals.h"
+#include "ladder_bits.h"
 
 #define MAX_WAIT_CYCLES 1000
 
-void ladder_task(void *ladderctx) {
-    if (ladderctx == NULL)
-        return;
-
-    ladder_ctx_t *ladder_ctx = (ladder_ctx_t*) ladderctx;
-
-    if (ladder_ctx == NULL || ladder_ctx->hw.time.millis == NULL || ladder_ctx->hw.time.delay == NULL
+// Time functions, I/O modules and memory areas are set
+static bool ladder_task_complete(const ladder_ctx_t *ladder_ctx) {
+    return !(ladder_ctx == NULL || ladder_ctx->hw.time.millis == NULL || ladder_ctx->hw.time.delay == NULL
             || (ladder_ctx->hw.io.fn_read_qty > 0 && (ladder_ctx->hw.io.read == NULL || ladder_ctx->input == NULL || ladder_ctx->hw.io.read[0] == NULL))
             || (ladder_ctx->hw.io.fn_write_qty > 0 && (ladder_ctx->hw.io.write == NULL || ladder_ctx->output == NULL || ladder_ctx->hw.io.write[0] == NULL))
-            || (ladder_ctx->ladder.quantity.m > 0 && (ladder_ctx->memory.M == NULL || ladder_ctx->prev_scan_vals.Mh == NULL))
+            || (ladder_ctx->ladder.quantity.m > 0 && (ladder_ctx->memory.M == NULL || LADDER_HISTORY(ladder_ctx, M) == NULL))
             || (ladder_ctx->ladder.quantity.c > 0
-                    && (ladder_ctx->memory.Cd == NULL || ladder_ctx->memory.Cr == NULL || ladder_ctx->prev_scan_vals.Cdh == NULL
-                            || ladder_ctx->prev_scan_vals.Crh == NULL || ladder_ctx->registers.C == NULL))
+                    && (ladder_ctx->memory.Cd == NULL || ladder_ctx->memory.Cr == NULL || LADDER_HISTORY(ladder_ctx, Cd) == NULL
+                            || LADDER_HISTORY(ladder_ctx, Cr) == NULL || ladder_ctx->registers.C == NULL))
             || (ladder_ctx->ladder.quantity.t > 0
-                    && (ladder_ctx->memory.Td == NULL || ladder_ctx->memory.Tr == NULL || ladder_ctx->prev_scan_vals.Tdh == NULL
-                            || ladder_ctx->prev_scan_vals.Trh == NULL || ladder_ctx->timers == NULL))
+                    && (ladder_ctx->memory.Td == NULL || ladder_ctx->memory.Tr == NULL || LADDER_HISTORY(ladder_ctx, Td) == NULL
+                            || LADDER_HISTORY(ladder_ctx, Tr) == NULL || ladder_ctx->timers == NULL))
             || (ladder_ctx->ladder.quantity.d > 0 && ladder_ctx->registers.D == NULL) || (ladder_ctx->ladder.quantity.r > 0 && ladder_ctx->registers.R == NULL)
-            || (ladder_ctx->ladder.quantity.networks > 0 && ladder_ctx->network == NULL)) {
+            || (ladder_ctx->ladder.quantity.networks > 0 && ladder_ctx->network == NULL));
+}
+
+// Hardware functions are public fields and can be replaced after the program was sealed
+static inline bool ladder_task_hw(const ladder_ctx_t *ladder_ctx) {
+    return ladder_ctx->hw.time.millis != NULL && ladder_ctx->hw.time.delay != NULL
+            && (ladder_ctx->hw.io.fn_read_qty == 0 || ladder_ctx->hw.io.read != NULL)
+            && (ladder_ctx->hw.io.fn_write_qty == 0 || ladder_ctx->hw.io.write != NULL);
+}
+
+// Context can run. Sealed contexts had modules and memory areas checked with the program.
+static bool ladder_task_ready(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || (ladder_ctx->ladder.sealed ? !ladder_task_hw(ladder_ctx) : !ladder_task_complete(ladder_ctx))) {
         if (ladder_ctx != NULL)
             ladder_ctx->ladder.state = LADDER_ST_NULLFN;
-        return;
+        return false;
     }
 
-    // task main loop
-    while (ladder_ctx->ladder.state != LADDER_ST_EXIT_TSK) {
-        // Inner while with bounded loop using wait_count to prevent infinite wait.
-        // Initializes counter, adds timeout condition, retains EXIT_TSK check, and sets ERROR on timeout.
-        uint32_t wait_count = 0;
-        while (ladder_ctx->ladder.state != LADDER_ST_RUNNING && wait_count < MAX_WAIT_CYCLES) {
-            if (ladder_ctx->ladder.state == LADDER_ST_EXIT_TSK)
-                return;
-            // Check delay before call.
-            if (ladder_ctx->hw.time.delay == NULL) {
-                ladder_ctx->ladder.state = LADDER_ST_ERROR;
-                if (ladder_ctx->on.panic != NULL) {
-                    ladder_ctx->on.panic(ladder_ctx);
-                }
-                // No-op fallback: no delay.
-            } else {
-                ladder_ctx->hw.time.delay(ladder_ctx->ladder.quantity.delay_not_run);
-            }
-            wait_count++;
-        }
+    return true;
+}
 
-        if (wait_count >= MAX_WAIT_CYCLES) {
-            ladder_ctx->ladder.state = LADDER_ST_ERROR;
-            // Invoke panic here after timeout, integrating it into the error path for consistency.
-            if (ladder_ctx->on.panic != NULL)
-                ladder_ctx->on.panic(ladder_ctx);
-            // Unconditionally set to EXIT_TSK after panic to prevent potential infinite loop if panic doesn't recover state.
-            ladder_ctx->ladder.state = LADDER_ST_EXIT_TSK;
-        }
+bool ladder_seal(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL)
+        return false;
 
-        // Proceed only if now RUNNING (after wait or direct)
-        if (ladder_ctx->ladder.state != LADDER_ST_RUNNING) {
-            continue;  // Skip to next iteration if still not running after wait/timeout.
-        }
+    ladder_ctx->ladder.sealed = false;
+    if (!ladder_task_complete(ladder_ctx))
+        return false;
 
-        // Set start_time here to capture full cycle time (before pre-hook, reads, scan, writes)
-        if (ladder_ctx->hw.time.millis == NULL) {
-            ladder_ctx->scan_internals.start_time = 0;  // Fallback
-            ladder_ctx->ladder.state = LADDER_ST_ERROR;
-            if (ladder_ctx->on.panic != NULL) {
-                ladder_ctx->on.panic(ladder_ctx);
-            }
-        } else {
-            ladder_ctx->scan_internals.start_time = ladder_ctx->hw.time.millis();
+    // every module area and function the unchecked accesses reach
+    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++)
+        if (ladder_ctx->hw.io.read[n] == NULL || (ladder_ctx->input[n].i_qty > 0 && (ladder_ctx->input[n].I == NULL || ladder_ctx->input[n].Ih == NULL))
+                || (ladder_ctx->input[n].iw_qty > 0 && (ladder_ctx->input[n].IW == NULL || ladder_ctx->input[n].IWh == NULL)))
+            return false;
+    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++)
+        if (ladder_ctx->hw.io.write[n] == NULL || (ladder_ctx->output[n].q_qty > 0 && (ladder_ctx->output[n].Q == NULL || ladder_ctx->output[n].Qh == NULL))
+                || (ladder_ctx->output[n].qw_qty > 0 && (ladder_ctx->output[n].QW == NULL || ladder_ctx->output[n].QWh == NULL)))
+            return false;
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++)
+        if (ladder_ctx->network[n].cells == NULL)
+            return false;
+
+    ladder_ctx->ladder.sealed = true;
+    return true;
+}
+
+bool ladder_task_begin(ladder_ctx_t *ladder_ctx) {
+    // Set start_time here to capture full cycle time (before pre-hook, reads, scan, writes)
+    if (ladder_ctx->hw.time.millis == NULL) {
+        ladder_ctx->scan_internals.start_time = 0;  // Fallback
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL) {
+            ladder_ctx->on.panic(ladder_ctx);
         }
+    } else {
+        ladder_ctx->scan_internals.start_time = ladder_ctx->hw.time.millis();
+    }
 
-        // external function before scan
-        if (ladder_ctx->on.task_before != NULL)
-            ladder_ctx->on.task_before(ladder_ctx);
+    // external function before scan
+    if (ladder_ctx->on.task_before != NULL)
+        ladder_ctx->on.task_before(ladder_ctx);
 
-        // Pre-loop guard for input array null when qty > 0
-        if (ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->input == NULL) {
-            ladder_ctx->ladder.state = LADDER_ST_ERROR;
-            if (ladder_ctx->on.panic != NULL) {
-                ladder_ctx->on.panic(ladder_ctx);
-            }
-            continue;  // Skip reads to avoid crash
+    // Pre-loop guard for input array null when qty > 0. Sealed contexts had modules and functions checked with the program.
+    if (!ladder_ctx->ladder.sealed && ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->input == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL) {
+            ladder_ctx->on.panic(ladder_ctx);
         }
+        return false;  // Skip reads to avoid crash
+    }
 
-        // Input history copy moved BEFORE read loop to capture previous hardware values in Ih/IWh for edge detection.
-        // This ensures Ih = last cycle's I (previous), then read updates I to current.
-        // Copy for analog IW to IWh for consistency (though no edges on analogs).
-        if (ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->input != NULL) {
-            for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
-                // Per-module null/zero-qty checks before memcpy to skip invalid
-                if (ladder_ctx->input[n].i_qty == 0 || ladder_ctx->input[n].I == NULL || ladder_ctx->input[n].Ih == NULL) {
-                    continue;
-                }
-                // Discrete inputs: Ih = previous I
-                memcpy(ladder_ctx->input[n].Ih, ladder_ctx->input[n].I, ladder_ctx->input[n].i_qty * sizeof(uint8_t));
-                // Similar check for analog
-                if (ladder_ctx->input[n].iw_qty == 0 || ladder_ctx->input[n].IW == NULL || ladder_ctx->input[n].IWh == NULL) {
-                    continue;
-                }
-                // Analog inputs: IWh = previous IW (new addition for full snapshot symmetry)
-                memcpy(ladder_ctx->input[n].IWh, ladder_ctx->input[n].IW, ladder_ctx->input[n].iw_qty * sizeof(int32_t));
+    // Input history copy moved BEFORE read loop to capture previous hardware values in Ih/IWh for edge detection.
+    // This ensures Ih = last cycle's I (previous), then read updates I to current.
+    // Copy for analog IW to IWh for consistency (though no edges on analogs).
+    if (ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->input != NULL) {
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
+            // Per-module null/zero-qty checks before memcpy to skip invalid
+            if (ladder_ctx->input[n].i_qty == 0 || ladder_ctx->input[n].I == NULL || ladder_ctx->input[n].Ih == NULL) {
+                continue;
+            }
+            // Discrete inputs: Ih = previous I
+            memcpy(ladder_ctx->input[n].Ih, ladder_ctx->input[n].I, ladder_ctx->input[n].i_qty * sizeof(uint8_t));
+            // Similar check for analog
+            if (ladder_ctx->input[n].iw_qty == 0 || ladder_ctx->input[n].IW == NULL || ladder_ctx->input[n].IWh == NULL) {
+                continue;
             }
+            // Analog inputs: IWh = previous IW (new addition for full snapshot symmetry)
+            memcpy(ladder_ctx->input[n].IWh, ladder_ctx->input[n].IW, ladder_ctx->input[n].iw_qty * sizeof(int32_t));
         }
+    }
 
-        // Per-entry NULL checks before loop.
-        if (ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->hw.io.read != NULL) {
-            for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
-                // Runtime null check to prevent dereference if callback altered state
-                if (ladder_ctx->hw.io.read[n] == NULL) {
-                    ladder_ctx->ladder.state = LADDER_ST_ERROR;
-                    if (ladder_ctx->on.panic != NULL) {
-                        ladder_ctx->on.panic(ladder_ctx);
-                    }
-                    break;  // Skip remaining reads
+    // Per-entry NULL checks before loop.
+    if (ladder_ctx->hw.io.fn_read_qty > 0 && ladder_ctx->hw.io.read != NULL) {
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_read_qty; n++) {
+            // Runtime null check to prevent dereference if callback altered state
+            if (ladder_ctx->hw.io.read[n] == NULL) {
+                ladder_ctx->ladder.state = LADDER_ST_ERROR;
+                if (ladder_ctx->on.panic != NULL) {
+                    ladder_ctx->on.panic(ladder_ctx);
                 }
-                ladder_ctx->hw.io.read[n](ladder_ctx, n);
+                break;  // Skip remaining reads
             }
+            ladder_ctx->hw.io.read[n](ladder_ctx, n);
         }
+    }
 
-        // Pre-loop guard for output array null when qty > 0
-        if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output == NULL) {
-            ladder_ctx->ladder.state = LADDER_ST_ERROR;
-            if (ladder_ctx->on.panic != NULL) {
-                ladder_ctx->on.panic(ladder_ctx);
+    // Pre-loop guard for output array null when qty > 0
+    if (!ladder_ctx->ladder.sealed && ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL) {
+            ladder_ctx->on.panic(ladder_ctx);
+        }
+        return false;  // Skip writes to avoid crash
+    }
+
+    // Output history copy (symmetric to inputs)
+    if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output != NULL) {
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+            // Per-module null/zero-qty checks before memcpy
+            if (ladder_ctx->output[n].q_qty == 0 || ladder_ctx->output[n].Q == NULL || ladder_ctx->output[n].Qh == NULL) {
+                continue;
+            }
+            memcpy(ladder_ctx->output[n].Qh, ladder_ctx->output[n].Q, ladder_ctx->output[n].q_qty * sizeof(uint8_t));
+            // Similar for analog
+            if (ladder_ctx->output[n].qw_qty == 0 || ladder_ctx->output[n].QW == NULL || ladder_ctx->output[n].QWh == NULL) {
+                continue;
             }
-            continue;  // Skip writes to avoid crash
+            memcpy(ladder_ctx->output[n].QWh, ladder_ctx->output[n].QW, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
         }
+    }
 
-        // Output history copy (symmetric to inputs)
+    return true;
+}
+
+// Ladder program scan on the engine of the context
+static void ladder_task_scan(ladder_ctx_t *ladder_ctx) {
+    switch (ladder_ctx->ladder.engine) {
+#ifdef OPTIONAL_COMPILED
+        case LADDER_ENGINE_COMPILED:
+            ladder_scan_compiled(ladder_ctx);
+            break;
+        case LADDER_ENGINE_INCREMENTAL:
+            ladder_scan_incremental(ladder_ctx);
+            break;
+#endif
+#ifdef OPTIONAL_PARALLEL
+        case LADDER_ENGINE_PARALLEL:
+            ladder_scan_parallel(ladder_ctx);
+            break;
+#endif
+#ifdef OPTIONAL_JIT
+        case LADDER_ENGINE_JIT:
+            ladder_scan_jit(ladder_ctx);
+            break;
+#endif
+        case LADDER_ENGINE_GENERATED:
+            ladder_ctx->generated(ladder_ctx);
+            break;
+        default:
+            ladder_scan(ladder_ctx);
+            break;
+    }
+}
+
+bool ladder_task_end(ladder_ctx_t *ladder_ctx, bool pad) {
+    if (ladder_ctx->ladder.state == LADDER_ST_INV) {
+        ladder_ctx->ladder.state = LADDER_ST_EXIT_TSK;
+
+        // Checks before revert loops to skip if invalid
         if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output != NULL) {
             for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
-                // Per-module null/zero-qty checks before memcpy
                 if (ladder_ctx->output[n].q_qty == 0 || ladder_ctx->output[n].Q == NULL || ladder_ctx->output[n].Qh == NULL) {
                     continue;
                 }
-                memcpy(ladder_ctx->output[n].Qh, ladder_ctx->output[n].Q, ladder_ctx->output[n].q_qty * sizeof(uint8_t));
-                // Similar for analog
+                memcpy(ladder_ctx->output[n].Q, ladder_ctx->output[n].Qh, ladder_ctx->output[n].q_qty * sizeof(uint8_t));  // Revert Q to last good
+                // Added: Revert QW to QWh for consistency (new)
                 if (ladder_ctx->output[n].qw_qty == 0 || ladder_ctx->output[n].QW == NULL || ladder_ctx->output[n].QWh == NULL) {
                     continue;
                 }
-                memcpy(ladder_ctx->output[n].QWh, ladder_ctx->output[n].QW, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
+                memcpy(ladder_ctx->output[n].QW, ladder_ctx->output[n].QWh, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
             }
         }
 
-        // ladder program scan
-        ladder_scan(ladder_ctx);
-        if (ladder_ctx->ladder.state == LADDER_ST_INV) {
-            ladder_ctx->ladder.state = LADDER_ST_EXIT_TSK;
+        ladder_history_restore(ladder_ctx->memory.M, LADDER_HISTORY(ladder_ctx, M), ladder_ctx->ladder.quantity.m);  // Revert M to last good
+        ladder_history_restore(ladder_ctx->memory.Cd, LADDER_HISTORY(ladder_ctx, Cd), ladder_ctx->ladder.quantity.c);  // Revert Cd
+        ladder_history_restore(ladder_ctx->memory.Cr, LADDER_HISTORY(ladder_ctx, Cr), ladder_ctx->ladder.quantity.c);  // Revert Cr
+        ladder_history_restore(ladder_ctx->memory.Td, LADDER_HISTORY(ladder_ctx, Td), ladder_ctx->ladder.quantity.t);  // Revert Td
+        ladder_history_restore(ladder_ctx->memory.Tr, LADDER_HISTORY(ladder_ctx, Tr), ladder_ctx->ladder.quantity.t);  // Revert Tr
+
+        if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->registers.C != NULL) {
+            memset(ladder_ctx->registers.C, 0, ladder_ctx->ladder.quantity.c * sizeof(uint32_t));  // Reset counters to 0 on fault
+        }
+        if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->timers != NULL) {
+            for (uint32_t i = 0; i < ladder_ctx->ladder.quantity.t; ++i) {
+                ladder_ctx->timers[i].acc = 0;  // Reset timer accumulators
+            }
+        }
+        if (ladder_ctx->ladder.quantity.d > 0 && ladder_ctx->registers.D != NULL) {
+            memset(ladder_ctx->registers.D, 0, ladder_ctx->ladder.quantity.d * sizeof(int32_t));  // Reset D to 0
+        }
+        if (ladder_ctx->ladder.quantity.r > 0 && ladder_ctx->registers.R != NULL) {
+            memset(ladder_ctx->registers.R, 0, ladder_ctx->ladder.quantity.r * sizeof(float));  // Reset R to 0
+        }
+
+        ladder_save_previous_values(ladder_ctx);  // Save the reverted state to history for consistency
 
-            // Checks before revert loops to skip if invalid
+        // If !write_on_fault, clear outputs to safe state (0)
+        if (!ladder_ctx->ladder.write_on_fault) {
             if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output != NULL) {
                 for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
-                    if (ladder_ctx->output[n].q_qty == 0 || ladder_ctx->output[n].Q == NULL || ladder_ctx->output[n].Qh == NULL) {
+                    // Per-module checks before memset/memcpy
+                    if (ladder_ctx->output[n].q_qty == 0 || ladder_ctx->output[n].Q == NULL) {
                         continue;
                     }
-                    memcpy(ladder_ctx->output[n].Q, ladder_ctx->output[n].Qh, ladder_ctx->output[n].q_qty * sizeof(uint8_t));  // Revert Q to last good
-                    // Added: Revert QW to QWh for consistency (new)
-                    if (ladder_ctx->output[n].qw_qty == 0 || ladder_ctx->output[n].QW == NULL || ladder_ctx->output[n].QWh == NULL) {
+                    memset(ladder_ctx->output[n].Q, 0, ladder_ctx->output[n].q_qty * sizeof(uint8_t));
+                    if (ladder_ctx->output[n].qw_qty == 0 || ladder_ctx->output[n].QW == NULL) {
                         continue;
                     }
-                    memcpy(ladder_ctx->output[n].QW, ladder_ctx->output[n].QWh, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
-                }
-            }
-
-            memcpy(ladder_ctx->memory.M, ladder_ctx->prev_scan_vals.Mh, ladder_ctx->ladder.quantity.m * sizeof(uint8_t));  // Revert M to last good
-            memcpy(ladder_ctx->memory.Cd, ladder_ctx->prev_scan_vals.Cdh, ladder_ctx->ladder.quantity.c * sizeof(bool));  // Revert Cd
-            memcpy(ladder_ctx->memory.Cr, ladder_ctx->prev_scan_vals.Crh, ladder_ctx->ladder.quantity.c * sizeof(bool));  // Revert Cr
-            memcpy(ladder_ctx->memory.Td, ladder_ctx->prev_scan_vals.Tdh, ladder_ctx->ladder.quantity.t * sizeof(bool));  // Revert Td
-            memcpy(ladder_ctx->memory.Tr, ladder_ctx->prev_scan_vals.Trh, ladder_ctx->ladder.quantity.t * sizeof(bool));  // Revert Tr
-
-            if (ladder_ctx->ladder.quantity.c > 0 && ladder_ctx->registers.C != NULL) {
-                memset(ladder_ctx->registers.C, 0, ladder_ctx->ladder.quantity.c * sizeof(uint32_t));  // Reset counters to 0 on fault
-            }
-            if (ladder_ctx->ladder.quantity.t > 0 && ladder_ctx->timers != NULL) {
-                for (uint32_t i = 0; i < ladder_ctx->ladder.quantity.t; ++i) {
-                    ladder_ctx->timers[i].acc = 0;  // Reset timer accumulators
-                }
-            }
-            if (ladder_ctx->ladder.quantity.d > 0 && ladder_ctx->registers.D != NULL) {
-                memset(ladder_ctx->registers.D, 0, ladder_ctx->ladder.quantity.d * sizeof(int32_t));  // Reset D to 0
-            }
-            if (ladder_ctx->ladder.quantity.r > 0 && ladder_ctx->registers.R != NULL) {
-                memset(ladder_ctx->registers.R, 0, ladder_ctx->ladder.quantity.r * sizeof(float));  // Reset R to 0
-            }
-
-            ladder_save_previous_values(ladder_ctx);  // Save the reverted state to history for consistency
-
-            // If !write_on_fault, clear outputs to safe state (0)
-            if (!ladder_ctx->ladder.write_on_fault) {
-                if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->output != NULL) {
-                    for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
-                        // Per-module checks before memset/memcpy
-                        if (ladder_ctx->output[n].q_qty == 0 || ladder_ctx->output[n].Q == NULL) {
-                            continue;
-                        }
-                        memset(ladder_ctx->output[n].Q, 0, ladder_ctx->output[n].q_qty * sizeof(uint8_t));
-                        if (ladder_ctx->output[n].qw_qty == 0 || ladder_ctx->output[n].QW == NULL) {
-                            continue;
-                        }
-                        memset(ladder_ctx->output[n].QW, 0, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
-                        if (ladder_ctx->output[n].Qh != NULL && ladder_ctx->output[n].Q != NULL) {
-                            memcpy(ladder_ctx->output[n].Qh, ladder_ctx->output[n].Q, ladder_ctx->output[n].q_qty * sizeof(uint8_t)); // Update history to cleared state
-                        }
-                        if (ladder_ctx->output[n].QWh != NULL && ladder_ctx->output[n].QW != NULL) {
-                            memcpy(ladder_ctx->output[n].QWh, ladder_ctx->output[n].QW, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
-                        }
+                    memset(ladder_ctx->output[n].QW, 0, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
+                    if (ladder_ctx->output[n].Qh != NULL && ladder_ctx->output[n].Q != NULL) {
+                        memcpy(ladder_ctx->output[n].Qh, ladder_ctx->output[n].Q, ladder_ctx->output[n].q_qty * sizeof(uint8_t)); // Update history to cleared state
                     }
-                }
-            }
-            // Always perform writes on fault to enforce hold last good (if write_on_fault) or cleared state
-            // Per-entry NULL checks before loop.
-            if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->hw.io.write != NULL) {
-                for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
-                    // Runtime null check to prevent dereference if callback altered state
-                    if (ladder_ctx->hw.io.write[n] == NULL) {
-                        ladder_ctx->ladder.state = LADDER_ST_ERROR;
-                        if (ladder_ctx->on.panic != NULL) {
-                            ladder_ctx->on.panic(ladder_ctx);
-                        }
-                        break;  // Skip remaining writes
+                    if (ladder_ctx->output[n].QWh != NULL && ladder_ctx->output[n].QW != NULL) {
+                        memcpy(ladder_ctx->output[n].QWh, ladder_ctx->output[n].QW, ladder_ctx->output[n].qw_qty * sizeof(int32_t));
                     }
-                    ladder_ctx->hw.io.write[n](ladder_ctx, n);
                 }
             }
-
-            ladder_scan_time(ladder_ctx);
-
-            // external function after scan
-            if (ladder_ctx->on.task_after != NULL)
-                ladder_ctx->on.task_after(ladder_ctx);
-
-            goto exit;
         }
-
-        ladder_save_previous_values(ladder_ctx);
-
+        // Always perform writes on fault to enforce hold last good (if write_on_fault) or cleared state
         // Per-entry NULL checks before loop.
         if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->hw.io.write != NULL) {
             for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+                // Runtime null check to prevent dereference if callback altered state
                 if (ladder_ctx->hw.io.write[n] == NULL) {
                     ladder_ctx->ladder.state = LADDER_ST_ERROR;
                     if (ladder_ctx->on.panic != NULL) {
@@ -289,19 +299,113 @@ void ladder_task(void *ladderctx) {
 
         ladder_scan_time(ladder_ctx);
 
-        // Pad to target scan cycle if enabled and actual < target
-        if (ladder_ctx->scan_internals.target_scan_ms
-                > 0&& ladder_ctx->scan_internals.actual_scan_time < ladder_ctx->scan_internals.target_scan_ms && ladder_ctx->hw.time.delay != NULL) {
-            uint64_t pad_ms = ladder_ctx->scan_internals.target_scan_ms - ladder_ctx->scan_internals.actual_scan_time;
-            ladder_ctx->hw.time.delay(pad_ms);
-        }
-
         // external function after scan
         if (ladder_ctx->on.task_after != NULL)
             ladder_ctx->on.task_after(ladder_ctx);
+
+        return false;
+    }
+
+    ladder_save_previous_values(ladder_ctx);
+
+    // Per-entry NULL checks before loop.
+    if (ladder_ctx->hw.io.fn_write_qty > 0 && ladder_ctx->hw.io.write != NULL) {
+        for (uint32_t n = 0; n < ladder_ctx->hw.io.fn_write_qty; n++) {
+            if (ladder_ctx->hw.io.write[n] == NULL) {
+                ladder_ctx->ladder.state = LADDER_ST_ERROR;
+                if (ladder_ctx->on.panic != NULL) {
+                    ladder_ctx->on.panic(ladder_ctx);
+                }
+                break;  // Skip remaining writes
+            }
+            ladder_ctx->hw.io.write[n](ladder_ctx, n);
+        }
+    }
+
+    ladder_scan_time(ladder_ctx);
+
+    // Pad to target scan cycle if enabled and actual < target
+    if (pad && ladder_ctx->scan_internals.target_scan_ms > 0
+            && ladder_ctx->scan_internals.actual_scan_time < ladder_ctx->scan_internals.target_scan_ms && ladder_ctx->hw.time.delay != NULL) {
+        uint64_t pad_ms = ladder_ctx->scan_internals.target_scan_ms - ladder_ctx->scan_internals.actual_scan_time;
+        ladder_ctx->hw.time.delay(pad_ms);
+    }
+
+    // external function after scan
+    if (ladder_ctx->on.task_after != NULL)
+        ladder_ctx->on.task_after(ladder_ctx);
+
+    return true;
+}
+
+// One task cycle: inputs, scan, outputs and hooks. Returns false when the task must end.
+static bool ladder_task_cycle(ladder_ctx_t *ladder_ctx, bool pad) {
+    if (!ladder_task_begin(ladder_ctx))
+        return true;
+
+    ladder_task_scan(ladder_ctx);
+
+    return ladder_task_end(ladder_ctx, pad);
+}
+
+void ladder_task(void *ladderctx) {
+    if (ladderctx == NULL)
+        return;
+
+    ladder_ctx_t *ladder_ctx = (ladder_ctx_t*) ladderctx;
+
+    if (!ladder_task_ready(ladder_ctx))
+        return;
+
+    // task main loop
+    while (ladder_ctx->ladder.state != LADDER_ST_EXIT_TSK) {
+        // Inner while with bounded loop using wait_count to prevent infinite wait.
+        // Initializes counter, adds timeout condition, retains EXIT_TSK check, and sets ERROR on timeout.
+        uint32_t wait_count = 0;
+        while (ladder_ctx->ladder.state != LADDER_ST_RUNNING && wait_count < MAX_WAIT_CYCLES) {
+            if (ladder_ctx->ladder.state == LADDER_ST_EXIT_TSK)
+                return;
+            // Check delay before call.
+            if (ladder_ctx->hw.time.delay == NULL) {
+                ladder_ctx->ladder.state = LADDER_ST_ERROR;
+                if (ladder_ctx->on.panic != NULL) {
+                    ladder_ctx->on.panic(ladder_ctx);
+                }
+                // No-op fallback: no delay.
+            } else {
+                ladder_ctx->hw.time.delay(ladder_ctx->ladder.quantity.delay_not_run);
+            }
+            wait_count++;
+        }
+
+        if (wait_count >= MAX_WAIT_CYCLES) {
+            ladder_ctx->ladder.state = LADDER_ST_ERROR;
+            // Invoke panic here after timeout, integrating it into the error path for consistency.
+            if (ladder_ctx->on.panic != NULL)
+                ladder_ctx->on.panic(ladder_ctx);
+            // Unconditionally set to EXIT_TSK after panic to prevent potential infinite loop if panic doesn't recover state.
+            ladder_ctx->ladder.state = LADDER_ST_EXIT_TSK;
+        }
+
+        // Proceed only if now RUNNING (after wait or direct)
+        if (ladder_ctx->ladder.state != LADDER_ST_RUNNING) {
+            continue;  // Skip to next iteration if still not running after wait/timeout.
+        }
+
+        if (!ladder_task_cycle(ladder_ctx, true))
+            goto exit;
     }
 
     exit:
     if (ladder_ctx != NULL && ladder_ctx->on.end_task != NULL)
         ladder_ctx->on.end_task(ladder_ctx);
 }
+
+bool ladder_task_step(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || !ladder_task_ready(ladder_ctx) || ladder_ctx->ladder.state == LADDER_ST_EXIT_TSK)
+        return false;
+    if (ladder_ctx->ladder.state != LADDER_ST_RUNNING)
+        return true;
+
+    return ladder_task_cycle(ladder_ctx, false);
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_topology.h"
+
+static void ladder_topology_free_network(ladder_topology_network_t *tnet) {
+    if (tnet->rung != NULL) {
+        for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+            free(tnet->rung[r].column);
+            free(tnet->rung[r].live);
+        }
+        free(tnet->rung);
+    }
+    tnet->rung = NULL;
+    tnet->rungs_qty = 0;
+    free(tnet->clear);
+    tnet->clear = NULL;
+    free(tnet->sparse);
+    tnet->sparse = NULL;
+}
+
+// Networks are laid out wide and mostly filled with NOP cells: the non empty ones are listed once so walks only visit those.
+static bool ladder_topology_build_sparse(ladder_network_t *net, ladder_topology_network_t *tnet) {
+    uint32_t qty = 0;
+    for (uint32_t row = 0; row < net->rows; row++)
+        for (uint32_t column = 0; column < net->cols; column++)
+            if (!ladder_topology_empty(&net->cells[row][column]))
+                qty++;
+
+    tnet->sparse = malloc((qty > 0 ? qty : 1) * sizeof(uint16_t));
+    if (tnet->sparse == NULL)
+        return false;
+
+    qty = 0;
+    for (uint32_t row = 0; row < net->rows; row++) {
+        tnet->sparse_start[row] = qty;
+        for (uint32_t column = 0; column < net->cols; column++)
+            if (!ladder_topology_empty(&net->cells[row][column]))
+                tnet->sparse[qty++] = (uint16_t) (row << 8 | column);
+    }
+    tnet->sparse_start[net->rows] = qty;
+
+    return true;
+}
+
+// Columns of a rung where the full walk executes something other than NOP cells. The sparse walk visits only these and restores the last
+// cell of the full walk at the rung end.
+static bool ladder_topology_build_live(ladder_network_t *net, ladder_topology_network_t *tnet) {
+    // instruction rows of each column (rows fit in 32 bits)
+    uint32_t *used = calloc(net->cols, sizeof(uint32_t));
+    if (used == NULL)
+        return false;
+
+    for (uint32_t n = 0; n < tnet->sparse_start[net->rows]; n++) {
+        uint32_t row = tnet->sparse[n] >> 8, column = tnet->sparse[n] & 0xff;
+        if (net->cells[row][column].code != LADDER_INS_NOP)
+            used[column] |= (uint32_t) 1 << row;
+    }
+
+    for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+        ladder_topology_rung_t *rung = &tnet->rung[r];
+        rung->live = malloc((rung->live_end > 0 ? rung->live_end : 1) * sizeof(uint8_t));
+        if (rung->live == NULL) {
+            free(used);
+            return false;
+        }
+
+        rung->live_qty = 0;
+        for (uint32_t column = 0; column < rung->live_end; column++) {
+            const ladder_topology_column_t *tc = &rung->column[column];
+            uint32_t rows = (uint32_t) (((uint64_t) 1 << (tc->group_end + 1)) - ((uint64_t) 1 << rung->row_start));
+            if (!tc->skip && (used[column] & rows) != 0)
+                rung->live[rung->live_qty++] = (uint8_t) column;
+        }
+
+        if (rung->live_end > 0) {
+            rung->last_column = rung->live_end - 1;
+            rung->last_row = rung->column[rung->last_column].group_end;
+        }
+    }
+
+    free(used);
+    return true;
+}
+
+// Only instructions and group merges power cells: scans clear the listed cells instead of the whole matrix. The others are cleared here
+// once, a wide network with sparse instructions leaves most of them out.
+static bool ladder_topology_build_clear(ladder_network_t *net, ladder_topology_network_t *tnet) {
+    // merged rows of each column (rows fit in 32 bits)
+    uint32_t *merged = calloc(net->cols, sizeof(uint32_t));
+    if (merged == NULL)
+        return false;
+
+    for (uint32_t r = 0; r < tnet->rungs_qty; r++) {
+        const ladder_topology_rung_t *rung = &tnet->rung[r];
+        for (uint32_t column = 0; column < net->cols; column++) {
+            if (rung->column[column].group_end == rung->row_start)
+                continue;
+            for (uint32_t gr = rung->row_start; gr <= rung->column[column].group_end; gr++)
+                merged[column] |= (uint32_t) 1 << gr;
+        }
+    }
+
+    uint32_t qty = 0;
+    for (uint32_t row = 0; row < net->rows; row++)
+        for (uint32_t column = 0; column < net->cols; column++)
+            if (net->cells[row][column].code != LADDER_INS_NOP || (merged[column] >> row & 1))
+                qty++;
+
+    tnet->clear = malloc((qty > 0 ? qty : 1) * sizeof(uint16_t));
+    if (tnet->clear == NULL) {
+        free(merged);
+        return false;
+    }
+
+    qty = 0;
+    for (uint32_t row = 0; row < net->rows; row++) {
+        tnet->clear_start[row] = qty;
+        for (uint32_t column = 0; column < net->cols; column++) {
+            net->cells[row][column].state = false;
+            if (net->cells[row][column].code != LADDER_INS_NOP || (merged[column] >> row & 1))
+                tnet->clear[qty++] = (uint16_t) (row << 8 | column);
+        }
+    }
+    tnet->clear_start[net->rows] = qty;
+
+    free(merged);
+    return true;
+}
+
+// Every decision ladder_scan_network() takes to walk a network depends only on cell codes and vertical bars, so it is taken here once per
+// program edit instead of once per scan.
+static bool ladder_topology_build_network(const ladder_ctx_t *ladder_ctx, ladder_network_t *net, ladder_topology_network_t *tnet) {
+    tnet->rows = net->rows;
+    tnet->cols = net->cols;
+    tnet->cycles = 0;
+
+    if (!ladder_topology_build_sparse(net, tnet))
+        return false;
+
+    // at most one rung per row
+    tnet->rung = calloc(net->rows, sizeof(ladder_topology_rung_t));
+    if (tnet->rung == NULL)
+        return false;
+
+    uint32_t lead = 0;
+    uint32_t row = 0;
+    while (row < net->rows) {
+        ++lead;
+        // rows below a multi-cell instruction are not rungs
+        if (net->cells[row][0].code == LADDER_INS_MULTI) {
+            row++;
+            continue;
+        }
+
+        ladder_topology_rung_t *rung = &tnet->rung[tnet->rungs_qty++];
+        rung->column = calloc(net->cols, sizeof(ladder_topology_column_t));
+        if (rung->column == NULL)
+            return false;
+
+        rung->row_start = row;
+        rung->row_end = row;
+        while (rung->row_end + 1 < net->rows && net->cells[rung->row_end + 1][0].vertical_bar)
+            rung->row_end++;
+
+        // lower branch: vertical bar on any column, except the ones joining rows of a multi-cell instruction
+        rung->is_lower = false;
+        for (uint32_t n = tnet->sparse_start[row]; n < tnet->sparse_start[row + 1]; n++) {
+            uint32_t c = tnet->sparse[n] & 0xff;
+            if (net->cells[row][c].vertical_bar && !(row + 1 < net->rows && net->cells[row + 1][c].code == LADDER_INS_MULTI)) {
+                rung->is_lower = true;
+                break;
+            }
+        }
+
+        rung->lead_cycles = lead;
+        rung->cycles = lead;
+        rung->live_end = 0;
+        lead = 0;
+
+        for (uint32_t column = 0; column < net->cols; column++) {
+            ladder_topology_column_t *tc = &rung->column[column];
+
+            tc->group_end = rung->row_start;
+            while (tc->group_end + 1 < net->rows && net->cells[tc->group_end + 1][column].vertical_bar)
+                tc->group_end++;
+
+            // the skip check stops on the first cell that must execute (side effects on false, multi-cell or invalid code)
+            bool skip_safe = true;
+            tc->cycles = 0;
+            for (uint32_t gr = rung->row_start; gr <= tc->group_end; gr++) {
+                ++tc->cycles;
+                if (ladder_side_effects(ladder_ctx, net->cells[gr][column].code)) {
+                    skip_safe = false;
+                    break;
+                }
+            }
+
+            tc->skip = rung->is_lower && skip_safe;
+            if (!tc->skip)
+                rung->live_end = column + 1;
+            rung->cycles += tc->cycles;
+        }
+
+        tnet->cycles += rung->cycles;
+        row = rung->row_end + 1;
+    }
+
+    tnet->tail_cycles = lead;
+    tnet->cycles += lead;
+
+    return ladder_topology_build_live(net, tnet) && ladder_topology_build_clear(net, tnet);
+}
+
+static bool ladder_topology_build(ladder_ctx_t *ladder_ctx) {
+    ladder_topology_t *topology = calloc(1, sizeof(ladder_topology_t));
+    if (topology == NULL)
+        return false;
+
+    topology->network = calloc(ladder_ctx->ladder.quantity.networks, sizeof(ladder_topology_network_t));
+    if (topology->network == NULL) {
+        free(topology);
+        return false;
+    }
+    topology->networks_qty = ladder_ctx->ladder.quantity.networks;
+    ladder_ctx->topology = topology;
+
+    for (uint32_t n = 0; n < topology->networks_qty; n++) {
+        if (ladder_ctx->network[n].cells == NULL)
+            continue;
+        if (!ladder_topology_build_network(ladder_ctx, &ladder_ctx->network[n], &topology->network[n])) {
+            ladder_topology_free(ladder_ctx);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+ladder_topology_network_t* ladder_topology_get(ladder_ctx_t *ladder_ctx, uint32_t network) {
+    ladder_topology_t *topology = (ladder_topology_t*) ladder_ctx->topology;
+
+    // networks resized or reallocated without ladder_program_changed()
+    if (topology != NULL
+            && (topology->networks_qty != ladder_ctx->ladder.quantity.networks || topology->network[network].rows != ladder_ctx->network[network].rows
+                    || topology->network[network].cols != ladder_ctx->network[network].cols)) {
+        ladder_topology_free(ladder_ctx);
+        topology = NULL;
+    }
+
+    if (topology == NULL) {
+        if (!ladder_topology_build(ladder_ctx))
+            return NULL;
+        topology = (ladder_topology_t*) ladder_ctx->topology;
+    }
+
+    return &topology->network[network];
+}
+
+void ladder_topology_free(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->topology == NULL)
+        return;
+
+    ladder_topology_t *topology = (ladder_topology_t*) ladder_ctx->topology;
+    if (topology->network != NULL) {
+        for (uint32_t n = 0; n < topology->networks_qty; n++)
+            ladder_topology_free_network(&topology->network[n]);
+        free(topology->network);
+    }
+    free(topology);
+    ladder_ctx->topology = NULL;
+}
@@ -0,0 +1,310 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+// Scan engines benchmark: interpreter (function pointer table) against compiled rungs (inlined instruction bodies, computed goto dispatch),
+// incremental scan (compiled rungs affected by changed registers) and parallel scan with 1 to 8 threads. BENCH_CHURN flags are toggled before each scan.
+// Sectioned programs split registers in BENCH_SECTIONS groups of networks that don't share any register (independent machine sections).
+// Context layout: BENCH_CTXS contexts running a three cell program are stepped round robin through the whole task cycle (inputs, scan, outputs),
+// the case where the cache lines of ladder_ctx_t touched by each cycle dominate.
+// Build as the test program replacing ladderlib_test.c; add -DLADDER_DISPATCH_SWITCH to measure the portable switch dispatch.
+// Usage: ladderlib_bench [demo program (default ladder_networks.json)]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "port_dummy.h"
+#include "ladder_program_json.h"
+
+// registers quantity
+#define QTY_M  256
+#define QTY_C  16
+#define QTY_T  16
+#define QTY_D  64
+#define QTY_R  8
+
+#define BENCH_SCANS_DEMO 200000
+#define BENCH_SCANS_GEN  2000
+#ifndef BENCH_CHURN
+#define BENCH_CHURN      (QTY_M / 20) // flags changed before each scan (5%)
+#endif
+#define BENCH_SECTIONS   8
+#ifndef BENCH_CTXS
+#define BENCH_CTXS       256
+#endif
+#define BENCH_STEPS      4000000
+
+typedef struct bench_engine_s {
+    ladder_scan_engine_t engine;
+              const char *name;
+                    void (*scan)(ladder_ctx_t*);
+                uint32_t workers;
+} bench_engine_t;
+
+static const bench_engine_t bench_engines[] = { //
+        { LADDER_ENGINE_INTERPRETER, "interpreter", ladder_scan,             0 }, //
+        { LADDER_ENGINE_COMPILED,    "compiled",    ladder_scan_compiled,    0 }, //
+        { LADDER_ENGINE_INCREMENTAL, "incremental", ladder_scan_incremental, 0 }, //
+#ifdef OPTIONAL_PARALLEL
+        { LADDER_ENGINE_PARALLEL,    "parallel x1", ladder_scan_parallel,    1 }, //
+        { LADDER_ENGINE_PARALLEL,    "parallel x2", ladder_scan_parallel,    2 }, //
+        { LADDER_ENGINE_PARALLEL,    "parallel x4", ladder_scan_parallel,    4 }, //
+        { LADDER_ENGINE_PARALLEL,    "parallel x8", ladder_scan_parallel,    8 }, //
+#endif
+        };
+
+static uint32_t bench_seed = 1;
+
+static uint32_t bench_rand(uint32_t max) {
+    bench_seed = bench_seed * 1103515245u + 12345u;
+    return ((bench_seed >> 8) & 0xffffff) % max;
+}
+
+static uint64_t bench_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench_read(ladder_ctx_t *ladder_ctx, uint32_t id) {
+    (void) ladder_ctx;
+    (void) id;
+}
+
+static void bench_write(ladder_ctx_t *ladder_ctx, uint32_t id) {
+    (void) ladder_ctx;
+    (void) id;
+}
+
+static bool bench_ctx_init(ladder_ctx_t *ladder_ctx, uint8_t cols, uint8_t rows, uint32_t networks) {
+    if (!ladder_ctx_init(ladder_ctx, cols, rows, networks, QTY_M, QTY_C, QTY_T, QTY_D, QTY_R, 0, 0, true, true, UINT64_MAX, 0))
+        return false;
+
+    if (!ladder_add_read_fn(ladder_ctx, bench_read, dummy_init_read) || !ladder_add_write_fn(ladder_ctx, bench_write, dummy_init_write))
+        return false;
+
+    ladder_ctx->hw.time.millis = dummy_millis;
+    ladder_ctx->hw.time.delay = dummy_delay;
+#ifdef OPTIONAL_CRON
+    ladder_ctx->cron = NULL;
+#endif
+
+    return true;
+}
+
+static void bench_set(ladder_value_t *value, ladder_register_t type, int32_t index) {
+    value->type = type;
+    value->value.i32 = index;
+}
+
+// Register of the network section
+static int32_t bench_register(uint32_t qty, uint32_t section, uint32_t sections) {
+    return (int32_t) (section * (qty / sections) + bench_rand(qty / sections));
+}
+
+// Two row rungs of contacts and comparisons ending on a coil, a move or a timer
+static bool bench_generate(ladder_ctx_t *ladder_ctx, uint32_t sections) {
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        ladder_network_t *net = &ladder_ctx->network[n];
+        uint32_t section = n % sections;
+        net->enable = true;
+
+        for (uint32_t r = 0; r + 1 < net->rows; r += 2) {
+            for (uint32_t c = 0; c + 1 < net->cols; c++) {
+                uint32_t pick = bench_rand(100);
+                ladder_instruction_t code = pick < 40 ? LADDER_INS_NO : pick < 70 ? LADDER_INS_NC : pick < 80 ? LADDER_INS_CONN : LADDER_INS_GT;
+                if (!ladder_fn_cell(ladder_ctx, n, r, c, code, 0))
+                    return false;
+                if (code == LADDER_INS_NO || code == LADDER_INS_NC) {
+                    bench_set(&net->cells[r][c].data[0], LADDER_REGISTER_M, bench_register(QTY_M, section, sections));
+                } else if (code == LADDER_INS_GT) {
+                    bench_set(&net->cells[r][c].data[0], LADDER_REGISTER_D, bench_register(QTY_D, section, sections));
+                    bench_set(&net->cells[r][c].data[1], LADDER_REGISTER_NONE, bench_rand(100));
+                }
+            }
+
+            uint32_t c = net->cols - 1;
+            uint32_t pick = bench_rand(100);
+            if (pick < 70) {
+                if (!ladder_fn_cell(ladder_ctx, n, r, c, LADDER_INS_COIL, 0))
+                    return false;
+                bench_set(&net->cells[r][c].data[0], LADDER_REGISTER_M, bench_register(QTY_M, section, sections));
+            } else if (pick < 90) {
+                if (!ladder_fn_cell(ladder_ctx, n, r, c, LADDER_INS_MOVE, 0))
+                    return false;
+                bench_set(&net->cells[r][c].data[0], LADDER_REGISTER_D, bench_register(QTY_D, section, sections));
+                bench_set(&net->cells[r][c].data[1], LADDER_REGISTER_D, bench_register(QTY_D, section, sections));
+            } else {
+                if (!ladder_fn_cell(ladder_ctx, n, r, c, LADDER_INS_TON, 0))
+                    return false;
+                bench_set(&net->cells[r][c].data[0], LADDER_REGISTER_T, bench_register(QTY_T, section, sections));
+                bench_set(&net->cells[r][c].data[1], (ladder_register_t) LADDER_BASETIME_MS, 100);
+            }
+        }
+    }
+
+    for (uint32_t m = 0; m < QTY_M; m++)
+        ladder_ctx->memory.M[m] = bench_rand(2);
+    for (uint32_t d = 0; d < QTY_D; d++)
+        ladder_ctx->registers.D[d] = bench_rand(100);
+
+    return true;
+}
+
+static void bench_run(ladder_ctx_t *ladder_ctx, const char *name, uint32_t scans) {
+    // hooks force the interpreter on every engine
+    ladder_ctx->on.instruction = NULL;
+    ladder_ctx->on.scan_end = NULL;
+    ladder_ctx->on.panic = NULL;
+
+    for (uint32_t e = 0; e < sizeof(bench_engines) / sizeof(bench_engine_t); e++) {
+        ladder_set_engine(ladder_ctx, bench_engines[e].engine);
+#ifdef OPTIONAL_PARALLEL
+        ladder_set_workers(ladder_ctx, bench_engines[e].workers);
+#endif
+
+        // first scan builds topology and compiled code
+        ladder_ctx->ladder.state = LADDER_ST_RUNNING;
+        bench_engines[e].scan(ladder_ctx);
+
+        bench_seed = 1;
+        uint64_t start = bench_ns();
+        for (uint32_t s = 0; s < scans; s++) {
+            for (uint32_t c = 0; c < BENCH_CHURN; c++)
+                ladder_ctx->memory.M[bench_rand(QTY_M)] ^= 1;
+            ladder_ctx->ladder.state = LADDER_ST_RUNNING;
+            bench_engines[e].scan(ladder_ctx);
+            ladder_save_previous_values(ladder_ctx);
+        }
+        uint64_t elapsed = bench_ns() - start;
+
+        printf("%-28s %-12s %12.1f ns/scan\n", name, bench_engines[e].name, (double) elapsed / scans);
+    }
+}
+
+static uint64_t bench_tick = 0;
+
+// clock without system call so the cycle cost is the library's own
+static uint64_t bench_millis(void) {
+    return ++bench_tick >> 10;
+}
+
+// NO M0, NC M1, COIL M2 on every context, one task cycle per context in turn
+static void bench_layout(ladder_scan_engine_t engine, const char *name) {
+    ladder_ctx_t *ctx = ladder_ctx_array(BENCH_CTXS);
+    if (ctx == NULL) {
+        printf("ERROR Allocating contexts\n");
+        return;
+    }
+
+    for (uint32_t n = 0; n < BENCH_CTXS; n++) {
+        if (!bench_ctx_init(&ctx[n], 3, 1, 1) || !ladder_fn_cell(&ctx[n], 0, 0, 0, LADDER_INS_NO, 0) || !ladder_fn_cell(&ctx[n], 0, 0, 1, LADDER_INS_NC, 0)
+                || !ladder_fn_cell(&ctx[n], 0, 0, 2, LADDER_INS_COIL, 0)) {
+            printf("ERROR Initializing\n");
+            return;
+        }
+        bench_set(&ctx[n].network[0].cells[0][0].data[0], LADDER_REGISTER_M, 0);
+        bench_set(&ctx[n].network[0].cells[0][1].data[0], LADDER_REGISTER_M, 1);
+        bench_set(&ctx[n].network[0].cells[0][2].data[0], LADDER_REGISTER_M, 2);
+        ctx[n].network[0].enable = true;
+        ctx[n].hw.time.millis = bench_millis;
+        ladder_set_engine(&ctx[n], engine);
+        ctx[n].ladder.state = LADDER_ST_RUNNING;
+        ladder_task_step(&ctx[n]);
+    }
+
+    uint64_t start = bench_ns();
+    for (uint32_t s = 0; s < BENCH_STEPS; s++) {
+        ladder_ctx_t *ladder_ctx = &ctx[s % BENCH_CTXS];
+        ladder_ctx->memory.M[0] ^= 1;
+        ladder_task_step(ladder_ctx);
+    }
+    uint64_t elapsed = bench_ns() - start;
+
+    printf("%-28s %-12s %12.1f ns/cycle (%u contexts of %u bytes)\n", "layout", name, (double) elapsed / BENCH_STEPS, (unsigned) BENCH_CTXS,
+            (unsigned) sizeof(ladder_ctx_t));
+
+    for (uint32_t n = 0; n < BENCH_CTXS; n++)
+        ladder_ctx_deinit(&ctx[n]);
+    free(ctx);
+}
+
+int main(int argc, char **argv) {
+    const char *prg_load = argc > 1 ? argv[1] : "ladder_networks.json";
+    ladder_ctx_t ladder_ctx;
+    ladder_json_error_t err;
+
+    // demo program
+    if (!bench_ctx_init(&ladder_ctx, 6, 7, 3)) {
+        printf("ERROR Initializing\n");
+        return 1;
+    }
+    if ((err = ladder_json_to_program(prg_load, &ladder_ctx)) != JSON_ERROR_OK) {
+        printf("ERROR: Load demo program %s (%d)\n", prg_load, err);
+    } else {
+        bench_run(&ladder_ctx, prg_load, BENCH_SCANS_DEMO);
+    }
+    ladder_ctx_deinit(&ladder_ctx);
+
+    // generated programs
+    static const struct {
+         uint8_t cols;
+         uint8_t rows;
+        uint32_t networks;
+        uint32_t sections;
+    } sizes[] = { { 8, 8, 16, 1 }, { 16, 32, 16, 1 }, { 32, 32, 64, 1 }, { 32, 32, 64, BENCH_SECTIONS } };
+
+    for (uint32_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); n++) {
+        char name[64];
+
+        if (!bench_ctx_init(&ladder_ctx, sizes[n].cols, sizes[n].rows, sizes[n].networks) || !bench_generate(&ladder_ctx, sizes[n].sections)) {
+            printf("ERROR Generating program\n");
+            return 1;
+        }
+        snprintf(name, sizeof(name), "%s %ux%ux%u", sizes[n].sections > 1 ? "sectioned" : "generated", (unsigned) sizes[n].networks,
+                (unsigned) sizes[n].rows, (unsigned) sizes[n].cols);
+        bench_run(&ladder_ctx, name, BENCH_SCANS_GEN);
+        ladder_ctx_deinit(&ladder_ctx);
+    }
+
+    // many small contexts
+    bench_layout(LADDER_ENGINE_INTERPRETER, "interpreter");
+    bench_layout(LADDER_ENGINE_COMPILED, "compiled");
+
+    return 0;
+}
@@ -248,7 +248,7 @@ int main(void) {
         goto end;
     }
 
-    ladder_print(ladder_ctx);
+    ladder_print_ctx(&ladder_ctx);
 
     printf("Start Task Ladder\n\n");
     ladder_task((void*) &ladder_ctx);
@@ -39,11 +39,27 @@
 #include <time.h>
 #include <sys/time.h>
 #include <inttypes.h>
+#include <unistd.h>
 
 #include "ladder_instructions.h"
 #include "ladder.h"
 #include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_topology.h"
+#include "ladder_incremental.h"
+#include "ladder_parallel.h"
+#include "ladder_jit.h"
+#include "ladder_host.h"
+#include "ladder_batch.h"
+#include "ladder_farm.h"
+#include "ladder_bits.h"
+#include "ladder_arena.h"
+#include "ladder_optimize.h"
 #include "ladder_print.h"
+#include "ladder_program_c.h"
+#include "ladder_program_check.h"
+#include "ladder_program_json.h"
+#include "ladder_bind.h"
 
 #define TEST_QTY_M  18
 #define TEST_QTY_C  8
@@ -148,6 +164,7 @@ const char *functions_err_str[] = { //
 #define SET_REG_D(idx, value) ladder_ctx.registers.D[idx] = value
 #define SET_REG_R(idx, value) ladder_ctx.registers.R[idx] = value
 #define SET_REG_M(idx, value) ladder_ctx.memory.M[idx] = value
+#define SET_PREV_M(idx, value) ladder_history_set(LADDER_HISTORY(&ladder_ctx, M), idx, value)
 #define CHECK_REG_D(idx, exp, desc) CHECK_EQ(ladder_ctx.registers.D[idx], exp, desc, true)
 #define CHECK_REG_R(idx, exp, tol, desc) CHECK_CLOSE(ladder_ctx.registers.R[idx], exp, tol, desc, true)
 #define CHECK_CELL_STATE(net, row, col, exp, desc) CHECK(ladder_ctx.network[net].cells[row][col].state == exp, desc, true)
@@ -392,13 +409,13 @@ void test_fn_COILL(void) {
     ladder_ctx.network[0].enable = true;
 
     // First scan: power on, should latch to 1
-    ladder_ctx.prev_scan_vals.Mh[0] = 0; // Previous state
+    SET_PREV_M(0, 0); // Previous state
     ladder_ctx.network[0].cells[0][0].state = true;
     ladder_task((void*) &ladder_ctx);
     CHECK(ladder_ctx.memory.M[0] == 1, "COILL should latch to 1 when powered", true);
 
     // Second scan: power off, should remain 1
-    ladder_ctx.prev_scan_vals.Mh[0] = 1; // Previous state
+    SET_PREV_M(0, 1); // Previous state
     ladder_ctx.network[0].cells[0][0].state = false;
     ladder_task((void*) &ladder_ctx);
     CHECK(ladder_ctx.memory.M[0] == 1, "COILL should remain 1 after power off", true);
@@ -427,13 +444,13 @@ void test_fn_COILU(void) {
 
     // First scan: contact open, coil should remain latched
     SET_REG_M(1, 0);
-    ladder_ctx.prev_scan_vals.Mh[0] = 1; // previous state of M[0] (latched)
+    SET_PREV_M(0, 1); // previous state of M[0] (latched)
     ladder_task((void*) &ladder_ctx);
     CHECK(ladder_ctx.memory.M[0] == 1, "COILU should remain 1 when not powered", true);
 
     // Second scan: contact closed, coil should unlatch
     SET_REG_M(1, 1);
-    ladder_ctx.prev_scan_vals.Mh[0] = 1; // previous state still latched
+    SET_PREV_M(0, 1); // previous state still latched
     // Reset state to allow another scan
     ladder_ctx.ladder.state = LADDER_ST_RUNNING;
     ladder_task((void*) &ladder_ctx);
@@ -598,7 +615,7 @@ void test_fn_FE(void) {
     TEST_INIT("FE");
 
     SET_REG_M(0, 0);
-    ladder_ctx.prev_scan_vals.Mh[0] = 1; // Previous was true
+    SET_PREV_M(0, 1); // Previous was true
 
     CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_FE, 0), FE);
     ladder_ctx.network[0].cells[0][0].data[0].type = LADDER_REGISTER_M;
@@ -612,7 +629,7 @@ void test_fn_FE(void) {
     CHECK(ladder_ctx.network[0].cells[0][0].state == true, "FE should detect falling edge", true);
 
     // No edge: previous=0, current=0 -> false
-    ladder_ctx.prev_scan_vals.Mh[0] = 0;
+    SET_PREV_M(0, 0);
     // Reset state for second scan
     ladder_ctx.ladder.state = LADDER_ST_RUNNING;
     ladder_task((void*) &ladder_ctx);
@@ -982,7 +999,7 @@ void test_fn_RE(void) {
     TEST_INIT("RE");
 
     SET_REG_M(0, 1); // Current true
-    ladder_ctx.prev_scan_vals.Mh[0] = 0; // Previous false
+    SET_PREV_M(0, 0); // Previous false
 
     CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_RE, 0), RE);
     ladder_ctx.network[0].cells[0][0].data[0].type = LADDER_REGISTER_M;
@@ -995,7 +1012,7 @@ void test_fn_RE(void) {
     CHECK(ladder_ctx.network[0].cells[0][0].state == true, "RE should detect rising edge", true);
 
     // No edge: previous=1, current=1 -> false
-    ladder_ctx.prev_scan_vals.Mh[0] = 1;
+    SET_PREV_M(0, 1);
     // Reset state for second scan
     ladder_ctx.ladder.state = LADDER_ST_RUNNING;
     ladder_task((void*) &ladder_ctx);
@@ -1287,6 +1304,1523 @@ void test_fn_XOR(void) {
 
 /////////////////////////////////////////////////////////////////
 
+// Program used to compare scan engines against the interpreter:
+//   row 0: NO M[0] -- NC M[1] -- COIL M[2]
+//   row 1: NO M[3] -- CONN    -- COIL M[4]   (M[3] branch ORed with row 0 on column 1)
+//   row 2: NO M[5] -- ADD D[0] + D[1] -> D[2] -- CTU C[0], preset 2
+static bool test_engine_program(void) {
+    if (!ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) || !ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_NC, 0)
+            || !ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_COIL, 0) || !ladder_fn_cell(&ladder_ctx, 0, 1, 0, LADDER_INS_NO, 0)
+            || !ladder_fn_cell(&ladder_ctx, 0, 1, 1, LADDER_INS_CONN, 0) || !ladder_fn_cell(&ladder_ctx, 0, 1, 2, LADDER_INS_COIL, 0)
+            || !ladder_fn_cell(&ladder_ctx, 0, 2, 0, LADDER_INS_NO, 0) || !ladder_fn_cell(&ladder_ctx, 0, 2, 1, LADDER_INS_ADD, 0)
+            || !ladder_fn_cell(&ladder_ctx, 0, 2, 2, LADDER_INS_CTU, 0))
+        return false;
+
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    cells[0][0].data[0].type = LADDER_REGISTER_M;
+    cells[0][0].data[0].value.i32 = 0;
+    cells[0][1].data[0].type = LADDER_REGISTER_M;
+    cells[0][1].data[0].value.i32 = 1;
+    cells[0][2].data[0].type = LADDER_REGISTER_M;
+    cells[0][2].data[0].value.i32 = 2;
+    cells[1][0].data[0].type = LADDER_REGISTER_M;
+    cells[1][0].data[0].value.i32 = 3;
+    cells[1][2].data[0].type = LADDER_REGISTER_M;
+    cells[1][2].data[0].value.i32 = 4;
+    cells[2][0].data[0].type = LADDER_REGISTER_M;
+    cells[2][0].data[0].value.i32 = 5;
+    for (uint32_t d = 0; d < 3; d++) {
+        cells[2][1].data[d].type = LADDER_REGISTER_D;
+        cells[2][1].data[d].value.i32 = d;
+    }
+    cells[2][2].data[0].type = LADDER_REGISTER_C;
+    cells[2][2].data[0].value.i32 = 0;
+    cells[2][2].data[1].type = LADDER_REGISTER_NONE;
+    cells[2][2].data[1].value.i32 = 2;
+    cells[1][1].vertical_bar = true;
+    ladder_program_changed(&ladder_ctx);
+
+    ladder_ctx.network[0].enable = true;
+
+    return true;
+}
+
+void test_scan_topology(void) {
+    TEST_INIT("SCAN TOPOLOGY");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.topology != NULL, "Topology should be built on first scan", true);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "COIL should follow NO/NC rung", true);
+
+    // 9 instructions and the rows below ADD and CTU: NOP cells are never powered
+    ladder_topology_network_t *tnet = ladder_topology_get(&ladder_ctx, 0);
+    CHECK_EQ(tnet->clear_start[tnet->rows], 12, "Only instruction cells should be cleared on each scan", true);
+    CHECK(!ladder_ctx.network[0].cells[4][4].state, "NOP cell should stay without power", true);
+
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 4, LADDER_INS_NOP, 0), NOP);
+    CHECK(ladder_ctx.topology == NULL, "Editing the program should discard topology", true);
+
+    // watchdog is still enforced from the cached cycle counts
+    ladder_ctx.scan_internals.max_scan_cycles = 3;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.err == LADDER_INS_ERR_OVERFLOW, "Scan cycles limit should fault", true);
+
+    test_deinit();
+}
+
+void test_scan_sparse(void) {
+    TEST_INIT("SCAN SPARSE");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(0, 1);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Sparse walk should power COIL", true);
+    CHECK_REG_D(2, 30, "Sparse walk should execute ADD");
+
+    // 9 instructions and the rows below ADD and CTU, the CONN cell also holds the vertical bar
+    ladder_topology_network_t *tnet = ladder_topology_get(&ladder_ctx, 0);
+    CHECK_EQ(tnet->sparse_start[tnet->rows], 12, "Sparse index should list only non empty cells", true);
+    CHECK_EQ(tnet->rung[0].live_qty, 3, "Columns of NOP cells should not be walked", true);
+    uint32_t row = ladder_ctx.ladder.last.cell_row, column = ladder_ctx.ladder.last.cell_column;
+
+    // per instruction hook walks every cell
+    ladder_ctx.on.instruction = test_on_instruction;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.cell_row == row && ladder_ctx.ladder.last.cell_column == column, "Sparse walk should end on the last cell of the full walk",
+            true);
+
+    CHECK_EQ(ladder_program_check(&ladder_ctx).error, LADDER_ERR_PRG_CHECK_OK, "Program check should pass", true);
+    ladder_ctx.network[0].cells[3][2].code = LADDER_INS_NOP;
+    ladder_program_changed(&ladder_ctx);
+    ladder_prg_check_t status = ladder_program_check(&ladder_ctx);
+    CHECK(status.error == LADDER_ERR_PRG_CHECK_MISSING_MULTI && status.row == 3 && status.column == 2, "Program check should find the missing MULTI cell",
+            true);
+
+    test_deinit();
+}
+
+static uint32_t test_variant_instructions, test_variant_rungs;
+
+static bool test_variant_on_instruction(ladder_ctx_t *ladder_ctx) {
+    (void) ladder_ctx;
+    test_variant_instructions++;
+    return false;
+}
+
+static bool test_variant_on_scan_end(ladder_ctx_t *ladder_ctx) {
+    (void) ladder_ctx;
+    test_variant_rungs++;
+    return false;
+}
+
+void test_scan_variants(void) {
+    TEST_INIT("SCAN VARIANTS");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.on.scan_end = NULL;
+    ladder_ctx.on.panic = NULL;
+    SET_REG_M(0, 1);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    // no hooks: ladder.last is only set at the rung end
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Variant without hooks should power COIL", true);
+    CHECK_REG_D(2, 30, "Variant without hooks should execute ADD");
+    uint32_t row = ladder_ctx.ladder.last.cell_row, column = ladder_ctx.ladder.last.cell_column;
+    uint8_t instr = ladder_ctx.ladder.last.instr;
+
+    // traced variants leave the same ladder.last and call the hooks
+    ladder_ctx.on.instruction = test_variant_on_instruction;
+    ladder_ctx.on.scan_end = test_variant_on_scan_end;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    test_variant_instructions = test_variant_rungs = 0;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.cell_row == row && ladder_ctx.ladder.last.cell_column == column && ladder_ctx.ladder.last.instr == instr,
+            "Traced variant should end on the same cell", true);
+    CHECK(test_variant_instructions > 0, "Per instruction hook should be called", true);
+    CHECK_EQ(test_variant_rungs, ladder_topology_get(&ladder_ctx, 0)->rungs_qty, "Rung end hook should be called once per rung", true);
+
+    // removing the per instruction hook selects another variant on the next scan
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    test_variant_instructions = test_variant_rungs = 0;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(test_variant_instructions, 0, "Removed hook should not be called", true);
+    CHECK_EQ(test_variant_rungs, ladder_topology_get(&ladder_ctx, 0)->rungs_qty, "Rung end hook should be kept", true);
+
+    // a fault reports the failing cell without tracing
+    ladder_ctx.on.scan_end = NULL;
+    ladder_ctx.network[0].cells[2][1].code = LADDER_INS_INV;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.err == LADDER_INS_ERR_FAIL && ladder_ctx.ladder.last.cell_row == 2 && ladder_ctx.ladder.last.cell_column == 1,
+            "Fault should report the invalid cell", true);
+
+    test_deinit();
+}
+
+void test_program_sealed(void) {
+    TEST_INIT("PROGRAM SEALED");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    SET_REG_M(0, 1);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+    CHECK(!ladder_ctx.ladder.sealed, "Program should start unsealed", true);
+
+    CHECK_EQ(ladder_program_check(&ladder_ctx).error, LADDER_ERR_PRG_CHECK_OK, "Program check should pass", true);
+    CHECK(ladder_ctx.ladder.sealed, "Checked program should be sealed", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Sealed scan should power COIL", true);
+    CHECK_REG_D(2, 30, "Sealed scan should execute ADD");
+
+    // hardware functions replaced after sealing are still checked
+    ladder_ctx.on.task_after = NULL;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_ctx.hw.time.delay = NULL;
+    CHECK(!ladder_task_step(&ladder_ctx) && ladder_ctx.ladder.state == LADDER_ST_NULLFN, "Sealed task should need a delay function", true);
+    ladder_ctx.hw.time.delay = test_delay;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_ctx.hw.io.read[0] = NULL;
+    ladder_task_step(&ladder_ctx);
+    CHECK(ladder_ctx.ladder.state == LADDER_ST_ERROR, "Sealed task should not call a missing read function", true);
+    ladder_ctx.hw.io.read[0] = test_read;
+    ladder_ctx.on.task_after = test_on_task_after;
+    CHECK(ladder_ctx.ladder.sealed, "Hardware functions should not unseal the program", true);
+
+    // any change drops back to the checked path
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 4, LADDER_INS_NOP, 0), NOP);
+    CHECK(!ladder_ctx.ladder.sealed, "Editing the program should unseal it", true);
+    ladder_program_check(&ladder_ctx);
+    ladder_program_changed(&ladder_ctx);
+    CHECK(!ladder_ctx.ladder.sealed, "Program change should unseal it", true);
+    ladder_program_check(&ladder_ctx);
+    CHECK(ladder_add_read_fn(&ladder_ctx, test_read, test_init_read), "Read function should be added", true);
+    CHECK(!ladder_ctx.ladder.sealed, "Adding modules should unseal the program", true);
+
+    // passing programs missing described operands are not sealed
+    ladder_ctx.network[0].cells[2][1].data_qty = 2;
+    ladder_program_changed(&ladder_ctx);
+    CHECK_EQ(ladder_program_check(&ladder_ctx).error, LADDER_ERR_PRG_CHECK_OK, "Program check should pass", true);
+    CHECK(!ladder_ctx.ladder.sealed, "Program missing operands should not be sealed", true);
+    ladder_ctx.network[0].cells[2][1].data_qty = 3;
+
+    // failing programs are not sealed
+    ladder_ctx.network[0].cells[2][1].data[2].value.i32 = TEST_QTY_D;
+    ladder_program_changed(&ladder_ctx);
+    CHECK(ladder_program_check(&ladder_ctx).error != LADDER_ERR_PRG_CHECK_OK && !ladder_ctx.ladder.sealed, "Failing program should not be sealed", true);
+
+    test_deinit();
+}
+
+#ifdef OPTIONAL_COMPILED
+void test_scan_compiled(void) {
+    TEST_INIT("SCAN COMPILED");
+
+    bool states[5][5];
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    // per instruction hook forces the interpreter
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    SET_REG_M(3, 0);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED), "Compiled engine should be selectable", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.compiled != NULL, "Program should be compiled on first scan", true);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Compiled COIL should follow NO/NC rung", true);
+    CHECK_REG_D(2, 30, "Compiled ADD should sum D[0] and D[1] into D[2]");
+    for (uint32_t r = 0; r < 5; r++)
+        for (uint32_t c = 0; c < 5; c++)
+            states[r][c] = ladder_ctx.network[0].cells[r][c].state;
+    uint32_t counter = ladder_ctx.registers.C[0];
+
+    // same scan on the interpreter must produce the same power flow
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_INTERPRETER);
+    memset(ladder_ctx.memory.Cr, 0, TEST_QTY_C * sizeof(bool));
+    ladder_ctx.registers.C[0] = 0;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    bool same = true;
+    for (uint32_t r = 0; r < 5; r++)
+        for (uint32_t c = 0; c < 5; c++)
+            same &= (states[r][c] == ladder_ctx.network[0].cells[r][c].state);
+    CHECK(same, "Compiled cell states should match the interpreter", true);
+    CHECK_EQ(ladder_ctx.registers.C[0], counter, "Compiled CTU should match the interpreter", true);
+
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 4, LADDER_INS_NOP, 0), NOP);
+    CHECK(ladder_ctx.compiled == NULL, "Editing the program should discard compiled code", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+void test_scan_bound(void) {
+    TEST_INIT("SCAN BOUND OPERANDS");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_REG_D(2, 30, "Bound ADD should sum D[0] and D[1] into D[2]");
+
+    // operands must follow a reallocated bank
+    int32_t *D = malloc(TEST_QTY_D * sizeof(int32_t));
+    memcpy(D, ladder_ctx.registers.D, TEST_QTY_D * sizeof(int32_t));
+    free(ladder_ctx.registers.D);
+    ladder_ctx.registers.D = D;
+    SET_REG_D(1, 5);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_REG_D(2, 15, "Bound ADD should be rebound to the new D bank");
+
+    CHECK(ladder_add_read_fn(&ladder_ctx, test_read, test_init_read), "Read module should be added", true);
+    CHECK(ladder_ctx.compiled == NULL, "Adding a module should discard bound operands", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+void test_scan_incremental(void) {
+    TEST_INIT("SCAN INCREMENTAL");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_INCREMENTAL), "Incremental engine should be selectable", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Incremental COIL should follow NO/NC rung", true);
+    CHECK_REG_D(2, 30, "Incremental ADD should sum D[0] and D[1] into D[2]");
+
+    // unchanged registers: only the counter rung runs
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    ladder_incremental_t *incremental = ((ladder_compiled_t*) ladder_ctx.compiled)->incremental;
+    CHECK_EQ(incremental->executed, 1, "Unchanged program should only execute the counter rung", true);
+
+    SET_REG_M(0, 0);
+    SET_REG_D(1, 5);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 0, "Changed contact should re-evaluate its rung", true);
+    CHECK_REG_D(2, 15, "Changed operand should re-evaluate ADD");
+
+    test_deinit();
+}
+
+// Two row instruction on column 0: row 1 is no rung but runs with rung 0
+//   row 0: EQ D[0] D[1] -- COIL M[2]
+//   row 1: MULTI        -- TOF T[0]
+static bool test_multi_row_program(void) {
+    if (!ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_EQ, 0) || !ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_COIL, 0)
+            || !ladder_fn_cell(&ladder_ctx, 0, 1, 1, LADDER_INS_TOF, 0))
+        return false;
+
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    cells[0][0].data[0].type = LADDER_REGISTER_D;
+    cells[0][0].data[0].value.i32 = 0;
+    cells[0][0].data[1].type = LADDER_REGISTER_D;
+    cells[0][0].data[1].value.i32 = 1;
+    cells[0][1].data[0].type = LADDER_REGISTER_M;
+    cells[0][1].data[0].value.i32 = 2;
+    cells[1][1].data[0].type = LADDER_REGISTER_T;
+    cells[1][1].data[0].value.i32 = 0;
+    cells[1][1].data[1].type = (ladder_register_t) LADDER_BASETIME_MS;
+    cells[1][1].data[1].value.i32 = 100;
+    ladder_program_changed(&ladder_ctx);
+
+    ladder_ctx.network[0].enable = true;
+
+    return true;
+}
+
+void test_scan_incremental_multi(void) {
+    TEST_INIT("SCAN INCREMENTAL MULTI-ROW");
+
+    CHECK_LADDER_FN_CELL(test_multi_row_program(), MULTI_ROW_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_INCREMENTAL);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "EQ should power COIL", true);
+
+    ladder_incremental_t *incremental = ((ladder_compiled_t*) ladder_ctx.compiled)->incremental;
+    CHECK(incremental->network[0].units_qty >= 1 && incremental->unit[incremental->network[0].unit_first].always,
+            "Timer on a row below a multi-row instruction should run on every scan", true);
+
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(incremental->executed, 1, "Unchanged program should still execute the timer unit", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_PARALLEL
+void test_scan_parallel(void) {
+    TEST_INIT("SCAN PARALLEL");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.on.scan_end = NULL;
+
+    // network 1 reads M2 written by network 0, network 2 is independent
+    for (uint32_t n = 1; n < 3; n++) {
+        CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, n, 0, 0, LADDER_INS_NO, 0), NO);
+        CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, n, 0, 1, LADDER_INS_COIL, 0), COIL);
+        ladder_ctx.network[n].cells[0][0].data[0].type = LADDER_REGISTER_M;
+        ladder_ctx.network[n].cells[0][1].data[0].type = LADDER_REGISTER_M;
+        ladder_ctx.network[n].enable = true;
+    }
+    ladder_ctx.network[1].cells[0][0].data[0].value.i32 = 2;
+    ladder_ctx.network[1].cells[0][1].data[0].value.i32 = 6;
+    ladder_ctx.network[2].cells[0][0].data[0].value.i32 = 7;
+    ladder_ctx.network[2].cells[0][1].data[0].value.i32 = 8;
+    ladder_program_changed(&ladder_ctx);
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    SET_REG_M(7, 1);
+
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_PARALLEL), "Parallel engine should be selectable", true);
+    CHECK(ladder_set_workers(&ladder_ctx, 2), "Workers should be set", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Parallel COIL should follow NO/NC rung", true);
+    CHECK_EQ(ladder_ctx.memory.M[6], 1, "Dependent network should see M2 written on the same scan", true);
+    CHECK_EQ(ladder_ctx.memory.M[8], 1, "Independent network should follow M7", true);
+    CHECK_EQ(ladder_ctx.ladder.last.network, 2, "Last executed network should match the sequential scan", true);
+
+    ladder_parallel_t *parallel = ((ladder_compiled_t*) ladder_ctx.compiled)->parallel;
+    CHECK_EQ(parallel->levels_qty, 2, "Dependent network should run on a second level", true);
+    CHECK_EQ(parallel->order[parallel->level[0].first + parallel->level[0].qty - 1], 2, "Independent network should run on first level", true);
+
+    test_deinit();
+}
+
+void test_scan_parallel_multi(void) {
+    TEST_INIT("SCAN PARALLEL MULTI-ROW");
+
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.on.scan_end = NULL;
+
+    // network 1: TON on column 0 powers a SHL with a constant destination on its lower row (faults the scan)
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 1, 0, 0, LADDER_INS_TON, 0), TON);
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 1, 1, 1, LADDER_INS_SHL, 0), SHL);
+    ladder_cell_t **cells = ladder_ctx.network[1].cells;
+    cells[0][0].data[0].type = LADDER_REGISTER_T;
+    cells[0][0].data[0].value.i32 = 0;
+    cells[0][0].data[1].type = (ladder_register_t) LADDER_BASETIME_SEC;
+    cells[0][0].data[1].value.i32 = 100;
+    for (uint32_t d = 0; d < 2; d++) {
+        cells[1][1].data[d].type = LADDER_REGISTER_NONE;
+        cells[1][1].data[d].value.i32 = 1;
+    }
+
+    // network 2: independent rung that the sequential scan never reaches
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 2, 0, 0, LADDER_INS_NO, 0), NO);
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 2, 0, 1, LADDER_INS_COIL, 0), COIL);
+    ladder_ctx.network[2].cells[0][0].data[0].type = LADDER_REGISTER_M;
+    ladder_ctx.network[2].cells[0][0].data[0].value.i32 = 7;
+    ladder_ctx.network[2].cells[0][1].data[0].type = LADDER_REGISTER_M;
+    ladder_ctx.network[2].cells[0][1].data[0].value.i32 = 8;
+    ladder_ctx.network[1].enable = true;
+    ladder_ctx.network[2].enable = true;
+    ladder_program_changed(&ladder_ctx);
+    SET_REG_M(7, 1);
+
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_PARALLEL), "Parallel engine should be selectable", true);
+    CHECK(ladder_set_workers(&ladder_ctx, 2), "Workers should be set", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.err != LADDER_INS_ERR_OK, "SHL on the lower row should fault the scan", true);
+    CHECK_EQ(ladder_ctx.ladder.last.network, 1, "Faulting network should be the last one executed", true);
+    CHECK_EQ(ladder_ctx.memory.M[8], 0, "Network after the fault should not run", true);
+
+    ladder_parallel_t *parallel = ((ladder_compiled_t*) ladder_ctx.compiled)->parallel;
+    CHECK(parallel->levels_qty >= 2, "Faulting network should be a barrier", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_JIT
+void test_scan_jit(void) {
+    TEST_INIT("SCAN JIT");
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_JIT), "JIT engine should be selectable", true);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "JIT COIL should follow NO/NC rung", true);
+    CHECK_REG_D(2, 30, "JIT ADD should sum D[0] and D[1] into D[2]");
+    CHECK_EQ(ladder_ctx.registers.C[0], 1, "JIT should call CTU", true);
+#ifdef LADDER_JIT_AVAILABLE
+    ladder_jit_t *jit = ((ladder_compiled_t*) ladder_ctx.compiled)->jit;
+    CHECK(jit != NULL && jit->entry[0] != NULL, "Network should be translated to native code", true);
+#endif
+
+    // lockstep with the interpreter
+    CHECK(ladder_set_jit_check(&ladder_ctx, true), "JIT check should be set", true);
+    SET_REG_M(1, 1);
+    SET_REG_D(1, 5);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.state != LADDER_ST_ERROR, "JIT scan should match the interpreter", true);
+    CHECK_EQ(ladder_ctx.memory.M[2], 0, "Checked scan should keep the NC result", true);
+    CHECK_REG_D(2, 15, "Checked scan should keep the ADD result");
+
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 4, LADDER_INS_NOP, 0), NOP);
+    CHECK(ladder_ctx.compiled == NULL, "Editing the program should discard native code", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+static uint32_t test_generated_scans;
+
+static void test_generated_scan(ladder_ctx_t *ladder_ctx) {
+    test_generated_scans++;
+    ladder_scan(ladder_ctx);
+}
+
+void test_scan_generated(void) {
+    TEST_INIT("SCAN GENERATED");
+
+    char file[] = "/tmp/ladderlib_test_XXXXXX.c";
+    char line[256];
+    bool found = false;
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+
+    int fd = mkstemps(file, 2);
+    CHECK(fd >= 0, "Temporary file should be created", true);
+    close(fd);
+    CHECK(ladder_program_to_c(file, &ladder_ctx, "test"), "Program should be translated to C", true);
+    CHECK(!ladder_program_to_c(file, &ladder_ctx, "1test"), "Prefix should be a C identifier", true);
+    FILE *f = fopen(file, "r");
+    while (f != NULL && fgets(line, sizeof(line), f) != NULL)
+        found |= strncmp(line, "void test_scan(ladder_ctx_t *ladder_ctx) {", 42) == 0;
+    if (f != NULL)
+        fclose(f);
+    remove(file);
+    CHECK(found, "Generated file should define the scan function", true);
+
+    CHECK(!ladder_set_engine(&ladder_ctx, LADDER_ENGINE_GENERATED), "Generated engine needs a scan function", true);
+    CHECK(ladder_set_generated(&ladder_ctx, test_generated_scan), "Scan function should be set", true);
+    CHECK(ladder_set_engine(&ladder_ctx, LADDER_ENGINE_GENERATED), "Generated engine should be selectable", true);
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    test_generated_scans = 0;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(test_generated_scans, 1, "Task should call the generated scan function", true);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Generated scan should run the program", true);
+
+    ladder_set_generated(&ladder_ctx, NULL);
+    CHECK(ladder_ctx.ladder.engine == LADDER_ENGINE_INTERPRETER, "Removing the scan function should select the interpreter", true);
+
+    test_deinit();
+}
+#endif
+
+// test_engine_program translated by ladder_program_to_c with prefix "test_fixture" (regenerate when the generator output changes)
+#include "ladderlib_test_generated.c"
+
+void test_scan_fixture(void) {
+    TEST_INIT("SCAN GENERATED FIXTURE");
+
+    uint8_t outputs[32][4];
+    int32_t values[32][2];
+
+    ladder_ctx.on.instruction = NULL;
+    CHECK(test_fixture_program(&ladder_ctx), "Generated program should load", true);
+    CHECK(ladder_ctx.ladder.engine == LADDER_ENGINE_GENERATED, "Generated program should select its scan function", true);
+    CHECK(test_fixture_valid(&ladder_ctx), "Generated scan should accept the test context", true);
+
+    // same input sequence on the generated scan and on the interpreter
+    for (uint32_t pass = 0; pass < 2; pass++) {
+        if (pass == 1)
+            ladder_set_engine(&ladder_ctx, LADDER_ENGINE_INTERPRETER);
+        ladder_ctx.registers.C[0] = 0;
+        ladder_ctx.memory.Cd[0] = false;
+        ladder_ctx.memory.Cr[0] = false;
+        SET_REG_M(2, 0);
+        SET_REG_M(4, 0);
+        SET_REG_D(2, 0);
+
+        bool same = true;
+        for (uint32_t step = 0; step < 32; step++) {
+            uint32_t in = (step * 11) & 15;
+            SET_REG_M(0, in & 1);
+            SET_REG_M(1, (in >> 1) & 1);
+            SET_REG_M(3, (in >> 2) & 1);
+            SET_REG_M(5, (in >> 3) & 1);
+            SET_REG_D(0, (int32_t) step * 7 - 20);
+            SET_REG_D(1, 3 - (int32_t) step);
+            ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+            ladder_task((void*) &ladder_ctx);
+
+            uint8_t out[4] = { ladder_ctx.memory.M[2], ladder_ctx.memory.M[4], ladder_ctx.memory.Cd[0], ladder_ctx.memory.Cr[0] };
+            int32_t val[2] = { ladder_ctx.registers.D[2], ladder_ctx.registers.C[0] };
+            if (pass == 0) {
+                memcpy(outputs[step], out, sizeof(out));
+                memcpy(values[step], val, sizeof(val));
+            } else {
+                same &= memcmp(outputs[step], out, sizeof(out)) == 0 && memcmp(values[step], val, sizeof(val)) == 0;
+            }
+        }
+        if (pass == 1)
+            CHECK(same, "Generated scan should match the interpreter", true);
+    }
+    CHECK(values[31][1] > 0, "Sequence should count rising edges", true);
+
+    test_deinit();
+}
+
+#ifdef OPTIONAL_HOST
+static bool test_on_task_before_slow(ladder_ctx_t *ladder_ctx) {
+    (void) ladder_ctx;
+    test_delay(5);
+    return false;
+}
+
+void test_host(void) {
+    TEST_INIT("HOST");
+
+    ladder_ctx_t slow;
+    ladder_host_stats_t stats, slow_stats;
+
+    memset(&slow, 0, sizeof(ladder_ctx_t));
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 0);
+    ladder_ctx.on.task_after = NULL;
+    ladder_ctx.scan_internals.target_scan_ms = 2;
+
+    // scan takes longer than its 2 ms cycle
+    CHECK(ladder_ctx_init(&slow, 1, 1, 1, 1, 1, 1, 1, 1, 10, 0, true, true, 1000000UL, 2), "Second context should be initialized", true);
+    slow.hw.time.millis = test_millis;
+    slow.hw.time.delay = test_delay;
+    slow.on.task_before = test_on_task_before_slow;
+    slow.cron = NULL;
+    slow.ladder.state = LADDER_ST_RUNNING;
+
+    ladder_host_t *host = ladder_host_init(2, 4);
+    CHECK(host != NULL, "Host should start", true);
+    CHECK(ladder_host_add(host, &ladder_ctx), "Context should be added", true);
+    CHECK(!ladder_host_add(host, &ladder_ctx), "Context should be added once", true);
+    CHECK(ladder_host_add(host, &slow), "Slow context should be added", true);
+    test_delay(60);
+
+    CHECK(ladder_host_stats(host, &ladder_ctx, &stats), "Statistics should be available", true);
+    CHECK(stats.scans >= 10, "Context should be scanned every target_scan_ms", true);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Host scan should run the program", true);
+    CHECK(ladder_host_stats(host, &slow, &slow_stats), "Slow context statistics should be available", true);
+    CHECK(slow_stats.misses > 0 && slow_stats.skipped > 0, "Slow context should miss deadlines and drop releases", true);
+
+    CHECK(ladder_host_stop(host, &ladder_ctx), "Context should be stopped", true);
+    test_delay(10);
+    ladder_host_stats(host, &ladder_ctx, &stats);
+    CHECK(stats.ended, "Exit state should end the context", true);
+
+    CHECK(ladder_host_remove(host, &slow), "Slow context should be removed", true);
+    CHECK(!ladder_host_remove(host, &slow), "Removed context should not be found", true);
+    ladder_host_deinit(host);
+    ladder_ctx_deinit(&slow);
+
+    test_deinit();
+}
+#endif
+
+void test_program_compact(void) {
+    TEST_INIT("PROGRAM COMPACT");
+
+    ladder_network_t *net = &ladder_ctx.network[0];
+    CHECK(&net->cells[1][0] == &net->cells[0][net->cols], "Rows should be contiguous", true);
+    CHECK(ladder_network_cell(net, 2 * net->cols + 1) == &net->cells[2][1], "Flat index should address row * cols + column", true);
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+
+#ifdef OPTIONAL_COMPILED
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+#endif
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_program_compact(&ladder_ctx), "Program should be compacted", true);
+#ifdef OPTIONAL_COMPILED
+    CHECK(ladder_ctx.compiled == NULL, "Compacting should discard compiled code", true);
+#endif
+
+    // 6 single operand instructions, ADD and CTU
+    CHECK_EQ(net->pool_qty, 11, "Pool should hold data of all cells", true);
+    CHECK(net->cells[0][0].data == net->pool, "First cell data should start the pool", true);
+    CHECK(net->cells[2][2].data == net->pool + 9, "Data should follow cell order", true);
+    CHECK_EQ(net->cells[2][2].data[1].value.i32, 2, "Data values should be kept", true);
+
+    SET_REG_D(1, 5);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_REG_D(2, 15, "Compacted ADD should sum D[0] and D[1] into D[2]");
+
+    // pooled data is detached, new data is allocated outside the pool until next compact
+    ladder_cell_data_free(net, &net->cells[1][0]);
+    net->cells[1][0].code = LADDER_INS_NOP;
+    CHECK(net->cells[1][0].data == NULL, "Pooled data should be detached from the cell", true);
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 1, 0, LADDER_INS_NO, 0), NO);
+    CHECK(net->cells[1][0].data < net->pool || net->cells[1][0].data >= net->pool + net->pool_qty, "New data should be outside the pool", true);
+    CHECK(ladder_program_compact(&ladder_ctx), "Program should be compacted again", true);
+    CHECK(net->cells[1][0].data == net->pool + 3, "New data should be moved to the pool", true);
+
+    test_deinit();
+}
+
+void test_program_arena(void) {
+    TEST_INIT("PROGRAM ARENA");
+
+    ladder_arena_t *arena = ladder_arena_get(&ladder_ctx, 64);
+    CHECK(arena != NULL && ladder_arena_get(&ladder_ctx, 64) == arena, "Context should keep one arena", true);
+
+    uint8_t *bytes = ladder_arena_alloc(arena, 3);
+    ladder_value_t *value = ladder_arena_alloc(arena, sizeof(ladder_value_t));
+    CHECK((uintptr_t) value % _Alignof(max_align_t) == 0, "Arena memory should be aligned", true);
+    CHECK(bytes[0] == 0 && bytes[2] == 0 && value->value.u32 == 0, "Arena memory should be zeroed", true);
+
+    // blocks grow beyond the first one
+    uint8_t *big = ladder_arena_alloc(arena, 10000);
+    CHECK(big != NULL && ladder_arena_owns(arena, big + 9999), "Large allocation should get its own block", true);
+    CHECK(ladder_arena_owns(arena, bytes), "First block should be kept", true);
+    CHECK(!ladder_arena_owns(arena, &ladder_ctx), "Outside memory should not be owned", true);
+
+    char name[8] = "MOTOR";
+    const char *s1 = ladder_arena_strdup(arena, name);
+    name[0] = 'X';
+    const char *s2 = ladder_arena_strdup(arena, "MOTOR");
+    const char *s3 = ladder_arena_strdup(arena, name);
+    CHECK(s1 == s2 && strcmp(s1, "MOTOR") == 0, "Equal strings should be interned once", true);
+    CHECK(s3 != s1 && strcmp(s3, "XOTOR") == 0, "Different strings should not be shared", true);
+    bool interned = true;
+    for (uint32_t n = 0; n < 100; n++) {
+        snprintf(name, sizeof(name), "S%u", n);
+        interned = interned && ladder_arena_strdup(arena, name) != NULL;
+    }
+    snprintf(name, sizeof(name), "S%u", 42);
+    CHECK(interned && ladder_arena_strdup(arena, name) == ladder_arena_strdup(arena, "S42"), "Strings should stay interned after table growth", true);
+
+    // program data moved to the arena as the JSON loader does
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    ladder_network_t *net = &ladder_ctx.network[0];
+    for (uint32_t i = 0; i < net->rows * net->cols; i++) {
+        ladder_cell_t *cell = ladder_network_cell(net, i);
+        if (cell->data == NULL)
+            continue;
+        ladder_value_t *data = ladder_arena_alloc(arena, cell->data_qty * sizeof(ladder_value_t));
+        memcpy(data, cell->data, cell->data_qty * sizeof(ladder_value_t));
+        ladder_cell_data_free(net, cell);
+        cell->data = data;
+        cell->data_qty = ladder_fn_iocd[cell->code].data_qty;
+    }
+    net->arena = arena;
+    net->cells[3][0].data = ladder_arena_alloc(arena, sizeof(ladder_value_t));
+    net->cells[3][0].data_qty = 1;
+    net->cells[3][0].data[0].type = LADDER_REGISTER_S;
+    net->cells[3][0].data[0].value.cstr = s1;
+    ladder_program_changed(&ladder_ctx);
+
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_REG_D(2, 30, "ADD from arena data should sum D[0] and D[1] into D[2]");
+
+    // compacting keeps strings in the arena
+    CHECK(ladder_program_compact(&ladder_ctx), "Program should be compacted", true);
+    CHECK(net->cells[3][0].data[0].value.cstr == s1, "Interned string should be kept", true);
+
+    ladder_clear_program(&ladder_ctx);
+    CHECK(ladder_ctx.arena == NULL && net->arena == NULL, "Clearing should release the arena", true);
+    CHECK(net->cells[2][1].data == NULL && net->cells[3][0].data == NULL, "Cells should be detached from the arena", true);
+
+    test_deinit();
+}
+
+static bool test_tmp_json(char *file) {
+    int fd = mkstemps(file, 5);
+    if (fd < 0)
+        return false;
+    close(fd);
+    return true;
+}
+
+static bool test_same_file(const char *a, const char *b) {
+    FILE *fa = fopen(a, "r");
+    FILE *fb = fopen(b, "r");
+    bool same = fa != NULL && fb != NULL;
+    int ca = 0, cb = 0;
+    while (same && ca != EOF) {
+        ca = fgetc(fa);
+        cb = fgetc(fb);
+        same = ca == cb;
+    }
+    if (fa != NULL)
+        fclose(fa);
+    if (fb != NULL)
+        fclose(fb);
+    return same;
+}
+
+void test_program_json_sparse(void) {
+    TEST_INIT("PROGRAM JSON SPARSE");
+
+    char dense[] = "/tmp/ladderlib_test_XXXXXX.json";
+    char sparse[] = "/tmp/ladderlib_test_XXXXXX.json";
+    char reloaded[] = "/tmp/ladderlib_test_XXXXXX.json";
+    CHECK(test_tmp_json(dense) && test_tmp_json(sparse) && test_tmp_json(reloaded), "Temporary files should be created", true);
+
+    // rows 3 and 4 of network 0 and the whole networks 1 and 2 are empty rows in the sparse file
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    CHECK_EQ(ladder_program_to_json(dense, &ladder_ctx), JSON_ERROR_OK, "Program should be saved dense", true);
+    CHECK_EQ(ladder_program_to_json_sparse(sparse, &ladder_ctx), JSON_ERROR_OK, "Program should be saved sparse", true);
+
+    ladder_clear_program(&ladder_ctx);
+    CHECK_EQ(ladder_json_to_program(sparse, &ladder_ctx), JSON_ERROR_OK, "Sparse program with empty rows should load", true);
+    CHECK(ladder_ctx.network[0].rows == 5 && ladder_ctx.network[0].cols == 5, "Network shape should be kept", true);
+    CHECK(ladder_ctx.network[0].cells[2][2].code == LADDER_INS_CTU && ladder_ctx.network[0].cells[2][2].data[1].value.i32 == 2, "Cells should be loaded",
+            true);
+    CHECK(ladder_ctx.network[0].cells[4][4].code == LADDER_INS_NOP && ladder_ctx.network[1].cells[0][0].code == LADDER_INS_NOP, "Missing cells should be NOP",
+            true);
+    CHECK_EQ(ladder_program_to_json(reloaded, &ladder_ctx), JSON_ERROR_OK, "Loaded program should be saved dense", true);
+    CHECK(test_same_file(dense, reloaded), "Sparse round trip should keep every cell", true);
+
+    remove(dense);
+    remove(sparse);
+    remove(reloaded);
+
+    test_deinit();
+}
+
+void test_program_json_load(void) {
+    TEST_INIT("PROGRAM JSON LOAD");
+
+    char saved[] = "/tmp/ladderlib_test_XXXXXX.json";
+    char resaved[] = "/tmp/ladderlib_test_XXXXXX.json";
+    char reshaped[] = "/tmp/ladderlib_test_XXXXXX.json";
+    CHECK(test_tmp_json(saved) && test_tmp_json(resaved) && test_tmp_json(reshaped), "Temporary files should be created", true);
+
+    // network 1 as 1 row of 2 columns: NO M[7] -- COIL M[8]
+    FILE *f = fopen(reshaped, "w");
+    CHECK(f != NULL, "Reshaped program should be written", true);
+    fputs("[{\"id\": 1, \"rows\": 1, \"cols\": 2, \"networkData\": [["
+            "{\"symbol\": \"NO\", \"bar\": false, \"data\": [{\"name\": \"value\", \"type\": \"M\", \"value\": \"7\"}]},"
+            "{\"symbol\": \"COIL\", \"bar\": false, \"data\": [{\"name\": \"value\", \"type\": \"M\", \"value\": \"8\"}]}]]}]", f);
+    fclose(f);
+
+    CHECK_LADDER_FN_CELL(test_engine_program(), ENGINE_PROGRAM);
+    CHECK_EQ(ladder_program_to_json(saved, &ladder_ctx), JSON_ERROR_OK, "Program should be saved", true);
+
+    // load into a context whose network 0 has another shape
+    ladder_clear_program(&ladder_ctx);
+    ladder_network_t *net = &ladder_ctx.network[0];
+    CHECK(ladder_network_alloc(net, 2, 7), "Network should be reshaped", true);
+    CHECK_EQ(ladder_json_to_program(saved, &ladder_ctx), JSON_ERROR_OK, "Program should load over another network shape", true);
+    CHECK(net->rows == 5 && net->cols == 5, "Network should take the shape of the file", true);
+    CHECK(ladder_ctx.arena != NULL && net->arena == ladder_ctx.arena, "Cells data should live in the context arena", true);
+    CHECK(ladder_arena_owns(ladder_ctx.arena, net->cells[2][1].data), "Loaded data should come from the arena", true);
+    CHECK_EQ(ladder_program_to_json(resaved, &ladder_ctx), JSON_ERROR_OK, "Loaded program should be saved", true);
+    CHECK(test_same_file(saved, resaved), "Save after load should match the first save", true);
+
+    ladder_ctx.on.instruction = NULL;
+    SET_REG_M(5, 1);
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_REG_D(2, 30, "Loaded ADD should sum D[0] and D[1] into D[2]");
+
+    // clearing releases the arena, the program loads again into the cleared cells
+    ladder_clear_program(&ladder_ctx);
+    CHECK(ladder_ctx.arena == NULL && net->cells[2][1].code == LADDER_INS_NOP && net->cells[2][1].data == NULL, "Clearing should empty the program", true);
+    CHECK_EQ(ladder_json_to_program(saved, &ladder_ctx), JSON_ERROR_OK, "Program should load again after clearing", true);
+    CHECK_EQ(ladder_program_to_json(resaved, &ladder_ctx), JSON_ERROR_OK, "Reloaded program should be saved", true);
+    CHECK(test_same_file(saved, resaved), "Reload should match the first save", true);
+
+    // a file with another network shape replaces the whole program
+    CHECK_EQ(ladder_json_to_program(reshaped, &ladder_ctx), JSON_ERROR_OK, "Reshaped program should load", true);
+    CHECK(net->cells[2][1].code == LADDER_INS_NOP && net->cells[2][1].data == NULL, "Networks missing in the file should be cleared", true);
+    CHECK(ladder_ctx.network[1].rows == 1 && ladder_ctx.network[1].cols == 2, "Network 1 should take the shape of the file", true);
+    SET_REG_M(7, 1);
+    SET_REG_M(8, 0);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[8], 1, "Reshaped network should run", true);
+
+    remove(saved);
+    remove(resaved);
+    remove(reshaped);
+
+    test_deinit();
+}
+
+#ifdef OPTIONAL_COMPILED
+void test_program_optimize(void) {
+    TEST_INIT("PROGRAM OPTIMIZE");
+
+    // network 0 rungs: EQ 3 3 wired to COIL M2, GT 1 5 never energising COIL M3, contacts without output. Network 1: ADD 2 3 into D4
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_EQ, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_CONN, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_CONN, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 3, LADDER_INS_CONN, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 4, LADDER_INS_COIL, 0) && ladder_fn_cell(&ladder_ctx, 0, 2, 0, LADDER_INS_GT, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 2, 1, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 2, 2, LADDER_INS_COIL, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 4, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 4, 1, LADDER_INS_NO, 0)
+                    && ladder_fn_cell(&ladder_ctx, 1, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 1, 0, 1, LADDER_INS_ADD, 0), OPTIMIZE_PROGRAM);
+
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    ladder_cell_t *add = &ladder_ctx.network[1].cells[0][1];
+    int32_t constants[] = { 3, 3, 1, 5 };
+    for (uint32_t d = 0; d < 2; d++) {
+        cells[0][0].data[d].type = LADDER_REGISTER_NONE;
+        cells[0][0].data[d].value.i32 = constants[d];
+        cells[2][0].data[d].type = LADDER_REGISTER_NONE;
+        cells[2][0].data[d].value.i32 = constants[d + 2];
+        add->data[d].type = LADDER_REGISTER_NONE;
+        add->data[d].value.i32 = 2 + d;
+    }
+    add->data[2].type = LADDER_REGISTER_D;
+    add->data[2].value.i32 = 4;
+    uint32_t flags[][3] = { { 0, 4, 2 }, { 2, 1, 0 }, { 2, 2, 3 }, { 4, 0, 5 }, { 4, 1, 6 } };
+    for (uint32_t n = 0; n < sizeof(flags) / sizeof(flags[0]); n++) {
+        cells[flags[n][0]][flags[n][1]].data[0].type = LADDER_REGISTER_M;
+        cells[flags[n][0]][flags[n][1]].data[0].value.i32 = flags[n][2];
+    }
+    ladder_ctx.network[1].cells[0][0].data[0].type = LADDER_REGISTER_M;
+    ladder_ctx.network[1].cells[0][0].data[0].value.i32 = 5;
+    ladder_ctx.network[1].enable = true;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.on.instruction = NULL;
+
+    ladder_optimize_report_t report;
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    CHECK(ladder_program_optimize(&ladder_ctx, &report), "Program should be optimized", true);
+    CHECK_EQ(report.folded, 3, "EQ, GT and ADD on constants should be folded", true);
+    CHECK_EQ(report.wires, 3, "Connectors should be absorbed into one wire", true);
+    CHECK_EQ(report.dead_rungs, 1, "GT rung should never energise", true);
+    // GT and its NO contact, the contacts without output, EQ and two connectors inside the wire, the unused merge of the ADD rows
+    CHECK_EQ(report.removed, 8, "Unused and unpowered operations should be removed", true);
+    CHECK_EQ(report.ops_before - report.ops_after, report.removed, "Report should account for every removed operation", true);
+
+    SET_REG_M(3, 1);
+    SET_REG_M(5, 1);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Wired COIL should be set", true);
+    CHECK_EQ(ladder_ctx.memory.M[3], 0, "COIL of the dead rung should still be reset", true);
+    CHECK_REG_D(4, 5, "Folded ADD should store 5 in D4");
+    CHECK_CELL_STATE(0, 0, 3, true, "Wire end should be powered");
+    CHECK_CELL_STATE(0, 0, 1, false, "Absorbed connector should stay cleared");
+
+    // kept on recompilation, dropped with the program
+    ladder_program_changed(&ladder_ctx);
+    ladder_compiled_t *compiled = ladder_compiled_get(&ladder_ctx);
+    CHECK(compiled != NULL && compiled->optimized.removed == 8, "Recompiled program should be optimized", true);
+    ladder_clear_program(&ladder_ctx);
+    CHECK(!ladder_ctx.ladder.optimize, "Clearing the program should disable the optimizer", true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+static ladder_ins_err_t test_foreign_left(ladder_ctx_t *ladder_ctx, uint32_t column, uint32_t row) {
+    ladder_ctx->exec_network->cells[row][column].state = column == 0 ? true : ladder_ctx->exec_network->cells[row][column - 1].state;
+    return LADDER_INS_ERR_OK;
+}
+
+static bool test_foreign_left_init(ladder_foreign_function_t *fn, void *data, uint32_t qty) {
+    if (!dummy_foreign_fn_init(fn, data, qty))
+        return false;
+    fn->exec = test_foreign_left;
+    return true;
+}
+
+static bool test_power_end_state;
+
+static bool test_power_on_scan_end(ladder_ctx_t *ladder_ctx) {
+    test_power_end_state = ladder_ctx->exec_network->cells[2][0].state;
+    return false;
+}
+
+void test_scan_power_masks(void) {
+    TEST_INIT("SCAN POWER MASKS");
+
+    // rows 0 to 2 joined on column 0: NO M0 / NO M1 / NO M2 -- FOREIGN copying its left cell -- COIL M4
+    CHECK(ladder_add_foreign(&ladder_ctx, test_foreign_left_init, NULL, 1), "Foreign function should be added", true);
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 1, 0, LADDER_INS_NO, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 2, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_FOREIGN, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_COIL, 0), POWER_PROGRAM);
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    uint32_t flags[][3] = { { 0, 0, 0 }, { 1, 0, 1 }, { 2, 0, 2 }, { 0, 2, 4 } };
+    for (uint32_t n = 0; n < sizeof(flags) / sizeof(flags[0]); n++) {
+        cells[flags[n][0]][flags[n][1]].data[0].type = LADDER_REGISTER_M;
+        cells[flags[n][0]][flags[n][1]].data[0].value.i32 = flags[n][2];
+    }
+    cells[1][0].vertical_bar = true;
+    cells[2][0].vertical_bar = true;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.on.scan_end = test_power_on_scan_end;
+
+    SET_REG_M(1, 1);
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    ladder_task((void*) &ladder_ctx);
+    ladder_compiled_t *compiled = (ladder_compiled_t*) ladder_ctx.compiled;
+    CHECK(compiled != NULL && compiled->network[0].power[1] == 0x7, "Merged group should power rows 0 to 2 of column 0", true);
+    CHECK_EQ(ladder_ctx.memory.M[4], 1, "FOREIGN should read the merged power and drive the COIL", true);
+    CHECK_CELL_STATE(0, 2, 0, true, "Merged power should be written back to cell states");
+    CHECK(test_power_end_state, "Scan end hook should see the merged power", true);
+
+    SET_REG_M(1, 0);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(compiled->network[0].power[1] == 0, "Group without power should clear every row", true);
+    CHECK_EQ(ladder_ctx.memory.M[4], 0, "COIL should be reset", true);
+    CHECK_CELL_STATE(0, 0, 1, false, "FOREIGN cell should follow its left cell");
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+void test_scan_slices(void) {
+    TEST_INIT("SCAN SLICES");
+
+    // rows 0 to 3: NO M[row] -- NC M[5 + row] -- COIL M[10 + row]. Row 4 has the same shape but reads the coil of row 0
+    bool ok = true;
+    for (uint32_t row = 0; row < 5; row++) {
+        ok = ok && ladder_fn_cell(&ladder_ctx, 0, row, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, row, 1, LADDER_INS_NC, 0)
+                && ladder_fn_cell(&ladder_ctx, 0, row, 2, LADDER_INS_COIL, 0);
+        if (!ok)
+            break;
+        for (uint32_t column = 0; column < 3; column++) {
+            ladder_ctx.network[0].cells[row][column].data[0].type = LADDER_REGISTER_M;
+            ladder_ctx.network[0].cells[row][column].data[0].value.i32 = column * 5 + row;
+        }
+    }
+    CHECK_LADDER_FN_CELL(ok, SLICE_PROGRAM);
+    ladder_ctx.network[0].cells[4][0].data[0].value.i32 = 10;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.on.instruction = NULL;
+    ladder_ctx.on.scan_end = NULL;
+
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 1);
+    SET_REG_M(6, 1);
+    SET_REG_M(3, 1);
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    ladder_task((void*) &ladder_ctx);
+    ladder_compiled_t *compiled = (ladder_compiled_t*) ladder_ctx.compiled;
+    CHECK(compiled != NULL && compiled->network[0].slices_qty == 1, "Independent rungs should be grouped once", true);
+    CHECK_EQ(compiled->network[0].slice[0].lanes, 4, "Rung reading a coil of the group should be left out", true);
+    CHECK(ladder_ctx.memory.M[10] && !ladder_ctx.memory.M[11] && !ladder_ctx.memory.M[12] && ladder_ctx.memory.M[13], "Coils should follow their own rung",
+            true);
+    CHECK_EQ(ladder_ctx.memory.M[14], 1, "Rung after the group should read the coil written by the group", true);
+    CHECK_CELL_STATE(0, 1, 0, true, "Cell states of the group should be written back");
+    CHECK_CELL_STATE(0, 1, 1, false, "NC cell should be written back");
+
+    SET_REG_M(0, 0);
+    SET_REG_M(6, 0);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(!ladder_ctx.memory.M[10] && ladder_ctx.memory.M[11] && ladder_ctx.memory.M[13] && !ladder_ctx.memory.M[14], "Coils should follow inputs", true);
+    uint32_t row = ladder_ctx.ladder.last.cell_row, column = ladder_ctx.ladder.last.cell_column;
+
+    // rung end hook runs every rung on the operations
+    ladder_ctx.on.scan_end = test_power_on_scan_end;
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK(ladder_ctx.ladder.last.cell_row == row && ladder_ctx.ladder.last.cell_column == column, "Groups should end on the last cell of the operations",
+            true);
+    CHECK(!ladder_ctx.memory.M[10] && ladder_ctx.memory.M[11] && ladder_ctx.memory.M[13] && !ladder_ctx.memory.M[14], "Operations should match the groups",
+            true);
+
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_COMPILED
+static int32_t test_batch_done[8];
+
+// lane l: timer started on tick 2 * l, l count pulses, D1 = l
+static void test_batch_read(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg) {
+    (void) id;
+    (void) arg;
+    ladder_ctx->memory.M[0] = tick >= 2 * lane;
+    ladder_ctx->memory.M[5] = (tick & 1) && tick < 2 * lane;
+    ladder_ctx->registers.D[1] = (int32_t) lane;
+}
+
+static void test_batch_write(ladder_ctx_t *ladder_ctx, uint32_t lane, uint32_t id, uint64_t tick, void *arg) {
+    (void) id;
+    (void) arg;
+    if (ladder_ctx->memory.M[1] && test_batch_done[lane] < 0)
+        test_batch_done[lane] = (int32_t) tick;
+}
+
+void test_batch_lanes(void) {
+    TEST_INIT("BATCH LANES");
+
+    // network 0: NO M0 -- TON T0 (30 ms) -- COIL M1 / NO M5 -- CTU C0 (3) -- COIL M6. Network 1: EQ D1 D2 -- NC M3 -- COIL M4
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_TON, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_COIL, 0) && ladder_fn_cell(&ladder_ctx, 0, 3, 0, LADDER_INS_NO, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 3, 1, LADDER_INS_CTU, 0) && ladder_fn_cell(&ladder_ctx, 0, 3, 2, LADDER_INS_COIL, 0)
+                    && ladder_fn_cell(&ladder_ctx, 1, 0, 0, LADDER_INS_EQ, 0) && ladder_fn_cell(&ladder_ctx, 1, 0, 1, LADDER_INS_NC, 0)
+                    && ladder_fn_cell(&ladder_ctx, 1, 0, 2, LADDER_INS_COIL, 0), BATCH_PROGRAM);
+    ladder_cell_t **cells = ladder_ctx.network[0].cells, **equal = ladder_ctx.network[1].cells;
+    uint32_t flags[][3] = { { 0, 0, 0 }, { 0, 2, 1 }, { 3, 0, 5 }, { 3, 2, 6 } };
+    for (uint32_t n = 0; n < sizeof(flags) / sizeof(flags[0]); n++) {
+        cells[flags[n][0]][flags[n][1]].data[0].type = LADDER_REGISTER_M;
+        cells[flags[n][0]][flags[n][1]].data[0].value.i32 = flags[n][2];
+    }
+    equal[0][1].data[0].type = LADDER_REGISTER_M;
+    equal[0][1].data[0].value.i32 = 3;
+    equal[0][2].data[0].type = LADDER_REGISTER_M;
+    equal[0][2].data[0].value.i32 = 4;
+    cells[0][1].data[0].type = LADDER_REGISTER_T;
+    cells[0][1].data[0].value.i32 = 0;
+    cells[0][1].data[1].type = (ladder_register_t) LADDER_BASETIME_MS;
+    cells[0][1].data[1].value.i32 = 30;
+    equal[0][0].data[0].type = LADDER_REGISTER_D;
+    equal[0][0].data[0].value.i32 = 1;
+    equal[0][0].data[1].type = LADDER_REGISTER_D;
+    equal[0][0].data[1].value.i32 = 2;
+    cells[3][1].data[0].type = LADDER_REGISTER_C;
+    cells[3][1].data[0].value.i32 = 0;
+    cells[3][1].data[1].value.i32 = 3;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.network[1].enable = true;
+    SET_REG_D(2, 2);
+
+    ladder_batch_io_t io = { .read = test_batch_read, .write = test_batch_write, .arg = NULL };
+    ladder_batch_t *batch = ladder_batch_init(&ladder_ctx, 8, &io);
+    CHECK(batch != NULL, "Batch should be created", true);
+    if (batch == NULL) {
+        test_deinit();
+        return;
+    }
+    for (uint32_t lane = 0; lane < 8; lane++)
+        test_batch_done[lane] = -1;
+
+    // 12 cycles of 10 ms
+    CHECK(ladder_batch_run(batch, 12, 10) == 0xff, "Every lane should keep running", true);
+    bool timer = true, compare = true, counter = true;
+    for (uint32_t lane = 0; lane < 8; lane++) {
+        ladder_ctx_t *ctx = ladder_batch_lane(batch, lane);
+        timer = timer && test_batch_done[lane] == (lane <= 4 ? (int32_t) (2 * lane + 3) : -1) && ctx->memory.M[1] == (lane <= 4);
+        compare = compare && ctx->memory.M[4] == (lane == 2);
+        counter = counter && ctx->registers.C[0] == (lane < 3 ? lane : 3) && ctx->memory.M[6] == (lane >= 3);
+    }
+    CHECK(timer, "Timers should run on the virtual clock of each lane", true);
+    CHECK(compare, "Compare should read the registers of each lane", true);
+    CHECK(counter, "Counters should count the pulses of each lane", true);
+    CHECK(ladder_ctx.memory.M[1] == 0 && ladder_ctx.registers.C[0] == 0, "Prototype should be left untouched", true);
+    CHECK(ladder_batch_lane(batch, 8) == NULL, "Lane out of range should be rejected", true);
+
+    ladder_batch_deinit(batch);
+    test_deinit();
+}
+#endif
+
+#ifdef OPTIONAL_FARM
+static int32_t test_farm_writes[100];
+
+static bool test_farm_init_write(ladder_ctx_t *ladder_ctx, uint32_t id, bool init) {
+    if (!init) {
+        free(ladder_ctx->output[id].Q);
+        free(ladder_ctx->output[id].Qh);
+        return true;
+    }
+    ladder_ctx->output[id].q_qty = 2;
+    ladder_ctx->output[id].Q = calloc(2, sizeof(uint8_t));
+    ladder_ctx->output[id].Qh = calloc(2, sizeof(uint8_t));
+    return ladder_ctx->output[id].Q != NULL && ladder_ctx->output[id].Qh != NULL;
+}
+
+// run r: (r % 7) pulses on M0
+static void test_farm_read(ladder_ctx_t *ladder_ctx, uint32_t run, uint32_t id, uint64_t tick, void *arg) {
+    (void) arg;
+    if (id == 0)
+        ladder_ctx->memory.M[0] = (tick & 1) && tick < 2 * (run % 7);
+}
+
+static void test_farm_write(ladder_ctx_t *ladder_ctx, uint32_t run, uint32_t id, uint64_t tick, void *arg) {
+    (void) ladder_ctx;
+    (void) tick;
+    (void) arg;
+    if (id == 1)
+        test_farm_writes[run]++;
+}
+
+void test_farm(void) {
+    TEST_INIT("FARM");
+
+    // NO M0 -- CTU C0 (3) -- COIL Q1.0
+    CHECK(ladder_add_write_fn(&ladder_ctx, test_write, test_farm_init_write), "Output module should be added", true);
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_CTU, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_COIL, 0), FARM_PROGRAM);
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    cells[0][0].data[0].type = LADDER_REGISTER_M;
+    cells[0][0].data[0].value.i32 = 0;
+    cells[0][1].data[0].type = LADDER_REGISTER_C;
+    cells[0][1].data[0].value.i32 = 0;
+    cells[0][1].data[1].value.i32 = 3;
+    cells[0][2].data[0].type = LADDER_REGISTER_Q;
+    cells[0][2].data[0].value.mp.module = 1;
+    cells[0][2].data[0].value.mp.port = 0;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+
+    // two batches on two workers
+    memset(test_farm_writes, 0, sizeof(test_farm_writes));
+    ladder_batch_io_t io = { .read = test_farm_read, .write = test_farm_write, .arg = NULL };
+    ladder_farm_t *farm = ladder_farm_run(&ladder_ctx, 100, 20, 10, 2, &io);
+    CHECK(farm != NULL, "Farm should run", true);
+    if (farm == NULL) {
+        test_deinit();
+        return;
+    }
+    CHECK(farm->runs == 100 && farm->q_qty == 2 && farm->qw_qty == 0, "Results table should hold every run and its outputs", true);
+    CHECK_EQ(farm->scans, 2000, "Every run should scan every cycle", true);
+    bool outputs = true, stats = true;
+    for (uint32_t r = 0; r < 100; r++) {
+        outputs = outputs && farm->result[r].Q[0] == (r % 7 >= 3) && farm->result[r].Q[1] == 0;
+        stats = stats && farm->result[r].scans == 20 && farm->result[r].state == LADDER_ST_RUNNING && test_farm_writes[r] == 20;
+    }
+    CHECK(outputs, "Outputs should follow the inputs of each run", true);
+    CHECK(stats, "Each run should be written and counted once per cycle", true);
+    ladder_farm_free(farm);
+
+    test_deinit();
+}
+#endif
+
+void test_flags_packed(void) {
+    TEST_INIT("FLAGS PACKED");
+
+    // whole words, byte groups and a partial tail
+    uint8_t flags[150], unpacked[150];
+    uint64_t words[LADDER_FLAG_WORDS(150)];
+    for (uint32_t n = 0; n < 150; n++)
+        flags[n] = (n % 3 == 0) ? 0 : (uint8_t) n;
+    ladder_bits_pack(words, flags, 150);
+    bool match = true;
+    for (uint32_t n = 0; n < 150; n++)
+        match = match && ladder_bits_get(words, n) == (flags[n] != 0);
+    CHECK(match, "Packed flags should be set for non zero values", true);
+    CHECK_EQ(words[2] >> 22, 0, "Unused bits of last word should be cleared", true);
+    ladder_bits_unpack(unpacked, words, 150);
+    match = true;
+    for (uint32_t n = 0; n < 150; n++)
+        match = match && unpacked[n] == (flags[n] != 0);
+    CHECK(match, "Unpacked flags should be 0 or 1", true);
+
+    SET_REG_M(1, 1);
+    SET_REG_M(17, 1);
+    ladder_save_previous_values(&ladder_ctx);
+    CHECK(ladder_history_get(LADDER_HISTORY(&ladder_ctx, M), 17), "History should hold M17", true);
+
+    SET_REG_M(1, 0);
+    SET_REG_M(4, 1);
+    uint64_t rising, falling;
+    CHECK(ladder_flag_edges(&ladder_ctx, LADDER_REGISTER_M, &rising, &falling), "Edges should be available for M", true);
+    CHECK_EQ(rising, (uint64_t) 1 << 4, "M4 should be rising", true);
+    CHECK_EQ(falling, (uint64_t) 1 << 1, "M1 should be falling", true);
+    CHECK(!ladder_flag_edges(&ladder_ctx, LADDER_REGISTER_D, &rising, NULL), "Edges should not be available for D", true);
+
+    test_deinit();
+}
+
+void test_frame_call(void) {
+    TEST_INIT("FRAME CALL");
+
+    SET_REG_D(0, 10);
+    SET_REG_D(1, 20);
+    SET_REG_D(2, 0);
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_ADD, 0), ADD);
+    for (uint32_t n = 0; n < 3; n++) {
+        ladder_ctx.network[0].cells[0][1].data[n].type = LADDER_REGISTER_D;
+        ladder_ctx.network[0].cells[0][1].data[n].value.i32 = n;
+    }
+    ladder_ctx.exec_network = &ladder_ctx.network[0];
+
+    ladder_frame_t frame;
+    ladder_frame_cell(&frame, &ladder_ctx, 1, 0);
+    CHECK(frame.cell == &ladder_ctx.network[0].cells[0][1] && frame.data == frame.cell->data, "Frame should point to the cell and its operands", true);
+    CHECK_EQ(frame.left, 0, "Frame left power should follow the unpowered left cells", true);
+    ladder_ctx.network[0].cells[1][0].state = true;
+    ladder_frame_cell(&frame, &ladder_ctx, 1, 0);
+    CHECK_EQ(frame.left, 2, "Frame left power should hold one bit per instruction row", true);
+
+    // the instruction takes its left power from the frame only
+    ladder_ctx.network[0].cells[1][0].state = false;
+    frame.left = 1;
+    CHECK(ladder_function[LADDER_INS_ADD](&frame) == LADDER_INS_ERR_OK, "ADD should run on a frame", true);
+    CHECK_REG_D(2, 30, "ADD should sum with the frame left power");
+    CHECK_CELL_STATE(0, 0, 1, true, "ADD should pass the frame left power");
+
+#ifdef OPTIONAL_COMPILED
+    // foreign functions keep the column and row prototype on compiled engines
+    CHECK(ladder_add_foreign(&ladder_ctx, dummy_foreign_fn_init, NULL, 1), "Foreign function should be added", true);
+    CHECK_LADDER_FN_CELL(ladder_fn_cell(&ladder_ctx, 0, 3, 0, LADDER_INS_FOREIGN, 0), FOREIGN);
+    ladder_ctx.network[0].enable = true;
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    ladder_task((void*) &ladder_ctx);
+    CHECK_CELL_STATE(0, 3, 0, true, "Foreign function should run on the compiled engine");
+#endif
+
+    test_deinit();
+}
+
+#ifdef OPTIONAL_COMPILED
+void test_program_fusion(void) {
+    TEST_INIT("PROGRAM FUSION");
+
+    // network 0 rows: NO M0, NO M1, COIL M2 / NO M0, NC M1, COIL M3. Network 1: RE M4, CTU C0 preset 2. Network 2: EQ D0 D1, MOVE D2 to D3
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_NO, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 0, 2, LADDER_INS_COIL, 0) && ladder_fn_cell(&ladder_ctx, 0, 1, 0, LADDER_INS_NO, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 1, 1, LADDER_INS_NC, 0) && ladder_fn_cell(&ladder_ctx, 0, 1, 2, LADDER_INS_COIL, 0)
+                    && ladder_fn_cell(&ladder_ctx, 2, 0, 0, LADDER_INS_EQ, 0) && ladder_fn_cell(&ladder_ctx, 2, 0, 1, LADDER_INS_MOVE, 0)
+                    && ladder_fn_cell(&ladder_ctx, 1, 0, 0, LADDER_INS_RE, 0) && ladder_fn_cell(&ladder_ctx, 1, 0, 1, LADDER_INS_CTU, 0), FUSION_PROGRAM);
+
+    ladder_cell_t **cells = ladder_ctx.network[0].cells, **counter = ladder_ctx.network[1].cells, **move = ladder_ctx.network[2].cells;
+    uint32_t flags[][3] = { { 0, 0, 0 }, { 0, 1, 1 }, { 0, 2, 2 }, { 1, 0, 0 }, { 1, 1, 1 }, { 1, 2, 3 } };
+    for (uint32_t n = 0; n < sizeof(flags) / sizeof(flags[0]); n++) {
+        cells[flags[n][0]][flags[n][1]].data[0].type = LADDER_REGISTER_M;
+        cells[flags[n][0]][flags[n][1]].data[0].value.i32 = flags[n][2];
+    }
+    for (uint32_t d = 0; d < 2; d++) {
+        move[0][0].data[d].type = LADDER_REGISTER_D;
+        move[0][0].data[d].value.i32 = d;
+        move[0][1].data[d].type = LADDER_REGISTER_D;
+        move[0][1].data[d].value.i32 = 2 + d;
+    }
+    counter[0][0].data[0].type = LADDER_REGISTER_M;
+    counter[0][0].data[0].value.i32 = 4;
+    counter[0][1].data[0].type = LADDER_REGISTER_C;
+    counter[0][1].data[0].value.i32 = 0;
+    counter[0][1].data[1].type = LADDER_REGISTER_NONE;
+    counter[0][1].data[1].value.i32 = 2;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.network[1].enable = true;
+    ladder_ctx.network[2].enable = true;
+    ladder_ctx.on.instruction = NULL;
+
+    ladder_optimize_report_t report;
+    ladder_set_engine(&ladder_ctx, LADDER_ENGINE_COMPILED);
+    CHECK(ladder_program_optimize(&ladder_ctx, &report), "Program should be optimized", true);
+    CHECK_EQ(report.fused[LADDER_FUSE_NO_NO_COIL], 1, "NO, NO, COIL should be fused", true);
+    CHECK_EQ(report.fused[LADDER_FUSE_NO_NC_COIL], 1, "NO, NC, COIL should be fused", true);
+    CHECK_EQ(report.fused[LADDER_FUSE_EQ_MOVE], 1, "EQ, MOVE should be fused", true);
+    CHECK_EQ(report.fused[LADDER_FUSE_RE_CTU], 1, "RE, CTU should be fused", true);
+    CHECK_EQ(report.ops_before, report.ops_after, "Fused operations should stay in place", true);
+
+    SET_REG_M(0, 1);
+    SET_REG_M(1, 1);
+    SET_REG_D(0, 7);
+    SET_REG_D(1, 7);
+    SET_REG_D(2, 42);
+    SET_REG_M(4, 1);
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.memory.M[2], 1, "Fused NO, NO, COIL should set M2", true);
+    CHECK_EQ(ladder_ctx.memory.M[3], 0, "Fused NO, NC, COIL should reset M3", true);
+    CHECK_CELL_STATE(0, 0, 1, true, "Second contact of a fused sequence should be powered");
+    CHECK_CELL_STATE(0, 1, 1, false, "Open NC of a fused sequence should stay unpowered");
+    CHECK_REG_D(3, 42, "Fused MOVE should copy D2 to D3");
+    CHECK_CELL_STATE(2, 0, 0, true, "Fused EQ should be powered");
+    CHECK_EQ(ladder_ctx.registers.C[0], 1, "Fused RE, CTU should count the rising edge", true);
+
+    // held input: no new edge. Released and pressed again: preset reached
+    ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+    ladder_task((void*) &ladder_ctx);
+    CHECK_EQ(ladder_ctx.registers.C[0], 1, "Held input should not count", true);
+    for (uint32_t n = 0; n < 2; n++) {
+        SET_REG_M(4, n);
+        ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+        ladder_task((void*) &ladder_ctx);
+    }
+    CHECK_EQ(ladder_ctx.registers.C[0], 2, "Second rising edge should count", true);
+    CHECK_CELL_STATE(1, 0, 1, true, "Fused CTU should be done at preset");
+    CHECK(ladder_ctx.ladder.last.network == 2 && ladder_ctx.ladder.last.err == LADDER_INS_ERR_OK, "Scan should end on the last network without error", true);
+
+    test_deinit();
+}
+#endif
+
+// custom instructions read operands bound by compiled engines, D and M registers of the cell otherwise
+static uint32_t custom_bound_calls;
+
+static int32_t test_custom_get(const ladder_frame_t *frame, uint32_t i) {
+    return frame->bound != NULL ? ladder_operand_get(&frame->bound[i]) : frame->ctx->registers.D[frame->data[i].value.i32];
+}
+
+// D2 = D0 * D1 + 1 with power, output follows the left power
+static ladder_ins_err_t test_custom_scale(const ladder_frame_t *frame) {
+    bool left = FRAME_LEFT(frame, 0);
+    FRAME_STATE(frame, 0) = left;
+    custom_bound_calls += frame->bound != NULL;
+    if (!left)
+        return LADDER_INS_ERR_OK;
+
+    int32_t value = test_custom_get(frame, 0) * test_custom_get(frame, 1) + 1;
+    if (frame->bound != NULL)
+        ladder_operand_set(&frame->bound[2], &value);
+    else
+        frame->ctx->registers.D[frame->data[2].value.i32] = value;
+    return LADDER_INS_ERR_OK;
+}
+
+// runs without power: M operand takes the inverted left power
+static ladder_ins_err_t test_custom_inverse(const ladder_frame_t *frame) {
+    uint8_t value = !FRAME_LEFT(frame, 0);
+    FRAME_STATE(frame, 0) = false;
+    if (frame->bound != NULL)
+        ladder_operand_set(&frame->bound[0], &value);
+    else
+        frame->ctx->memory.M[frame->data[0].value.i32] = value;
+    return LADDER_INS_ERR_OK;
+}
+
+void test_custom_instruction(void) {
+    TEST_INIT("CUSTOM INSTRUCTION");
+
+    ladder_custom_t scale = { .code = LADDER_INS_CUSTOM, .name = "SCALE", .description = { 1, 1, 1, 3 }, .exec = test_custom_scale, .side_effects = false,
+            .signature = { LADDER_SIG_READ, LADDER_SIG_READ, LADDER_SIG_WRITE } };
+    ladder_custom_t inverse = { .code = LADDER_INS_CUSTOM + 1, .name = "INV", .description = { 1, 1, 1, 1 }, .exec = test_custom_inverse,
+            .side_effects = true, .signature = { LADDER_SIG_WRITE } };
+    ladder_custom_t bad = scale;
+
+    bad.code = LADDER_INS_INV;
+    CHECK(!ladder_add_instruction(&ladder_ctx, &bad), "Builtin range code should be rejected", true);
+    bad.code = LADDER_INS_CUSTOM + LADDER_CUSTOM_MAX;
+    CHECK(!ladder_add_instruction(&ladder_ctx, &bad), "Code out of the custom range should be rejected", true);
+    bad.code = LADDER_INS_CUSTOM + 2;
+    bad.description.data_qty = LADDER_CUSTOM_DATA + 1;
+    CHECK(!ladder_add_instruction(&ladder_ctx, &bad), "Too many operands should be rejected", true);
+    CHECK(!ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_CUSTOM, 0), "Cell should not take an unregistered code", true);
+    CHECK(ladder_add_instruction(&ladder_ctx, &scale) && ladder_add_instruction(&ladder_ctx, &inverse), "Custom instructions should be added", true);
+    CHECK(!ladder_add_instruction(&ladder_ctx, &scale), "Registered code should be rejected", true);
+
+    // row 0: NO M0, SCALE D0 D1 D2. Row 1: NO M2, INV M1
+    CHECK_LADDER_FN_CELL(
+            ladder_fn_cell(&ladder_ctx, 0, 0, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 0, 1, LADDER_INS_CUSTOM, 0)
+                    && ladder_fn_cell(&ladder_ctx, 0, 1, 0, LADDER_INS_NO, 0) && ladder_fn_cell(&ladder_ctx, 0, 1, 1, LADDER_INS_CUSTOM + 1, 0), CUSTOM);
+    ladder_cell_t **cells = ladder_ctx.network[0].cells;
+    CHECK_EQ(cells[0][1].data_qty, 3, "Cell should take the custom operands quantity", true);
+    cells[0][0].data[0].type = LADDER_REGISTER_M;
+    cells[0][0].data[0].value.i32 = 0;
+    for (uint32_t n = 0; n < 3; n++) {
+        cells[0][1].data[n].type = LADDER_REGISTER_D;
+        cells[0][1].data[n].value.i32 = n;
+    }
+    cells[1][0].data[0].type = LADDER_REGISTER_M;
+    cells[1][0].data[0].value.i32 = 2;
+    cells[1][1].data[0].type = LADDER_REGISTER_M;
+    cells[1][1].data[0].value.i32 = 1;
+    ladder_program_changed(&ladder_ctx);
+    ladder_ctx.network[0].enable = true;
+    ladder_ctx.on.instruction = NULL;
+    CHECK_EQ(ladder_program_check(&ladder_ctx).error, LADDER_ERR_PRG_CHECK_OK, "Program check should accept custom instructions", true);
+
+    const ladder_scan_engine_t engines[] = { LADDER_ENGINE_INTERPRETER,
+#ifdef OPTIONAL_COMPILED
+            LADDER_ENGINE_COMPILED, LADDER_ENGINE_INCREMENTAL,
+#endif
+#ifdef OPTIONAL_PARALLEL
+            LADDER_ENGINE_PARALLEL,
+#endif
+#ifdef OPTIONAL_JIT
+            LADDER_ENGINE_JIT,
+#endif
+            };
+    for (uint32_t e = 0; e < sizeof(engines) / sizeof(engines[0]); e++) {
+        ladder_set_engine(&ladder_ctx, engines[e]);
+        custom_bound_calls = 0;
+        SET_REG_M(0, 1);
+        SET_REG_M(2, 0);
+        SET_REG_D(0, 6);
+        SET_REG_D(1, 7);
+        ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+        ladder_task((void*) &ladder_ctx);
+        CHECK_REG_D(2, 43, "Custom instruction should write its result");
+        CHECK_CELL_STATE(0, 0, 1, true, "Custom instruction should pass the power");
+        CHECK_EQ(ladder_ctx.memory.M[1], 1, "Custom instruction with side effects should run without power", true);
+
+        // the incremental engine reruns the rung on a change of a read operand
+        SET_REG_D(0, 2);
+        SET_REG_M(2, 1);
+        ladder_ctx.ladder.state = LADDER_ST_RUNNING;
+        ladder_task((void*) &ladder_ctx);
+        CHECK_REG_D(2, 15, "Custom instruction should follow its operands");
+        CHECK_EQ(ladder_ctx.memory.M[1], 0, "Custom instruction should follow its left power", true);
+        // native code calls custom instructions on the cell operands
+        bool bound = engines[e] != LADDER_ENGINE_INTERPRETER && engines[e] != LADDER_ENGINE_JIT;
+        CHECK_EQ(custom_bound_calls > 0, bound, "Compiled engines should bind custom operands", true);
+    }
+
+    test_deinit();
+}
+
+/////////////////////////////////////////////////////////////////
+
 bool test_ladder_instructions(void) {
     printf("\e[1;1H\e[2J- [START TESTS] -\n\n");
 
@@ -1328,6 +2862,44 @@ bool test_ladder_instructions(void) {
     test_fn_XOR();
     test_fn_TMOVE();
 
+    test_scan_topology();
+    test_scan_sparse();
+    test_scan_variants();
+    test_program_sealed();
+    test_scan_fixture();
+    test_program_compact();
+    test_program_arena();
+    test_program_json_sparse();
+    test_program_json_load();
+    test_flags_packed();
+    test_frame_call();
+    test_custom_instruction();
+#ifdef OPTIONAL_COMPILED
+    test_scan_compiled();
+    test_scan_bound();
+    test_scan_incremental();
+    test_scan_incremental_multi();
+    test_scan_generated();
+    test_program_optimize();
+    test_scan_power_masks();
+    test_scan_slices();
+    test_batch_lanes();
+    test_program_fusion();
+#endif
+#ifdef OPTIONAL_PARALLEL
+    test_scan_parallel();
+    test_scan_parallel_multi();
+#endif
+#ifdef OPTIONAL_JIT
+    test_scan_jit();
+#endif
+#ifdef OPTIONAL_HOST
+    test_host();
+#endif
+#ifdef OPTIONAL_FARM
+    test_farm();
+#endif
+
     printf("\n- [END TESTS] -\n\n");
 
     if (tests_failed != 0) {
@@ -0,0 +1,373 @@
+/*
+ * Ladder program translated to C by ladder_program_to_c(). Do not edit.
+ *
+ *   bool test_fixture_program(ladder_ctx_t *ladder_ctx): load the program and select the generated engine
+ *   void test_fixture_scan(ladder_ctx_t *ladder_ctx): scan function for ladder_set_generated()
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "ladder.h"
+#include "ladder_instructions.h"
+#include "ladder_internals.h"
+#include "ladder_bits.h"
+
+#define test_fixture_NETWORKS 3
+
+typedef struct test_fixture_cell_s {
+     uint8_t code;
+        bool vertical_bar;
+     uint8_t data_qty;
+    uint32_t data;
+} test_fixture_cell_t;
+
+typedef struct test_fixture_network_s {
+          uint32_t rows;
+          uint32_t cols;
+              bool enable;
+    const test_fixture_cell_t *cells;
+} test_fixture_network_t;
+
+static const ladder_value_t test_fixture_data[] = {
+    { LADDER_REGISTER_M, .value.i32 = 0 },
+    { LADDER_REGISTER_M, .value.i32 = 1 },
+    { LADDER_REGISTER_M, .value.i32 = 2 },
+    { LADDER_REGISTER_M, .value.i32 = 3 },
+    { LADDER_REGISTER_M, .value.i32 = 4 },
+    { LADDER_REGISTER_M, .value.i32 = 5 },
+    { LADDER_REGISTER_D, .value.i32 = 0 },
+    { LADDER_REGISTER_D, .value.i32 = 1 },
+    { LADDER_REGISTER_D, .value.i32 = 2 },
+    { LADDER_REGISTER_C, .value.i32 = 0 },
+    { LADDER_REGISTER_NONE, .value.i32 = 2 },
+};
+
+static const test_fixture_cell_t test_fixture_cells_0[] = {
+    { 3, false, 1, 0 }, { 4, false, 1, 1 }, { 7, false, 1, 2 }, { 0, false, 0, 3 }, { 0, false, 0, 3 },
+    { 3, false, 1, 3 }, { 1, true, 0, 4 }, { 7, false, 1, 4 }, { 0, false, 0, 5 }, { 0, false, 0, 5 },
+    { 3, false, 1, 5 }, { 17, true, 3, 6 }, { 13, true, 2, 9 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 38, true, 0, 11 }, { 38, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 38, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+};
+
+static const test_fixture_cell_t test_fixture_cells_1[] = {
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+};
+
+static const test_fixture_cell_t test_fixture_cells_2[] = {
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+    { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 }, { 0, false, 0, 11 },
+};
+
+static const test_fixture_network_t test_fixture_networks[test_fixture_NETWORKS] = {
+    { 5, 5, true, test_fixture_cells_0 },
+    { 5, 5, false, test_fixture_cells_1 },
+    { 5, 5, false, test_fixture_cells_2 },
+};
+
+bool test_fixture_program(ladder_ctx_t *ladder_ctx);
+void test_fixture_scan(ladder_ctx_t *ladder_ctx);
+
+static inline void test_fixture_last(ladder_ctx_t *ladder_ctx, uint8_t instr, uint32_t network, uint32_t row, uint32_t column) {
+    ladder_ctx->ladder.last.instr = instr;
+    ladder_ctx->ladder.last.err = LADDER_INS_ERR_OK;
+    ladder_ctx->ladder.last.network = network;
+    ladder_ctx->ladder.last.cell_row = row;
+    ladder_ctx->ladder.last.cell_column = column;
+}
+
+static bool test_fixture_fault(ladder_ctx_t *ladder_ctx) {
+    ladder_ctx->ladder.state = LADDER_ST_INV;
+    return false;
+}
+
+static bool test_fixture_network_0(ladder_ctx_t *ladder_ctx) {
+    ladder_network_t *net = &ladder_ctx->network[0];
+    ladder_ctx->exec_network = net;
+    ladder_cell_t *const row0 = net->cells[0];
+    ladder_cell_t *const row1 = net->cells[1];
+    ladder_cell_t *const row2 = net->cells[2];
+    ladder_cell_t *const row3 = net->cells[3];
+    ladder_cell_t *const row4 = net->cells[4];
+    uint8_t *const M = ladder_ctx->memory.M;
+    int32_t *const D = ladder_ctx->registers.D;
+
+    row0[0].state = false;
+    row0[1].state = false;
+    row0[2].state = false;
+    row1[0].state = false;
+    row1[1].state = false;
+    row1[2].state = false;
+    row2[0].state = false;
+    row2[1].state = false;
+    row2[2].state = false;
+    row3[1].state = false;
+    row3[2].state = false;
+    row4[1].state = false;
+    bool p0 = M[0];
+    row0[0].state = p0;
+    bool p1 = p0 && !M[1];
+    row0[1].state = p1;
+    test_fixture_last(ladder_ctx, LADDER_INS_CONN, 0, 1, 1);
+    {
+        ladder_frame_t frame;
+        ladder_frame_cell(&frame, ladder_ctx, 1, 1);
+        if ((ladder_ctx->ladder.last.err = fn_CONN(&frame)) != LADDER_INS_ERR_OK)
+            return test_fixture_fault(ladder_ctx);
+    }
+    row2[1].state = false;
+    bool p2 = row0[1].state || row1[1].state || row3[1].state;
+    row0[1].state = p2;
+    row1[1].state = p2;
+    row2[1].state = p2;
+    row3[1].state = p2;
+    row0[2].state = p2;
+    M[2] = p2 ? 1 : 0;
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 0, 0, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_CONN, 0, 1, 1);
+    {
+        ladder_frame_t frame;
+        ladder_frame_cell(&frame, ladder_ctx, 1, 1);
+        if ((ladder_ctx->ladder.last.err = fn_CONN(&frame)) != LADDER_INS_ERR_OK)
+            return test_fixture_fault(ladder_ctx);
+    }
+    bool p3 = row2[0].state;
+    row2[1].state = p3;
+    if (p3) {
+        int32_t val = (int32_t) ((uint32_t) D[0] + (uint32_t) D[1]);
+        D[2] = val;
+    }
+    bool p4 = row1[1].state || p3 || row3[1].state;
+    row1[1].state = p4;
+    row2[1].state = p4;
+    row3[1].state = p4;
+    row1[2].state = p4;
+    M[4] = p4 ? 1 : 0;
+    test_fixture_last(ladder_ctx, LADDER_INS_CTU, 0, 2, 2);
+    {
+        ladder_frame_t frame;
+        ladder_frame_cell(&frame, ladder_ctx, 2, 2);
+        if ((ladder_ctx->ladder.last.err = fn_CTU(&frame)) != LADDER_INS_ERR_OK)
+            return test_fixture_fault(ladder_ctx);
+    }
+    bool p5 = row1[2].state || row2[2].state;
+    row1[2].state = p5;
+    row2[2].state = p5;
+    test_fixture_last(ladder_ctx, LADDER_INS_CTU, 0, 2, 2);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    bool p6 = M[5];
+    row2[0].state = p6;
+    row2[1].state = p6;
+    if (p6) {
+        int32_t val = (int32_t) ((uint32_t) D[0] + (uint32_t) D[1]);
+        D[2] = val;
+    }
+    bool p7 = p6 || row3[1].state;
+    row2[1].state = p7;
+    row3[1].state = p7;
+    test_fixture_last(ladder_ctx, LADDER_INS_CTU, 0, 2, 2);
+    {
+        ladder_frame_t frame;
+        ladder_frame_cell(&frame, ladder_ctx, 2, 2);
+        if ((ladder_ctx->ladder.last.err = fn_CTU(&frame)) != LADDER_INS_ERR_OK)
+            return test_fixture_fault(ladder_ctx);
+    }
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 0, 2, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 0, 3, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 0, 4, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    return true;
+}
+
+static bool test_fixture_network_1(ladder_ctx_t *ladder_ctx) {
+    ladder_network_t *net = &ladder_ctx->network[1];
+    ladder_ctx->exec_network = net;
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 1, 0, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 1, 1, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 1, 2, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 1, 3, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 1, 4, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    return true;
+}
+
+static bool test_fixture_network_2(ladder_ctx_t *ladder_ctx) {
+    ladder_network_t *net = &ladder_ctx->network[2];
+    ladder_ctx->exec_network = net;
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 2, 0, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 2, 1, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 2, 2, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 2, 3, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    test_fixture_last(ladder_ctx, LADDER_INS_NOP, 2, 4, 4);
+    if (ladder_ctx->on.scan_end != NULL)
+        ladder_ctx->on.scan_end(ladder_ctx);
+
+    return true;
+}
+
+static bool test_fixture_valid(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx->network == NULL)
+        return false;
+    if (ladder_ctx->ladder.quantity.networks != 3 || ladder_ctx->ladder.quantity.m != 18 || ladder_ctx->ladder.quantity.c != 8
+            || ladder_ctx->ladder.quantity.t != 8 || ladder_ctx->ladder.quantity.d != 8 || ladder_ctx->ladder.quantity.r != 8
+            || ladder_ctx->scan_internals.max_scan_cycles != 1000000ULL)
+        return false;
+    if (ladder_ctx->memory.M == NULL || ladder_ctx->memory.Cd == NULL || ladder_ctx->memory.Cr == NULL || ladder_ctx->memory.Td == NULL
+            || ladder_ctx->memory.Tr == NULL || ladder_ctx->registers.C == NULL || ladder_ctx->registers.D == NULL
+            || ladder_ctx->registers.R == NULL || ladder_ctx->timers == NULL || LADDER_HISTORY(ladder_ctx, M) == NULL)
+        return false;
+    for (uint32_t n = 0; n < test_fixture_NETWORKS; n++)
+        if (ladder_ctx->network[n].rows != test_fixture_networks[n].rows || ladder_ctx->network[n].cols != test_fixture_networks[n].cols)
+            return false;
+    if ((ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0) != 1
+            || (ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0) != 1)
+        return false;
+    if (ladder_ctx->input[0].i_qty != 0 || ladder_ctx->input[0].iw_qty != 0)
+        return false;
+    if (ladder_ctx->output[0].q_qty != 0 || ladder_ctx->output[0].qw_qty != 0)
+        return false;
+
+    return true;
+}
+
+void test_fixture_scan(ladder_ctx_t *ladder_ctx) {
+    // per instruction hook needs every cell visited, other contexts have other registers and I/O
+    if (ladder_ctx->on.instruction != NULL || !test_fixture_valid(ladder_ctx)) {
+        ladder_scan(ladder_ctx);
+        return;
+    }
+
+    if (!ladder_scan_begin(ladder_ctx))
+        return;
+
+    if (ladder_ctx->network[0].cells == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL)
+            ladder_ctx->on.panic(ladder_ctx);
+        return;
+    }
+    if (ladder_ctx->network[0].enable && !test_fixture_network_0(ladder_ctx))
+        return;
+    if (ladder_ctx->network[1].cells == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL)
+            ladder_ctx->on.panic(ladder_ctx);
+        return;
+    }
+    if (ladder_ctx->network[1].enable && !test_fixture_network_1(ladder_ctx))
+        return;
+    if (ladder_ctx->network[2].cells == NULL) {
+        ladder_ctx->ladder.state = LADDER_ST_ERROR;
+        if (ladder_ctx->on.panic != NULL)
+            ladder_ctx->on.panic(ladder_ctx);
+        return;
+    }
+    if (ladder_ctx->network[2].enable && !test_fixture_network_2(ladder_ctx))
+        return;
+}
+
+bool test_fixture_program(ladder_ctx_t *ladder_ctx) {
+    if (ladder_ctx == NULL || ladder_ctx->network == NULL || ladder_ctx->ladder.quantity.networks != test_fixture_NETWORKS)
+        return false;
+
+    ladder_clear_program(ladder_ctx);
+
+    for (uint32_t n = 0; n < test_fixture_NETWORKS; n++) {
+        const test_fixture_network_t *gnet = &test_fixture_networks[n];
+        ladder_network_t *net = &ladder_ctx->network[n];
+        net->enable = gnet->enable;
+        if (net->rows != gnet->rows || net->cols != gnet->cols || net->cells == NULL) {
+            ladder_network_free(net);
+            net->rows = 0;
+            net->cols = 0;
+            if (gnet->cells == NULL)
+                continue;
+            if (!ladder_network_alloc(net, gnet->rows, gnet->cols))
+                goto fail;
+        }
+
+        for (uint32_t r = 0; r < gnet->rows; r++) {
+            for (uint32_t c = 0; c < gnet->cols; c++) {
+                const test_fixture_cell_t *gcell = &gnet->cells[r * gnet->cols + c];
+                ladder_cell_t *cell = &net->cells[r][c];
+                cell->code = gcell->code;
+                cell->vertical_bar = gcell->vertical_bar;
+                cell->state = false;
+                if (gcell->data_qty == 0)
+                    continue;
+                cell->data = calloc(gcell->data_qty, sizeof(ladder_value_t));
+                if (cell->data == NULL)
+                    goto fail;
+                for (uint32_t d = 0; d < gcell->data_qty; d++) {
+                    cell->data[d] = test_fixture_data[gcell->data + d];
+                    cell->data_qty = d + 1;
+                    if (cell->data[d].type == LADDER_REGISTER_S && cell->data[d].value.cstr != NULL
+                            && (cell->data[d].value.cstr = strdup(cell->data[d].value.cstr)) == NULL)
+                        goto fail;
+                }
+            }
+        }
+    }
+
+    // networks were reallocated: drop any compiled form and pack cells data
+    if (!ladder_program_compact(ladder_ctx))
+        goto fail;
+
+    return ladder_set_generated(ladder_ctx, test_fixture_scan) && ladder_set_engine(ladder_ctx, LADDER_ENGINE_GENERATED);
+
+    fail:
+    ladder_clear_program(ladder_ctx);
+    return false;
+}
@@ -39,13 +39,14 @@
 
 #include "ladder.h"
 #include "ladder_internals.h"
+#include "ladder_topology.h"
 #include "ladder_print.h"
 #include "ladder_instructions.h"
 
 #define PIN_OUT(lctx,n,r,c) \
-                        (LADDER_VERTICAL_BAR(&lctx,n,r,c) || ((r > lctx.network[n].rows - 2) ? 0 : LADDER_VERTICAL_BAR(&lctx,n,r + 1,c)) ? "-+" : "--")
+                        (LADDER_VERTICAL_BAR(lctx,n,r,c) || ((r > lctx->network[n].rows - 2) ? 0 : LADDER_VERTICAL_BAR(lctx,n,r + 1,c)) ? "-+" : "--")
 
-#define SPACE_BAR(lctx,n,r,c)  (((r > lctx.network[n].rows - 2) ? 0 : LADDER_VERTICAL_BAR(&lctx,n,r + 1,c)) ? "|" : " ")
+#define SPACE_BAR(lctx,n,r,c)  (((r > lctx->network[n].rows - 2) ? 0 : LADDER_VERTICAL_BAR(lctx,n,r + 1,c)) ? "|" : " ")
 
 static const char *fn_symbol[] = { //
         "   ", // 1
@@ -142,18 +143,18 @@ static char* ftos(float f, char *str, size_t n, int decimals) {
 
 static const char *basetime_graph[] = { "ms   ", "10ms ", "100ms", "seg  ", "min  " };
 
-static void fn_to_str(ladder_ctx_t ladder_ctx, uint32_t net, char (*cells)[6][32], uint32_t row, uint32_t column) {
+static void fn_to_str(const ladder_ctx_t *ladder_ctx, uint32_t net, char (*cells)[6][32], uint32_t row, uint32_t column) {
     char strtmp[13];
 
     memset(cells, 0, 6 * 32 * sizeof(char));
 
-    if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_NOP) {
-        snprintf((*cells)[0], sizeof((*cells)[0]), "                  %s", (LADDER_VERTICAL_BAR(&ladder_ctx, net, row, column) ? "+" : " "));
+    if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_NOP) {
+        snprintf((*cells)[0], sizeof((*cells)[0]), "                  %s", (LADDER_VERTICAL_BAR(ladder_ctx, net, row, column) ? "+" : " "));
         snprintf((*cells)[1], sizeof((*cells)[0]), "                   ");
         return;
     }
 
-    if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_MULTI) {
+    if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_MULTI) {
         printf("MULTI\n");
         snprintf((*cells)[0], sizeof((*cells)[0]), "---+-ERR MULTI--+--");
         snprintf((*cells)[1], sizeof((*cells)[0]), "---++++++++++++++--");
@@ -162,128 +163,137 @@ static void fn_to_str(ladder_ctx_t ladder_ctx, uint32_t net, char (*cells)[6][32
 
     ladder_instructions_iocd_t actual_ioc;
 
-    if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_FOREIGN) {
-        memcpy(&actual_ioc, &(ladder_ctx.foreign.fn[ladder_ctx.network[net].cells[row][column].data[0].value.u32]).description,
+    if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_FOREIGN) {
+        memcpy(&actual_ioc, &(ladder_ctx->foreign.fn[ladder_ctx->network[net].cells[row][column].data[0].value.u32]).description,
                 sizeof(ladder_instructions_iocd_t));
 
         snprintf((*cells)[0], sizeof((*cells)[0]), "---+-%s--------+%s",
-                ladder_ctx.network[net].cells[row][column].data[0].value.u32 >= ladder_ctx.foreign.qty ? "FN?" :
-                strlen(ladder_ctx.foreign.fn[ladder_ctx.network[net].cells[row][column].data[0].value.i32].name) == 0 ?
-                        "FN?" : ladder_ctx.foreign.fn[ladder_ctx.network[net].cells[row][column].data[0].value.u32].name,
+                ladder_ctx->network[net].cells[row][column].data[0].value.u32 >= ladder_ctx->foreign.qty ? "FN?" :
+                strlen(ladder_ctx->foreign.fn[ladder_ctx->network[net].cells[row][column].data[0].value.i32].name) == 0 ?
+                        "FN?" : ladder_ctx->foreign.fn[ladder_ctx->network[net].cells[row][column].data[0].value.u32].name,
                 PIN_OUT(ladder_ctx, net, row, column));
+    } else if (ladder_ctx->network[net].cells[row][column].code >= LADDER_INS_INV) {
+        const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, ladder_ctx->network[net].cells[row][column].code);
+        if (custom == NULL) {
+            snprintf((*cells)[0], sizeof((*cells)[0]), "---+-ERR CODE---+--");
+            snprintf((*cells)[1], sizeof((*cells)[0]), "---++++++++++++++--");
+            return;
+        }
+        memcpy(&actual_ioc, &custom->description, sizeof(ladder_instructions_iocd_t));
+        snprintf((*cells)[0], sizeof((*cells)[0]), "---+-%-6.6s-----+%s", custom->name, PIN_OUT(ladder_ctx, net, row, column));
     } else {
-        memcpy(&actual_ioc, &(ladder_fn_iocd[ladder_ctx.network[net].cells[row][column].code]), sizeof(ladder_instructions_iocd_t));
+        memcpy(&actual_ioc, &(ladder_fn_iocd[ladder_ctx->network[net].cells[row][column].code]), sizeof(ladder_instructions_iocd_t));
         if (actual_ioc.cells != 1) {
-            snprintf((*cells)[0], sizeof((*cells)[0]), "---+-%s--------+%s", fn_symbol[ladder_ctx.network[net].cells[row][column].code],
+            snprintf((*cells)[0], sizeof((*cells)[0]), "---+-%s--------+%s", fn_symbol[ladder_ctx->network[net].cells[row][column].code],
                     PIN_OUT(ladder_ctx, net, row, column));
         } else {
-            snprintf((*cells)[0], sizeof((*cells)[0]), "--------%s------%s", fn_symbol[ladder_ctx.network[net].cells[row][column].code],
+            snprintf((*cells)[0], sizeof((*cells)[0]), "--------%s------%s", fn_symbol[ladder_ctx->network[net].cells[row][column].code],
                     PIN_OUT(ladder_ctx, net, row, column));
         }
     }
 
-    if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_FOREIGN
-            && ladder_ctx.network[net].cells[row][column].data[0].value.u32 >= ladder_ctx.foreign.qty)
+    if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_FOREIGN
+            && ladder_ctx->network[net].cells[row][column].data[0].value.u32 >= ladder_ctx->foreign.qty)
         return;
 
     switch (actual_ioc.cells) {
         case 1:
             memset(strtmp, 0, sizeof(strtmp));
 
-            if (ladder_ctx.network[net].cells[row][column].data_qty > 0) {
-                switch (ladder_ctx.network[net].cells[row][column].data[0].type) {
+            if (ladder_ctx->network[net].cells[row][column].data_qty > 0) {
+                switch (ladder_ctx->network[net].cells[row][column].data[0].type) {
                     case LADDER_REGISTER_S:
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "     %.10s   %s", ladder_ctx.network[net].cells[row][column].data[0].value.cstr,
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "     %.10s   %s", ladder_ctx->network[net].cells[row][column].data[0].value.cstr,
                                 SPACE_BAR(ladder_ctx, net, row, column));
                         break;
                     case LADDER_REGISTER_I:
                     case LADDER_REGISTER_Q:
                     case LADDER_REGISTER_R:
-                        if (ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
-                                || ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
-                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[0].value.mp.module,
-                                    ladder_ctx.network[net].cells[row][column].data[0].value.mp.port);
-                        else ftos(ladder_ctx.network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                        if (ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
+                                || ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
+                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[0].value.mp.module,
+                                    ladder_ctx->network[net].cells[row][column].data[0].value.mp.port);
+                        else ftos(ladder_ctx->network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
                         if (strlen(strtmp) < 4)
                             strtmp[3] = ' ';
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "     %s %s      %s", dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "     %s %s      %s", dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
                                 strtmp, SPACE_BAR(ladder_ctx, net, row, column));
                         break;
                     default:
-                        if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_CONN)
+                        if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_CONN)
                             snprintf((*cells)[1], sizeof((*cells)[0]), "                  %s", SPACE_BAR(ladder_ctx, net, row, column));
                         else snprintf((*cells)[1], sizeof((*cells)[0]), "     %s %04d      %s",
-                                dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
-                                (uint32_t) ladder_ctx.network[net].cells[row][column].data[0].value.u32, SPACE_BAR(ladder_ctx, net, row, column));
+                                dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
+                                (uint32_t) ladder_ctx->network[net].cells[row][column].data[0].value.u32, SPACE_BAR(ladder_ctx, net, row, column));
                 }
             } else snprintf((*cells)[1], sizeof((*cells)[0]), "                  %s", SPACE_BAR(ladder_ctx, net, row, column));
 
             break;
         case 2:
             memset(strtmp, 0, sizeof(strtmp));
-            if (row > ladder_ctx.network[net].rows - 1)
+            if (row > ladder_ctx->network[net].rows - 1)
                 break;
-            if (ladder_ctx.network[net].cells[row][column].data_qty > 0) {
-                switch (ladder_ctx.network[net].cells[row][column].data[0].type) {
+            if (ladder_ctx->network[net].cells[row][column].data_qty > 0) {
+                switch (ladder_ctx->network[net].cells[row][column].data[0].type) {
                     case LADDER_REGISTER_S:
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx.network[net].cells[row][column].data[0].value.cstr);
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx->network[net].cells[row][column].data[0].value.cstr);
                         break;
                     case LADDER_REGISTER_I:
                     case LADDER_REGISTER_Q:
                     case LADDER_REGISTER_R:
-                        if (ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
-                                || ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
-                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[0].value.mp.module,
-                                    ladder_ctx.network[net].cells[row][column].data[0].value.mp.port);
-                        else ftos(ladder_ctx.network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                        if (ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
+                                || ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
+                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[0].value.mp.module,
+                                    ladder_ctx->network[net].cells[row][column].data[0].value.mp.port);
+                        else ftos(ladder_ctx->network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %s    |  ", dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %s    |  ", dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
                                 strtmp);
                         break;
                     default:
-                        if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_CONN)
+                        if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_CONN)
                             snprintf((*cells)[1], sizeof((*cells)[0]), "                   ");
                         else snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %04d    |  ",
-                                dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
-                                (uint32_t) ladder_ctx.network[net].cells[row][column].data[0].value.u32);
+                                dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
+                                (uint32_t) ladder_ctx->network[net].cells[row][column].data[0].value.u32);
                 }
 
                 memset(strtmp, 0, sizeof(strtmp));
-                if (ladder_ctx.network[net].cells[row][column].code == LADDER_INS_TON || ladder_ctx.network[net].cells[row][column].code == LADDER_INS_TOF
-                        || ladder_ctx.network[net].cells[row][column].code == LADDER_INS_TP) {
+                if (ladder_ctx->network[net].cells[row][column].code == LADDER_INS_TON || ladder_ctx->network[net].cells[row][column].code == LADDER_INS_TOF
+                        || ladder_ctx->network[net].cells[row][column].code == LADDER_INS_TP) {
                     const char *bt_str =
-                            ((int) ladder_ctx.network[net].cells[row][column].data[1].type >= (int) LADDER_BASETIME_MS
-                                    && (int) ladder_ctx.network[net].cells[row][column].data[1].type <= (int) LADDER_BASETIME_MIN) ?
-                                    basetime_graph[ladder_ctx.network[net].cells[row][column].data[1].type] : "INV   ";
+                            ((int) ladder_ctx->network[net].cells[row][column].data[1].type >= (int) LADDER_BASETIME_MS
+                                    && (int) ladder_ctx->network[net].cells[row][column].data[1].type <= (int) LADDER_BASETIME_MIN) ?
+                                    basetime_graph[ladder_ctx->network[net].cells[row][column].data[1].type] : "INV   ";
 
                     snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %04d %s |%s", actual_ioc.inputs == 1 ? "   " : "---",
-                            (int) ladder_ctx.network[net].cells[row][column].data[1].value.i32, bt_str,
+                            (int) ladder_ctx->network[net].cells[row][column].data[1].value.i32, bt_str,
                             actual_ioc.outputs == 1 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                 } else {
-                    switch (ladder_ctx.network[net].cells[row][column].data[1].type) {
+                    switch (ladder_ctx->network[net].cells[row][column].data[1].type) {
                         case LADDER_REGISTER_S:
                             snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %.10s |%s", actual_ioc.inputs == 1 ? "   " : "---",
-                                    ladder_ctx.network[net].cells[row][column].data[1].value.cstr,
+                                    ladder_ctx->network[net].cells[row][column].data[1].value.cstr,
                                     actual_ioc.outputs == 1 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                             break;
                         case LADDER_REGISTER_I:
                         case LADDER_REGISTER_Q:
                         case LADDER_REGISTER_R:
-                            if (ladder_ctx.network[net].cells[row][column].data[1].type == LADDER_REGISTER_I
-                                    || ladder_ctx.network[net].cells[row][column].data[1].type == LADDER_REGISTER_Q)
-                                snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[1].value.mp.module,
-                                        ladder_ctx.network[net].cells[row][column].data[1].value.mp.port);
-                            else ftos(ladder_ctx.network[net].cells[row][column].data[1].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                            if (ladder_ctx->network[net].cells[row][column].data[1].type == LADDER_REGISTER_I
+                                    || ladder_ctx->network[net].cells[row][column].data[1].type == LADDER_REGISTER_Q)
+                                snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[1].value.mp.module,
+                                        ladder_ctx->network[net].cells[row][column].data[1].value.mp.port);
+                            else ftos(ladder_ctx->network[net].cells[row][column].data[1].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
                             snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %s %s    |%s", actual_ioc.inputs == 1 ? "   " : "---",
-                                    dt_graph[ladder_ctx.network[net].cells[row][column].data[1].type], strtmp,
+                                    dt_graph[ladder_ctx->network[net].cells[row][column].data[1].type], strtmp,
                                     actual_ioc.outputs == 1 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                             break;
                         default:
                             snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %s %04d    |%s", actual_ioc.inputs == 1 ? "   " : "---",
-                                    dt_graph[ladder_ctx.network[net].cells[row][column].data[1].type],
-                                    (uint32_t) ladder_ctx.network[net].cells[row][column].data[1].value.u32,
+                                    dt_graph[ladder_ctx->network[net].cells[row][column].data[1].type],
+                                    (uint32_t) ladder_ctx->network[net].cells[row][column].data[1].value.u32,
                                     actual_ioc.outputs == 1 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                     }
                 }
@@ -296,76 +306,76 @@ static void fn_to_str(ladder_ctx_t ladder_ctx, uint32_t net, char (*cells)[6][32
             break;
         case 3:
             memset(strtmp, 0, sizeof(strtmp));
-            if (row > ladder_ctx.network[net].rows - 3)
+            if (row > ladder_ctx->network[net].rows - 3)
                 break;
-            if (ladder_ctx.network[net].cells[row][column].data_qty > 0) {
-                switch (ladder_ctx.network[net].cells[row][column].data[0].type) {
+            if (ladder_ctx->network[net].cells[row][column].data_qty > 0) {
+                switch (ladder_ctx->network[net].cells[row][column].data[0].type) {
                     case LADDER_REGISTER_S:
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx.network[net].cells[row][column].data[0].value.cstr);
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx->network[net].cells[row][column].data[0].value.cstr);
                         break;
                     case LADDER_REGISTER_I:
                     case LADDER_REGISTER_Q:
                     case LADDER_REGISTER_R:
-                        if (ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
-                                || ladder_ctx.network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
-                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[0].value.mp.module,
-                                    ladder_ctx.network[net].cells[row][column].data[0].value.mp.port);
-                        else ftos(ladder_ctx.network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                        if (ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_I
+                                || ladder_ctx->network[net].cells[row][column].data[0].type == LADDER_REGISTER_Q)
+                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[0].value.mp.module,
+                                    ladder_ctx->network[net].cells[row][column].data[0].value.mp.port);
+                        else ftos(ladder_ctx->network[net].cells[row][column].data[0].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %s    |  ", dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %s    |  ", dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
                                 strtmp);
                         break;
                     default:
-                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %04d    |  ", dt_graph[ladder_ctx.network[net].cells[row][column].data[0].type],
-                                (uint32_t) ladder_ctx.network[net].cells[row][column].data[0].value.u32);
+                        snprintf((*cells)[1], sizeof((*cells)[0]), "   | %s %04d    |  ", dt_graph[ladder_ctx->network[net].cells[row][column].data[0].type],
+                                (uint32_t) ladder_ctx->network[net].cells[row][column].data[0].value.u32);
                 }
 
                 memset(strtmp, 0, sizeof(strtmp));
-                switch (ladder_ctx.network[net].cells[row][column].data[1].type) {
+                switch (ladder_ctx->network[net].cells[row][column].data[1].type) {
                     case LADDER_REGISTER_S:
                         snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %.10s |%s", actual_ioc.inputs < 2 ? "   " : "---",
-                                ladder_ctx.network[net].cells[row][column].data[1].value.cstr,
+                                ladder_ctx->network[net].cells[row][column].data[1].value.cstr,
                                 actual_ioc.outputs < 2 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                         break;
                     case LADDER_REGISTER_I:
                     case LADDER_REGISTER_Q:
                     case LADDER_REGISTER_R:
-                        if (ladder_ctx.network[net].cells[row][column].data[1].type == LADDER_REGISTER_I
-                                || ladder_ctx.network[net].cells[row][column].data[1].type == LADDER_REGISTER_Q)
-                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[1].value.mp.module,
-                                    ladder_ctx.network[net].cells[row][column].data[1].value.mp.port);
-                        else ftos(ladder_ctx.network[net].cells[row][column].data[1].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                        if (ladder_ctx->network[net].cells[row][column].data[1].type == LADDER_REGISTER_I
+                                || ladder_ctx->network[net].cells[row][column].data[1].type == LADDER_REGISTER_Q)
+                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[1].value.mp.module,
+                                    ladder_ctx->network[net].cells[row][column].data[1].value.mp.port);
+                        else ftos(ladder_ctx->network[net].cells[row][column].data[1].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
                         snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %s %s    |%s", actual_ioc.inputs < 2 ? "   " : "---",
-                                dt_graph[ladder_ctx.network[net].cells[row][column].data[1].type], strtmp,
+                                dt_graph[ladder_ctx->network[net].cells[row][column].data[1].type], strtmp,
                                 actual_ioc.outputs < 2 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                         break;
                     default:
                         snprintf((*cells)[2], sizeof((*cells)[0]), "%s| %s %04d    |%s", actual_ioc.inputs < 2 ? "   " : "---",
-                                dt_graph[ladder_ctx.network[net].cells[row][column].data[1].type],
-                                (uint32_t) ladder_ctx.network[net].cells[row][column].data[1].value.u32,
+                                dt_graph[ladder_ctx->network[net].cells[row][column].data[1].type],
+                                (uint32_t) ladder_ctx->network[net].cells[row][column].data[1].value.u32,
                                 actual_ioc.outputs < 2 ? "  " : PIN_OUT(ladder_ctx, net, row, column));
                 }
 
                 memset(strtmp, 0, sizeof(strtmp));
-                switch (ladder_ctx.network[net].cells[row][column].data[2].type) {
+                switch (ladder_ctx->network[net].cells[row][column].data[2].type) {
                     case LADDER_REGISTER_S:
-                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx.network[net].cells[row][column].data[2].value.cstr);
+                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %.10s |  ", ladder_ctx->network[net].cells[row][column].data[2].value.cstr);
                         break;
                     case LADDER_REGISTER_I:
                     case LADDER_REGISTER_Q:
                     case LADDER_REGISTER_R:
-                        if (ladder_ctx.network[net].cells[row][column].data[2].type == LADDER_REGISTER_I
-                                || ladder_ctx.network[net].cells[row][column].data[2].type == LADDER_REGISTER_Q)
-                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx.network[net].cells[row][column].data[2].value.mp.module,
-                                    ladder_ctx.network[net].cells[row][column].data[2].value.mp.port);
-                        else ftos(ladder_ctx.network[net].cells[row][column].data[2].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
+                        if (ladder_ctx->network[net].cells[row][column].data[2].type == LADDER_REGISTER_I
+                                || ladder_ctx->network[net].cells[row][column].data[2].type == LADDER_REGISTER_Q)
+                            snprintf(strtmp, sizeof(strtmp), "%d.%d", ladder_ctx->network[net].cells[row][column].data[2].value.mp.module,
+                                    ladder_ctx->network[net].cells[row][column].data[2].value.mp.port);
+                        else ftos(ladder_ctx->network[net].cells[row][column].data[2].value.real, strtmp, 12, 2); // Modified: Increased n from 8 to 12.
 
-                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %s %s |  ", dt_graph[ladder_ctx.network[net].cells[row][column].data[2].type], strtmp);
+                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %s %s |  ", dt_graph[ladder_ctx->network[net].cells[row][column].data[2].type], strtmp);
                         break;
                     default:
-                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %s %04d    |  ", dt_graph[ladder_ctx.network[net].cells[row][column].data[2].type],
-                                (uint32_t) ladder_ctx.network[net].cells[row][column].data[2].value.u32);
+                        snprintf((*cells)[3], sizeof((*cells)[0]), "   | %s %04d    |  ", dt_graph[ladder_ctx->network[net].cells[row][column].data[2].type],
+                                (uint32_t) ladder_ctx->network[net].cells[row][column].data[2].value.u32);
                 }
             } else {
                 snprintf((*cells)[1], sizeof((*cells)[0]), "                   ");
@@ -383,13 +393,13 @@ static void fn_to_str(ladder_ctx_t ladder_ctx, uint32_t net, char (*cells)[6][32
     }
 }
 
-void ladder_print(ladder_ctx_t ladder_ctx) {
+void ladder_print_ctx(const ladder_ctx_t *ladder_ctx) {
     char fn_str[6][32];
     char (*fn_str_ptr)[6][32] = &fn_str;
 
-    for (uint32_t n = 0; n < ladder_ctx.ladder.quantity.networks; n++) {
-        uint32_t rows = ladder_ctx.network[n].rows;
-        uint32_t cols = ladder_ctx.network[n].cols;
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        uint32_t rows = ladder_ctx->network[n].rows;
+        uint32_t cols = ladder_ctx->network[n].cols;
 
         if (rows > LADDER_MAX_ROWS || cols > LADDER_MAX_COLS) {
             printf("Error: Network %d dimensions (%u rows, %u cols) exceed maximum limits (%d rows, %d cols). Skipping print.\n", (int) n, rows, cols,
@@ -397,6 +407,17 @@ void ladder_print(ladder_ctx_t ladder_ctx) {
             continue;
         }
 
+        // trailing columns of empty cells are not printed
+        uint32_t net_cols = cols;
+        while (cols > 1) {
+            uint32_t r = 0;
+            while (r < rows && ladder_topology_empty(&ladder_ctx->network[n].cells[r][cols - 1]))
+                r++;
+            if (r < rows)
+                break;
+            cols--;
+        }
+
         size_t total_size = (rows + 3) * (cols + 3) * 2 * 32 * sizeof(char);
         char *network_str_raw = calloc(1, total_size);
         if (!network_str_raw) {
@@ -406,7 +427,10 @@ void ladder_print(ladder_ctx_t ladder_ctx) {
 
 #define NET_STR(r, c, l, o) network_str_raw[((( (r) * (cols + 3) + (c) ) * 2 + (l) ) * 32) + (o)]
 
-        printf("[Network %d (%s)]\n\n", (int) n, ladder_ctx.network[n].enable ? "enabled" : "disabled");
+        if (cols < net_cols)
+            printf("[Network %d (%s), columns %u to %u empty]\n\n", (int) n, ladder_ctx->network[n].enable ? "enabled" : "disabled", cols, net_cols - 1);
+        else
+            printf("[Network %d (%s)]\n\n", (int) n, ladder_ctx->network[n].enable ? "enabled" : "disabled");
 
         for (uint32_t r = 0; r < rows; r++) {
             for (uint32_t c = 0; c < cols; c++) {
@@ -444,3 +468,7 @@ void ladder_print(ladder_ctx_t ladder_ctx) {
 #undef NET_STR
     }
 }
+
+void ladder_print(ladder_ctx_t ladder_ctx) {
+    ladder_print_ctx(&ladder_ctx);
+}
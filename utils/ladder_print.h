@@ -39,11 +39,19 @@
 #include "ladder.h"
 
 /**
- * @fn void ladder_print(ladder_ctx_t *ladder_ctx)
+ * @fn void ladder_print_ctx(const ladder_ctx_t *ladder_ctx)
  * @brief Print networks in ascii graphical format
  *
  * @param ladder_ctx Ladder context
  */
+void ladder_print_ctx(const ladder_ctx_t *ladder_ctx);
+
+/**
+ * @fn void ladder_print(ladder_ctx_t ladder_ctx)
+ * @brief Print networks in ascii graphical format. Takes the context by value, ladder_print_ctx avoids the copy.
+ *
+ * @param ladder_ctx Ladder context
+ */
 void ladder_print(ladder_ctx_t ladder_ctx);
 
 #endif /* INCLUDE_LADDER_UTILS_H_ */
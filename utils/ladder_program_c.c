@@ -0,0 +1,1122 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+
+#include "ladder.h"
+#include "ladder_internals.h"
+#include "ladder_compile.h"
+#include "ladder_program_c.h"
+
+#ifdef OPTIONAL_COMPILED
+
+static const char *str_ins[] = { "NOP", "CONN", "NEG", "NO", "NC", "RE", "FE", "COIL", "COILL", "COILU", "TON", "TOF", "TP", "CTU", "CTD", "MOVE",
+        "SUB", "ADD", "MUL", "DIV", "MOD", "SHL", "SHR", "ROL", "ROR", "AND", "OR", "XOR", "NOT", "EQ", "GT", "GE", "LT", "LE", "NE", "FOREIGN", "TMOVE" };
+
+static const char *str_register[] = { "NONE", "M", "Q", "I", "Cd", "Cr", "Td", "Tr", "IW", "QW", "C", "T", "D", "S", "R" };
+
+static const char *str_basetime[] = { "MS", "10MS", "100MS", "SEC", "MIN" };
+
+/**
+ * @enum LADDER_C_BANK
+ * @brief Register banks referenced by generated code (local pointers of the network functions)
+ *
+ */
+typedef enum LADDER_C_BANK {
+    LADDER_C_M,   /**< memory.M */
+    LADDER_C_CD,  /**< memory.Cd */
+    LADDER_C_CR,  /**< memory.Cr */
+    LADDER_C_TD,  /**< memory.Td */
+    LADDER_C_TR,  /**< memory.Tr */
+    LADDER_C_C,   /**< registers.C */
+    LADDER_C_D,   /**< registers.D */
+    LADDER_C_R,   /**< registers.R */
+    LADDER_C_T,   /**< timers */
+    LADDER_C_MH,  /**< M history (LADDER_HISTORY) */
+    LADDER_C_QTY, /**< Banks quantity */
+} ladder_c_bank_t;
+
+/**
+ * @enum LADDER_C_PORT
+ * @brief I/O module arrays referenced by generated code (bit flags)
+ *
+ */
+typedef enum LADDER_C_PORT {
+    LADDER_C_PORT_VAL  = 0x01, /**< I or Q */
+    LADDER_C_PORT_WORD = 0x02, /**< IW or QW */
+    LADDER_C_PORT_PREV = 0x04, /**< Ih or Qh */
+} ladder_c_port_t;
+
+static const char *str_bank[] = { "M", "Cd", "Cr", "Td", "Tr", "C", "D", "R", "T", "Mh" };
+
+static const char *str_bank_decl[] = { //
+        "uint8_t *const M = ladder_ctx->memory.M",                   //
+        "bool *const Cd = ladder_ctx->memory.Cd",                    //
+        "bool *const Cr = ladder_ctx->memory.Cr",                    //
+        "bool *const Td = ladder_ctx->memory.Td",                    //
+        "bool *const Tr = ladder_ctx->memory.Tr",                    //
+        "uint32_t *const C = ladder_ctx->registers.C",               //
+        "int32_t *const D = ladder_ctx->registers.D",                //
+        "float *const R = ladder_ctx->registers.R",                  //
+        "ladder_timer_t *const T = ladder_ctx->timers",              //
+        "const void *const Mh = LADDER_HISTORY(ladder_ctx, M)",      //
+        };
+
+/**
+ * @enum LADDER_C_POWER
+ * @brief Cell power known while generating a network
+ *
+ */
+typedef enum LADDER_C_POWER {
+    LADDER_C_MEM,   /**< Only known by the cell state */
+    LADDER_C_FALSE, /**< Without power */
+    LADDER_C_TRUE,  /**< With power */
+    LADDER_C_LOCAL, /**< Held by a local variable */
+} ladder_c_power_t;
+
+/**
+ * @struct ladder_c_value_s
+ * @brief Cell power. The cell state always holds the same value.
+ *
+ */
+typedef struct ladder_c_value_s {
+     uint8_t power;  /**< Power (ladder_c_power_t) */
+     uint8_t row;    /**< Row (LADDER_C_MEM) */
+    uint32_t column; /**< Column (LADDER_C_MEM) */
+    uint32_t local;  /**< Local variable (LADDER_C_LOCAL) */
+} ladder_c_value_t;
+
+/**
+ * @struct ladder_c_buf_s
+ * @brief Growing text. Network bodies are generated before the declarations they need.
+ *
+ */
+typedef struct ladder_c_buf_s {
+    char *data; /**< Text */
+  size_t len;   /**< Length */
+  size_t size;  /**< Allocated size */
+    bool fail;  /**< Allocation failed */
+} ladder_c_buf_t;
+
+/**
+ * @struct ladder_c_gen_s
+ * @brief Generator state
+ *
+ */
+typedef struct ladder_c_gen_s {
+        ladder_ctx_t *ladder_ctx;                 /**< Ladder context */
+          const char *prefix;                     /**< Prefix of generated functions */
+      ladder_c_buf_t body;                        /**< Network body */
+            uint32_t network;                     /**< Network */
+            uint32_t cols;                        /**< Network columns */
+    ladder_c_value_t *cell;                       /**< Cells power (rows * cols) */
+            uint32_t locals;                      /**< Local variables */
+                bool row_used[LADDER_MAX_ROWS];   /**< Rows referenced by the network */
+                bool bank_used[LADDER_C_QTY];     /**< Banks referenced by the network */
+             uint8_t *input_used;                 /**< Input module arrays referenced by the network (ladder_c_port_t) */
+             uint8_t *output_used;                /**< Output module arrays referenced by the network (ladder_c_port_t) */
+             uint8_t *input_all;                  /**< Input module arrays referenced by the program */
+             uint8_t *output_all;                 /**< Output module arrays referenced by the program */
+            uint32_t custom_all;                  /**< Custom instructions called by the program (bit n: LADDER_INS_CUSTOM + n) */
+} ladder_c_gen_t;
+
+static void ladder_c_printf(ladder_c_buf_t *buf, const char *fmt, ...) {
+    if (buf->fail)
+        return;
+
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+    if (n < 0) {
+        buf->fail = true;
+        return;
+    }
+
+    if (buf->len + n + 1 > buf->size) {
+        size_t new_size = buf->size == 0 ? 4096 : buf->size;
+        while (buf->len + n + 1 > new_size)
+            new_size *= 2;
+        char *tmp = realloc(buf->data, new_size);
+        if (tmp == NULL) {
+            buf->fail = true;
+            return;
+        }
+        buf->data = tmp;
+        buf->size = new_size;
+    }
+
+    va_start(ap, fmt);
+    vsnprintf(buf->data + buf->len, buf->size - buf->len, fmt, ap);
+    va_end(ap);
+    buf->len += n;
+}
+
+// Integer literal (INT32_MIN has no literal form)
+static void ladder_c_int(char *out, size_t size, int32_t value) {
+    if (value == INT32_MIN)
+        snprintf(out, size, "(-2147483647 - 1)");
+    else if (value < 0)
+        snprintf(out, size, "(%d)", (int) value);
+    else
+        snprintf(out, size, "%d", (int) value);
+}
+
+static void ladder_c_ins(char *out, size_t size, uint32_t code) {
+    if (code < LADDER_INS_INV)
+        snprintf(out, size, "LADDER_INS_%s", str_ins[code]);
+    else if (code == LADDER_INS_INV)
+        snprintf(out, size, "LADDER_INS_INV");
+    else if (code == LADDER_INS_MULTI)
+        snprintf(out, size, "LADDER_INS_MULTI");
+    else
+        snprintf(out, size, "%u", (unsigned) code);
+}
+
+static bool ladder_c_index(const void *ptr, const void *base, size_t elem, uint32_t qty, uint32_t *idx) {
+    uintptr_t p = (uintptr_t) ptr, b = (uintptr_t) base;
+    if (base == NULL || p < b || p >= b + elem * qty || (p - b) % elem != 0)
+        return false;
+
+    *idx = (uint32_t) ((p - b) / elem);
+    return true;
+}
+
+// Register of a bound operand as an lvalue on the network locals (I0[2], D[5], T[1].acc ...). Marks the bank as used.
+static bool ladder_c_lvalue(ladder_c_gen_t *gen, const ladder_operand_t *operand, bool prev, char *out, size_t size) {
+    ladder_ctx_t *ladder_ctx = gen->ladder_ctx;
+    uint32_t idx;
+
+    switch (operand->kind) {
+        case LADDER_OPERAND_U8:
+            if (ladder_c_index(operand->ptr, ladder_ctx->memory.M, sizeof(uint8_t), ladder_ctx->ladder.quantity.m, &idx)) {
+                gen->bank_used[prev ? LADDER_C_MH : LADDER_C_M] = true;
+                snprintf(out, size, prev ? "ladder_history_get(Mh, %u)" : "M[%u]", (unsigned) idx);
+                return true;
+            }
+            for (uint32_t m = 0; ladder_ctx->input != NULL && m < ladder_ctx->hw.io.fn_read_qty; m++)
+                if (ladder_c_index(operand->ptr, ladder_ctx->input[m].I, sizeof(uint8_t), ladder_ctx->input[m].i_qty, &idx)) {
+                    gen->input_used[m] |= prev ? LADDER_C_PORT_PREV : LADDER_C_PORT_VAL;
+                    snprintf(out, size, prev ? "Ih%u[%u]" : "I%u[%u]", (unsigned) m, (unsigned) idx);
+                    return true;
+                }
+            for (uint32_t m = 0; ladder_ctx->output != NULL && m < ladder_ctx->hw.io.fn_write_qty; m++)
+                if (ladder_c_index(operand->ptr, ladder_ctx->output[m].Q, sizeof(uint8_t), ladder_ctx->output[m].q_qty, &idx)) {
+                    gen->output_used[m] |= prev ? LADDER_C_PORT_PREV : LADDER_C_PORT_VAL;
+                    snprintf(out, size, prev ? "Qh%u[%u]" : "Q%u[%u]", (unsigned) m, (unsigned) idx);
+                    return true;
+                }
+            return false;
+        case LADDER_OPERAND_BOOL: {
+            const struct {
+                const bool *bank;
+                uint32_t qty;
+                ladder_c_bank_t id;
+            } banks[] = { //
+                    { ladder_ctx->memory.Cd, ladder_ctx->ladder.quantity.c, LADDER_C_CD }, //
+                    { ladder_ctx->memory.Cr, ladder_ctx->ladder.quantity.c, LADDER_C_CR }, //
+                    { ladder_ctx->memory.Td, ladder_ctx->ladder.quantity.t, LADDER_C_TD }, //
+                    { ladder_ctx->memory.Tr, ladder_ctx->ladder.quantity.t, LADDER_C_TR }, //
+                    };
+            for (uint32_t b = 0; b < sizeof(banks) / sizeof(banks[0]); b++)
+                if (ladder_c_index(operand->ptr, banks[b].bank, sizeof(bool), banks[b].qty, &idx)) {
+                    gen->bank_used[banks[b].id] = true;
+                    snprintf(out, size, "%s[%u]", str_bank[banks[b].id], (unsigned) idx);
+                    return true;
+                }
+            return false;
+        }
+        case LADDER_OPERAND_U32:
+            if (!ladder_c_index(operand->ptr, ladder_ctx->registers.C, sizeof(uint32_t), ladder_ctx->ladder.quantity.c, &idx))
+                return false;
+            gen->bank_used[LADDER_C_C] = true;
+            snprintf(out, size, "C[%u]", (unsigned) idx);
+            return true;
+        case LADDER_OPERAND_I32:
+            if (ladder_c_index(operand->ptr, ladder_ctx->registers.D, sizeof(int32_t), ladder_ctx->ladder.quantity.d, &idx)) {
+                gen->bank_used[LADDER_C_D] = true;
+                snprintf(out, size, "D[%u]", (unsigned) idx);
+                return true;
+            }
+            for (uint32_t m = 0; ladder_ctx->input != NULL && m < ladder_ctx->hw.io.fn_read_qty; m++)
+                if (ladder_c_index(operand->ptr, ladder_ctx->input[m].IW, sizeof(int32_t), ladder_ctx->input[m].iw_qty, &idx)) {
+                    gen->input_used[m] |= LADDER_C_PORT_WORD;
+                    snprintf(out, size, "IW%u[%u]", (unsigned) m, (unsigned) idx);
+                    return true;
+                }
+            for (uint32_t m = 0; ladder_ctx->output != NULL && m < ladder_ctx->hw.io.fn_write_qty; m++)
+                if (ladder_c_index(operand->ptr, ladder_ctx->output[m].QW, sizeof(int32_t), ladder_ctx->output[m].qw_qty, &idx)) {
+                    gen->output_used[m] |= LADDER_C_PORT_WORD;
+                    snprintf(out, size, "QW%u[%u]", (unsigned) m, (unsigned) idx);
+                    return true;
+                }
+            return false;
+        case LADDER_OPERAND_REAL:
+            if (!ladder_c_index(operand->ptr, ladder_ctx->registers.R, sizeof(float), ladder_ctx->ladder.quantity.r, &idx))
+                return false;
+            gen->bank_used[LADDER_C_R] = true;
+            snprintf(out, size, "R[%u]", (unsigned) idx);
+            return true;
+        case LADDER_OPERAND_TIMER:
+            if (ladder_ctx->timers == NULL
+                    || !ladder_c_index(operand->ptr, &ladder_ctx->timers[0].acc, sizeof(ladder_timer_t), ladder_ctx->ladder.quantity.t, &idx))
+                return false;
+            gen->bank_used[LADDER_C_T] = true;
+            snprintf(out, size, "T[%u].acc", (unsigned) idx);
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Numeric operand as an int32_t expression (same conversions as ladder_operand_get)
+static bool ladder_c_read(ladder_c_gen_t *gen, const ladder_operand_t *operand, char *out, size_t size) {
+    char lv[48];
+
+    switch (operand->kind) {
+        case LADDER_OPERAND_NONE:
+            snprintf(out, size, "0");
+            return true;
+        case LADDER_OPERAND_CONST:
+            ladder_c_int(out, size, operand->value);
+            return true;
+        default:
+            break;
+    }
+
+    if (!ladder_c_lvalue(gen, operand, false, lv, sizeof(lv)))
+        return false;
+
+    switch (operand->kind) {
+        case LADDER_OPERAND_I32:
+            snprintf(out, size, "%s", lv);
+            break;
+        case LADDER_OPERAND_TIMER:
+            snprintf(out, size, "(%s > INT32_MAX ? INT32_MAX : (int32_t) %s)", lv, lv);
+            break;
+        default:
+            snprintf(out, size, "(int32_t) %s", lv);
+            break;
+    }
+
+    return true;
+}
+
+static void ladder_c_power(ladder_c_gen_t *gen, const ladder_c_value_t *value, char *out, size_t size) {
+    switch (value->power) {
+        case LADDER_C_FALSE:
+            snprintf(out, size, "false");
+            break;
+        case LADDER_C_TRUE:
+            snprintf(out, size, "true");
+            break;
+        case LADDER_C_LOCAL:
+            snprintf(out, size, "p%u", (unsigned) value->local);
+            break;
+        default:
+            gen->row_used[value->row] = true;
+            snprintf(out, size, "row%u[%u].state", (unsigned) value->row, (unsigned) value->column);
+            break;
+    }
+}
+
+static ladder_c_value_t ladder_c_const(bool power) {
+    ladder_c_value_t value = { .power = power ? LADDER_C_TRUE : LADDER_C_FALSE };
+    return value;
+}
+
+static ladder_c_value_t* ladder_c_cell(ladder_c_gen_t *gen, uint32_t row, uint32_t column) {
+    return &gen->cell[row * gen->cols + column];
+}
+
+// Power on the left of a cell (column 0 is the power rail)
+static ladder_c_value_t ladder_c_left(ladder_c_gen_t *gen, uint32_t row, uint32_t column) {
+    return column == 0 ? ladder_c_const(true) : *ladder_c_cell(gen, row, column - 1);
+}
+
+static void ladder_c_forget(ladder_c_gen_t *gen, uint32_t row, uint32_t column) {
+    ladder_c_value_t *cell = ladder_c_cell(gen, row, column);
+    cell->power = LADDER_C_MEM;
+    cell->row = row;
+    cell->column = column;
+}
+
+static void ladder_c_set_expr(ladder_c_gen_t *gen, uint32_t row, uint32_t column, const char *expr);
+
+// Store cell power. The store is skipped when the cell already holds the value.
+static void ladder_c_set(ladder_c_gen_t *gen, uint32_t row, uint32_t column, ladder_c_value_t value) {
+    char power[48];
+    ladder_c_value_t *cell = ladder_c_cell(gen, row, column);
+
+    if (value.power == LADDER_C_MEM) {
+        if (value.row == row && value.column == column)
+            return;
+        ladder_c_power(gen, &value, power, sizeof(power));
+        ladder_c_set_expr(gen, row, column, power);
+        return;
+    }
+
+    if (cell->power == value.power && (value.power != LADDER_C_LOCAL || cell->local == value.local))
+        return;
+
+    ladder_c_power(gen, &value, power, sizeof(power));
+    gen->row_used[row] = true;
+    ladder_c_printf(&gen->body, "    row%u[%u].state = %s;\n", (unsigned) row, (unsigned) column, power);
+    *cell = value;
+}
+
+// Store cell power computed by an expression
+static void ladder_c_set_expr(ladder_c_gen_t *gen, uint32_t row, uint32_t column, const char *expr) {
+    ladder_c_value_t value = { .power = LADDER_C_LOCAL, .local = gen->locals++ };
+
+    ladder_c_printf(&gen->body, "    bool p%u = %s;\n", (unsigned) value.local, expr);
+    ladder_c_set(gen, row, column, value);
+}
+
+// Cell power of a contact or compare: test AND left power
+static void ladder_c_and(ladder_c_gen_t *gen, const ladder_op_t *op, const char *test) {
+    char left[48], expr[448];
+    ladder_c_value_t value = ladder_c_left(gen, op->row, op->column);
+
+    if (value.power == LADDER_C_FALSE) {
+        ladder_c_set(gen, op->row, op->column, value);
+        return;
+    }
+    if (value.power == LADDER_C_TRUE) {
+        ladder_c_set_expr(gen, op->row, op->column, test);
+        return;
+    }
+
+    ladder_c_power(gen, &value, left, sizeof(left));
+    snprintf(expr, sizeof(expr), "%s && %s", left, test);
+    ladder_c_set_expr(gen, op->row, op->column, expr);
+}
+
+static void ladder_c_last(ladder_c_gen_t *gen, const ladder_op_t *op) {
+    char ins[32];
+
+    ladder_c_ins(ins, sizeof(ins), op->code);
+    ladder_c_printf(&gen->body, "    %s_last(ladder_ctx, %s, %u, %u, %u);\n", gen->prefix, ins, (unsigned) gen->network, (unsigned) op->row,
+            (unsigned) op->column);
+}
+
+static bool ladder_c_bit(ladder_c_gen_t *gen, const ladder_compiled_network_t *cnet, const ladder_op_t *op) {
+    const ladder_operand_t *operand = &cnet->operands[op->operand];
+    char reg[48], prev[48], expr[160], left[48];
+
+    bool coil = op->op == LADDER_OP_COIL_BOUND || op->op == LADDER_OP_COILL_BOUND || op->op == LADDER_OP_COILU_BOUND;
+    bool edge = op->op == LADDER_OP_RE_BOUND || op->op == LADDER_OP_FE_BOUND;
+    bool latch = op->op == LADDER_OP_COILL_BOUND || op->op == LADDER_OP_COILU_BOUND;
+    ladder_c_value_t value = ladder_c_left(gen, op->row, op->column);
+
+    // contacts without power are false whatever the register holds
+    if (!coil && value.power == LADDER_C_FALSE) {
+        ladder_c_set(gen, op->row, op->column, value);
+        return true;
+    }
+
+    // latch and unlatch with power don't depend on the previous value
+    if (!ladder_c_lvalue(gen, operand, false, reg, sizeof(reg)))
+        return false;
+    if ((edge || (latch && value.power != LADDER_C_TRUE)) && !ladder_c_lvalue(gen, operand, true, prev, sizeof(prev)))
+        return false;
+
+    switch (op->op) {
+        case LADDER_OP_NO_BOUND:
+            ladder_c_and(gen, op, reg);
+            break;
+        case LADDER_OP_NC_BOUND:
+            snprintf(expr, sizeof(expr), "!%s", reg);
+            ladder_c_and(gen, op, expr);
+            break;
+        case LADDER_OP_RE_BOUND:
+            snprintf(expr, sizeof(expr), "%s && !%s", reg, prev);
+            ladder_c_and(gen, op, expr);
+            break;
+        case LADDER_OP_FE_BOUND:
+            snprintf(expr, sizeof(expr), "!%s && %s", reg, prev);
+            ladder_c_and(gen, op, expr);
+            break;
+        case LADDER_OP_COIL_BOUND:
+            ladder_c_set(gen, op->row, op->column, value);
+            if (value.power == LADDER_C_MEM)
+                value = *ladder_c_cell(gen, op->row, op->column);
+            ladder_c_power(gen, &value, left, sizeof(left));
+            if (value.power == LADDER_C_LOCAL)
+                ladder_c_printf(&gen->body, "    %s = %s ? 1 : 0;\n", reg, left);
+            else
+                ladder_c_printf(&gen->body, "    %s = %d;\n", reg, value.power == LADDER_C_TRUE ? 1 : 0);
+            break;
+        case LADDER_OP_COILL_BOUND:
+        case LADDER_OP_COILU_BOUND:
+            if (op->op == LADDER_OP_COILL_BOUND) {
+                // latch: previous value OR left power
+                if (value.power == LADDER_C_TRUE)
+                    ladder_c_set(gen, op->row, op->column, ladder_c_const(true));
+                else if (value.power == LADDER_C_FALSE)
+                    ladder_c_set_expr(gen, op->row, op->column, prev);
+                else {
+                    ladder_c_power(gen, &value, left, sizeof(left));
+                    snprintf(expr, sizeof(expr), "%s || %s", prev, left);
+                    ladder_c_set_expr(gen, op->row, op->column, expr);
+                }
+            } else {
+                // unlatch: previous value AND NOT left power
+                if (value.power == LADDER_C_TRUE)
+                    ladder_c_set(gen, op->row, op->column, ladder_c_const(false));
+                else if (value.power == LADDER_C_FALSE)
+                    ladder_c_set_expr(gen, op->row, op->column, prev);
+                else {
+                    ladder_c_power(gen, &value, left, sizeof(left));
+                    snprintf(expr, sizeof(expr), "%s && !%s", prev, left);
+                    ladder_c_set_expr(gen, op->row, op->column, expr);
+                }
+            }
+            value = *ladder_c_cell(gen, op->row, op->column);
+            ladder_c_power(gen, &value, left, sizeof(left));
+            if (value.power == LADDER_C_LOCAL)
+                ladder_c_printf(&gen->body, "    %s = %s ? 1 : 0;\n", reg, left);
+            else
+                ladder_c_printf(&gen->body, "    %s = %d;\n", reg, value.power == LADDER_C_TRUE ? 1 : 0);
+            break;
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+static bool ladder_c_compare(ladder_c_gen_t *gen, const ladder_compiled_network_t *cnet, const ladder_op_t *op) {
+    static const char *str_cmp[] = { "==", "!=", ">", ">=", "<", "<=" };
+    const ladder_operand_t *operand = &cnet->operands[op->operand];
+    uint32_t cmp = op->op - LADDER_OP_EQ_BOUND;
+    char a[160], b[160], expr[384];
+
+    if (ladder_c_left(gen, op->row, op->column).power == LADDER_C_FALSE) {
+        ladder_c_set(gen, op->row, op->column, ladder_c_const(false));
+        return true;
+    }
+
+    // constant operands or a register against itself: fold the comparison
+    bool same = operand[0].kind == operand[1].kind && operand[0].ptr != NULL && operand[0].ptr == operand[1].ptr;
+    if (same
+            || ((operand[0].kind == LADDER_OPERAND_CONST || operand[0].kind == LADDER_OPERAND_NONE)
+                    && (operand[1].kind == LADDER_OPERAND_CONST || operand[1].kind == LADDER_OPERAND_NONE))) {
+        int32_t x = same ? 0 : ladder_operand_get(&operand[0]), y = same ? 0 : ladder_operand_get(&operand[1]);
+        bool result[] = { x == y, x != y, x > y, x >= y, x < y, x <= y };
+        if (!result[cmp]) {
+            ladder_c_set(gen, op->row, op->column, ladder_c_const(false));
+            return true;
+        }
+        ladder_c_set(gen, op->row, op->column, ladder_c_left(gen, op->row, op->column));
+        return true;
+    }
+
+    if (!ladder_c_read(gen, &operand[0], a, sizeof(a)) || !ladder_c_read(gen, &operand[1], b, sizeof(b)))
+        return false;
+    snprintf(expr, sizeof(expr), "(%s %s %s)", a, str_cmp[cmp], b);
+    ladder_c_and(gen, op, expr);
+
+    return true;
+}
+
+static bool ladder_c_arith(ladder_c_gen_t *gen, const ladder_compiled_network_t *cnet, const ladder_op_t *op) {
+    const ladder_operand_t *operand = &cnet->operands[op->operand];
+    const char *arith = op->op == LADDER_OP_ADD_BOUND ? "+" : "*";
+    char a[160], b[160], val[384], dst[48], left[48];
+
+    ladder_c_value_t value = ladder_c_left(gen, op->row, op->column);
+    ladder_c_set(gen, op->row, op->column, value);
+    if (value.power == LADDER_C_FALSE || operand[2].kind == LADDER_OPERAND_NONE)
+        return true;
+    value = *ladder_c_cell(gen, op->row, op->column);
+
+    // wrap around like the 32 bits registers without signed overflow
+    if ((operand[0].kind == LADDER_OPERAND_CONST || operand[0].kind == LADDER_OPERAND_NONE)
+            && (operand[1].kind == LADDER_OPERAND_CONST || operand[1].kind == LADDER_OPERAND_NONE)) {
+        uint32_t x = (uint32_t) ladder_operand_get(&operand[0]), y = (uint32_t) ladder_operand_get(&operand[1]);
+        ladder_c_int(val, sizeof(val), (int32_t) (op->op == LADDER_OP_ADD_BOUND ? x + y : x * y));
+    } else {
+        if (!ladder_c_read(gen, &operand[0], a, sizeof(a)) || !ladder_c_read(gen, &operand[1], b, sizeof(b)))
+            return false;
+        snprintf(val, sizeof(val), "(int32_t) ((uint32_t) %s %s (uint32_t) %s)", a, arith, b);
+    }
+    if (!ladder_c_lvalue(gen, &operand[2], false, dst, sizeof(dst)))
+        return false;
+
+    const char *indent = "    ";
+    if (value.power != LADDER_C_TRUE) {
+        ladder_c_power(gen, &value, left, sizeof(left));
+        ladder_c_printf(&gen->body, "    if (%s) {\n", left);
+        indent = "        ";
+    } else {
+        ladder_c_printf(&gen->body, "    {\n");
+        indent = "        ";
+    }
+    ladder_c_printf(&gen->body, "%sint32_t val = %s;\n", indent, val);
+    if (operand[2].kind == LADDER_OPERAND_I32 && operand[2].size == sizeof(int32_t))
+        ladder_c_printf(&gen->body, "%s%s = val;\n", indent, dst);
+    else if (operand[2].kind == LADDER_OPERAND_U32 && operand[2].size == sizeof(uint32_t))
+        ladder_c_printf(&gen->body, "%s%s = (uint32_t) val;\n", indent, dst);
+    else
+        ladder_c_printf(&gen->body, "%smemcpy(&%s, &val, %u);\n", indent, dst, (unsigned) operand[2].size);
+    ladder_c_printf(&gen->body, "    }\n");
+
+    return true;
+}
+
+static void ladder_c_merge(ladder_c_gen_t *gen, const ladder_op_t *op) {
+    char power[48], expr[LADDER_MAX_ROWS * 24];
+    size_t len = 0;
+    bool on = false, single = true;
+    ladder_c_value_t first = ladder_c_const(false);
+
+    expr[0] = '\0';
+    for (uint32_t gr = op->row; gr <= op->row_end; gr++) {
+        ladder_c_value_t value = *ladder_c_cell(gen, gr, op->column);
+        if (value.power == LADDER_C_FALSE)
+            continue;
+        if (value.power == LADDER_C_TRUE) {
+            on = true;
+            break;
+        }
+        if (first.power == LADDER_C_FALSE)
+            first = value;
+        else if (!(value.power == first.power && (value.power == LADDER_C_LOCAL ? value.local == first.local :
+                (value.row == first.row && value.column == first.column))))
+            single = false;
+        ladder_c_power(gen, &value, power, sizeof(power));
+        len += snprintf(expr + len, sizeof(expr) - len, "%s%s", len == 0 ? "" : " || ", power);
+    }
+
+    ladder_c_value_t group;
+    if (on)
+        group = ladder_c_const(true);
+    else if (single)
+        group = first;
+    else {
+        group.power = LADDER_C_LOCAL;
+        group.local = gen->locals++;
+        ladder_c_printf(&gen->body, "    bool p%u = %s;\n", (unsigned) group.local, expr);
+    }
+
+    // a group held only by a cell state gets a local before the cells are stored
+    if (group.power == LADDER_C_MEM) {
+        ladder_c_power(gen, &group, power, sizeof(power));
+        group.power = LADDER_C_LOCAL;
+        group.local = gen->locals++;
+        ladder_c_printf(&gen->body, "    bool p%u = %s;\n", (unsigned) group.local, power);
+    }
+
+    for (uint32_t gr = op->row; gr <= op->row_end; gr++)
+        ladder_c_set(gen, gr, op->column, group);
+}
+
+// Straight-line body of a compiled network
+static bool ladder_c_network_body(ladder_c_gen_t *gen, const ladder_compiled_network_t *cnet, uint32_t rows) {
+    for (uint32_t r = 0; r < rows; r++)
+        for (uint32_t c = 0; c < gen->cols; c++)
+            ladder_c_forget(gen, r, c);
+
+    // cells a scan can power start without power
+    for (uint32_t n = 0; n < cnet->clear_start[rows]; n++)
+        ladder_c_set(gen, cnet->clear[n] >> 8, cnet->clear[n] & 0xff, ladder_c_const(false));
+
+    for (const ladder_op_t *next = cnet->ops; next < cnet->ops + cnet->ops_qty; next++) {
+        // fused operations are generated one by one
+        ladder_op_t plain = *next;
+        const ladder_op_t *op = &plain;
+        plain.op = ladder_op_unfused(next->op);
+
+        switch (op->op) {
+            case LADDER_OP_NO_BOUND:
+            case LADDER_OP_NC_BOUND:
+            case LADDER_OP_RE_BOUND:
+            case LADDER_OP_FE_BOUND:
+            case LADDER_OP_COIL_BOUND:
+            case LADDER_OP_COILL_BOUND:
+            case LADDER_OP_COILU_BOUND:
+                if (!ladder_c_bit(gen, cnet, op))
+                    return false;
+                break;
+            case LADDER_OP_EQ_BOUND:
+            case LADDER_OP_NE_BOUND:
+            case LADDER_OP_GT_BOUND:
+            case LADDER_OP_GE_BOUND:
+            case LADDER_OP_LT_BOUND:
+            case LADDER_OP_LE_BOUND:
+                if (!ladder_c_compare(gen, cnet, op))
+                    return false;
+                break;
+            case LADDER_OP_ADD_BOUND:
+            case LADDER_OP_MUL_BOUND:
+                if (!ladder_c_arith(gen, cnet, op))
+                    return false;
+                break;
+            case LADDER_OP_WIRE:
+                ladder_c_set(gen, op->row, op->column, ladder_c_left(gen, op->row, op->operand));
+                break;
+            case LADDER_OP_MERGE:
+                ladder_c_merge(gen, op);
+                break;
+            case LADDER_OP_INV:
+                ladder_c_last(gen, op);
+                ladder_c_printf(&gen->body, "    ladder_ctx->ladder.last.err = LADDER_INS_ERR_FAIL;\n");
+                ladder_c_printf(&gen->body, "    return %s_fault(ladder_ctx);\n", gen->prefix);
+                return true;
+            case LADDER_OP_RUNG_END:
+                if (op->row_end)
+                    ladder_c_last(gen, op);
+                ladder_c_printf(&gen->body, "    if (ladder_ctx->on.scan_end != NULL)\n        ladder_ctx->on.scan_end(ladder_ctx);\n\n");
+                // the hook sees the whole context
+                for (uint32_t r = 0; r < rows; r++)
+                    for (uint32_t c = 0; c < gen->cols; c++)
+                        ladder_c_forget(gen, r, c);
+                break;
+            case LADDER_OP_END:
+                ladder_c_printf(&gen->body, "    return true;\n");
+                return true;
+            default:
+                if (op->op >= LADDER_INS_INV && op->op != LADDER_OP_CUSTOM && op->op != LADDER_OP_CUSTOM_BOUND)
+                    return false;
+                // generic instruction on a frame filled from the cell states, custom instructions through the context (checked by _valid)
+                ladder_c_last(gen, op);
+                ladder_c_printf(&gen->body, "    {\n        ladder_frame_t frame;\n");
+                ladder_c_printf(&gen->body, "        ladder_frame_cell(&frame, ladder_ctx, %u, %u);\n", (unsigned) op->column, (unsigned) op->row);
+                if (op->op < LADDER_INS_INV) {
+                    ladder_c_printf(&gen->body, "        if ((ladder_ctx->ladder.last.err = fn_%s(&frame)) != LADDER_INS_ERR_OK)\n", str_ins[op->op]);
+                } else {
+                    gen->custom_all |= (uint32_t) 1 << (op->code - LADDER_INS_CUSTOM);
+                    ladder_c_printf(&gen->body, "        if ((ladder_ctx->ladder.last.err = ladder_ctx->custom[%u].exec(&frame)) != LADDER_INS_ERR_OK)\n",
+                            (unsigned) (op->code - LADDER_INS_CUSTOM));
+                }
+                ladder_c_printf(&gen->body, "            return %s_fault(ladder_ctx);\n    }\n", gen->prefix);
+                // instructions set the states of their column, foreign functions may set any
+                for (uint32_t r = 0; r < rows; r++)
+                    for (uint32_t c = 0; c < gen->cols; c++)
+                        if (op->op == LADDER_INS_FOREIGN || c == op->column)
+                            ladder_c_forget(gen, r, c);
+                break;
+        }
+    }
+
+    ladder_c_printf(&gen->body, "    return true;\n");
+    return true;
+}
+
+static bool ladder_c_network(ladder_c_gen_t *gen, FILE *fp, const ladder_compiled_network_t *cnet) {
+    ladder_ctx_t *ladder_ctx = gen->ladder_ctx;
+    ladder_network_t *net = &ladder_ctx->network[gen->network];
+    uint32_t read_qty = ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0;
+    uint32_t write_qty = ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0;
+
+    fprintf(fp, "static bool %s_network_%u(ladder_ctx_t *ladder_ctx) {\n", gen->prefix, (unsigned) gen->network);
+    if (cnet->interpreted || net->cells == NULL) {
+        // over the watchdog budget: the interpreter counts the cycles
+        fprintf(fp, "    return ladder_scan_network(ladder_ctx, %u);\n}\n\n", (unsigned) gen->network);
+        return true;
+    }
+
+    gen->body.len = 0;
+    if (gen->body.data != NULL)
+        gen->body.data[0] = '\0';
+    gen->locals = 0;
+    gen->cols = net->cols;
+    memset(gen->row_used, 0, sizeof(gen->row_used));
+    memset(gen->bank_used, 0, sizeof(gen->bank_used));
+    memset(gen->input_used, 0, read_qty + 1);
+    memset(gen->output_used, 0, write_qty + 1);
+    free(gen->cell);
+    gen->cell = malloc((size_t) net->rows * net->cols * sizeof(ladder_c_value_t) + 1);
+    if (gen->cell == NULL || !ladder_c_network_body(gen, cnet, net->rows) || gen->body.fail)
+        return false;
+
+    fprintf(fp, "    ladder_network_t *net = &ladder_ctx->network[%u];\n", (unsigned) gen->network);
+    fprintf(fp, "    ladder_ctx->exec_network = net;\n");
+    for (uint32_t r = 0; r < net->rows; r++)
+        if (gen->row_used[r])
+            fprintf(fp, "    ladder_cell_t *const row%u = net->cells[%u];\n", (unsigned) r, (unsigned) r);
+    for (uint32_t b = 0; b < LADDER_C_QTY; b++)
+        if (gen->bank_used[b])
+            fprintf(fp, "    %s;\n", str_bank_decl[b]);
+    for (uint32_t m = 0; m < read_qty; m++) {
+        if (gen->input_used[m] & LADDER_C_PORT_VAL)
+            fprintf(fp, "    uint8_t *const I%u = ladder_ctx->input[%u].I;\n", (unsigned) m, (unsigned) m);
+        if (gen->input_used[m] & LADDER_C_PORT_WORD)
+            fprintf(fp, "    int32_t *const IW%u = ladder_ctx->input[%u].IW;\n", (unsigned) m, (unsigned) m);
+        if (gen->input_used[m] & LADDER_C_PORT_PREV)
+            fprintf(fp, "    const uint8_t *const Ih%u = ladder_ctx->input[%u].Ih;\n", (unsigned) m, (unsigned) m);
+        gen->input_all[m] |= gen->input_used[m];
+    }
+    for (uint32_t m = 0; m < write_qty; m++) {
+        if (gen->output_used[m] & LADDER_C_PORT_VAL)
+            fprintf(fp, "    uint8_t *const Q%u = ladder_ctx->output[%u].Q;\n", (unsigned) m, (unsigned) m);
+        if (gen->output_used[m] & LADDER_C_PORT_WORD)
+            fprintf(fp, "    int32_t *const QW%u = ladder_ctx->output[%u].QW;\n", (unsigned) m, (unsigned) m);
+        if (gen->output_used[m] & LADDER_C_PORT_PREV)
+            fprintf(fp, "    const uint8_t *const Qh%u = ladder_ctx->output[%u].Qh;\n", (unsigned) m, (unsigned) m);
+        gen->output_all[m] |= gen->output_used[m];
+    }
+    fprintf(fp, "\n%s}\n\n", gen->body.data != NULL ? gen->body.data : "");
+
+    return true;
+}
+
+// Context checks: the generated code indexes banks and I/O modules as they were when it was generated
+static void ladder_c_valid(ladder_c_gen_t *gen, FILE *fp) {
+    ladder_ctx_t *ladder_ctx = gen->ladder_ctx;
+    uint32_t read_qty = ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0;
+    uint32_t write_qty = ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0;
+
+    fprintf(fp, "static bool %s_valid(ladder_ctx_t *ladder_ctx) {\n", gen->prefix);
+    fprintf(fp, "    if (ladder_ctx->network == NULL)\n        return false;\n");
+    fprintf(fp, "    if (ladder_ctx->ladder.quantity.networks != %u || ladder_ctx->ladder.quantity.m != %u || ladder_ctx->ladder.quantity.c != %u\n",
+            (unsigned) ladder_ctx->ladder.quantity.networks, (unsigned) ladder_ctx->ladder.quantity.m, (unsigned) ladder_ctx->ladder.quantity.c);
+    fprintf(fp, "            || ladder_ctx->ladder.quantity.t != %u || ladder_ctx->ladder.quantity.d != %u || ladder_ctx->ladder.quantity.r != %u\n",
+            (unsigned) ladder_ctx->ladder.quantity.t, (unsigned) ladder_ctx->ladder.quantity.d, (unsigned) ladder_ctx->ladder.quantity.r);
+    fprintf(fp, "            || ladder_ctx->scan_internals.max_scan_cycles != %lluULL)\n        return false;\n",
+            (unsigned long long) ladder_ctx->scan_internals.max_scan_cycles);
+    fprintf(fp, "    if (ladder_ctx->memory.M == NULL || ladder_ctx->memory.Cd == NULL || ladder_ctx->memory.Cr == NULL || ladder_ctx->memory.Td == NULL\n");
+    fprintf(fp, "            || ladder_ctx->memory.Tr == NULL || ladder_ctx->registers.C == NULL || ladder_ctx->registers.D == NULL\n");
+    fprintf(fp, "            || ladder_ctx->registers.R == NULL || ladder_ctx->timers == NULL || LADDER_HISTORY(ladder_ctx, M) == NULL)\n");
+    fprintf(fp, "        return false;\n");
+
+    fprintf(fp, "    for (uint32_t n = 0; n < %s_NETWORKS; n++)\n", gen->prefix);
+    fprintf(fp, "        if (ladder_ctx->network[n].rows != %s_networks[n].rows || ladder_ctx->network[n].cols != %s_networks[n].cols)\n", gen->prefix,
+            gen->prefix);
+    fprintf(fp, "            return false;\n");
+
+    fprintf(fp, "    if ((ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0) != %u\n", (unsigned) read_qty);
+    fprintf(fp, "            || (ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0) != %u)\n        return false;\n",
+            (unsigned) write_qty);
+    for (uint32_t m = 0; m < read_qty; m++) {
+        fprintf(fp, "    if (ladder_ctx->input[%u].i_qty != %u || ladder_ctx->input[%u].iw_qty != %u", (unsigned) m,
+                (unsigned) ladder_ctx->input[m].i_qty, (unsigned) m, (unsigned) ladder_ctx->input[m].iw_qty);
+        if (gen->input_all[m] & LADDER_C_PORT_VAL)
+            fprintf(fp, " || ladder_ctx->input[%u].I == NULL", (unsigned) m);
+        if (gen->input_all[m] & LADDER_C_PORT_WORD)
+            fprintf(fp, " || ladder_ctx->input[%u].IW == NULL", (unsigned) m);
+        if (gen->input_all[m] & LADDER_C_PORT_PREV)
+            fprintf(fp, " || ladder_ctx->input[%u].Ih == NULL", (unsigned) m);
+        fprintf(fp, ")\n        return false;\n");
+    }
+    for (uint32_t m = 0; m < write_qty; m++) {
+        fprintf(fp, "    if (ladder_ctx->output[%u].q_qty != %u || ladder_ctx->output[%u].qw_qty != %u", (unsigned) m,
+                (unsigned) ladder_ctx->output[m].q_qty, (unsigned) m, (unsigned) ladder_ctx->output[m].qw_qty);
+        if (gen->output_all[m] & LADDER_C_PORT_VAL)
+            fprintf(fp, " || ladder_ctx->output[%u].Q == NULL", (unsigned) m);
+        if (gen->output_all[m] & LADDER_C_PORT_WORD)
+            fprintf(fp, " || ladder_ctx->output[%u].QW == NULL", (unsigned) m);
+        if (gen->output_all[m] & LADDER_C_PORT_PREV)
+            fprintf(fp, " || ladder_ctx->output[%u].Qh == NULL", (unsigned) m);
+        fprintf(fp, ")\n        return false;\n");
+    }
+    for (uint32_t n = 0; n < LADDER_CUSTOM_MAX; n++)
+        if (gen->custom_all >> n & 1)
+            fprintf(fp, "    if (ladder_custom_get(ladder_ctx, %u) == NULL)\n        return false;\n", (unsigned) (LADDER_INS_CUSTOM + n));
+    fprintf(fp, "\n    return true;\n}\n\n");
+}
+
+static void ladder_c_string(FILE *fp, const char *str) {
+    fputc('"', fp);
+    for (const unsigned char *s = (const unsigned char*) str; *s != '\0'; s++) {
+        if (*s == '"' || *s == '\\')
+            fprintf(fp, "\\%c", *s);
+        else if (*s < 0x20 || *s > 0x7e)
+            fprintf(fp, "\\%03o", *s);
+        else
+            fputc(*s, fp);
+    }
+    fputc('"', fp);
+}
+
+static void ladder_c_data(FILE *fp, const ladder_cell_t *cell, uint32_t d) {
+    const ladder_value_t *value = &cell->data[d];
+    char num[24];
+
+    // timers base time is stored as the data type
+    if ((cell->code == LADDER_INS_TON || cell->code == LADDER_INS_TOF || cell->code == LADDER_INS_TP) && d == 1) {
+        if (value->type < sizeof(str_basetime) / sizeof(str_basetime[0]))
+            fprintf(fp, "    { (ladder_register_t) LADDER_BASETIME_%s, .value.u32 = %uU },\n", str_basetime[value->type], (unsigned) value->value.u32);
+        else
+            fprintf(fp, "    { (ladder_register_t) %u, .value.u32 = %uU },\n", (unsigned) value->type, (unsigned) value->value.u32);
+        return;
+    }
+
+    if (value->type >= sizeof(str_register) / sizeof(str_register[0])) {
+        fprintf(fp, "    { (ladder_register_t) %u, .value.u32 = %uU },\n", (unsigned) value->type, (unsigned) value->value.u32);
+        return;
+    }
+
+    fprintf(fp, "    { LADDER_REGISTER_%s, ", str_register[value->type]);
+    switch (value->type) {
+        case LADDER_REGISTER_S:
+            if (value->value.cstr == NULL) {
+                fprintf(fp, ".value.cstr = NULL },\n");
+            } else {
+                fprintf(fp, ".value.cstr = ");
+                ladder_c_string(fp, value->value.cstr);
+                fprintf(fp, " },\n");
+            }
+            break;
+        case LADDER_REGISTER_I:
+        case LADDER_REGISTER_Q:
+        case LADDER_REGISTER_IW:
+        case LADDER_REGISTER_QW:
+            fprintf(fp, ".value.mp = { %u, %u } },\n", (unsigned) value->value.mp.module, (unsigned) value->value.mp.port);
+            break;
+        case LADDER_REGISTER_R:
+            if (isnan(value->value.real))
+                fprintf(fp, ".value.real = NAN },\n");
+            else if (isinf(value->value.real))
+                fprintf(fp, ".value.real = %sINFINITY },\n", value->value.real < 0 ? "-" : "");
+            else
+                fprintf(fp, ".value.real = (float) %.17g },\n", (double) value->value.real);
+            break;
+        default:
+            ladder_c_int(num, sizeof(num), value->value.i32);
+            fprintf(fp, ".value.i32 = %s },\n", num);
+            break;
+    }
+}
+
+// Program tables and loader: cells are built from constant data instead of parsing a program file
+static void ladder_c_program(ladder_c_gen_t *gen, FILE *fp) {
+    ladder_ctx_t *ladder_ctx = gen->ladder_ctx;
+    const char *p = gen->prefix;
+    uint32_t data_qty = 0;
+
+    fprintf(fp, "static const ladder_value_t %s_data[] = {\n", p);
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        ladder_network_t *net = &ladder_ctx->network[n];
+        for (uint32_t r = 0; net->cells != NULL && r < net->rows; r++)
+            for (uint32_t c = 0; c < net->cols; c++)
+                for (uint32_t d = 0; net->cells[r][c].data != NULL && d < net->cells[r][c].data_qty; d++, data_qty++)
+                    ladder_c_data(fp, &net->cells[r][c], d);
+    }
+    if (data_qty == 0)
+        fprintf(fp, "    { LADDER_REGISTER_NONE, .value.i32 = 0 },\n");
+    fprintf(fp, "};\n\n");
+
+    data_qty = 0;
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        ladder_network_t *net = &ladder_ctx->network[n];
+        if (net->cells == NULL)
+            continue;
+        fprintf(fp, "static const %s_cell_t %s_cells_%u[] = {\n", p, p, (unsigned) n);
+        for (uint32_t r = 0; r < net->rows; r++) {
+            fprintf(fp, "   ");
+            for (uint32_t c = 0; c < net->cols; c++) {
+                const ladder_cell_t *cell = &net->cells[r][c];
+                uint32_t qty = cell->data != NULL ? cell->data_qty : 0;
+                fprintf(fp, " { %u, %s, %u, %u },", (unsigned) cell->code, cell->vertical_bar ? "true" : "false", (unsigned) qty, (unsigned) data_qty);
+                data_qty += qty;
+            }
+            fprintf(fp, "\n");
+        }
+        fprintf(fp, "};\n\n");
+    }
+
+    fprintf(fp, "static const %s_network_t %s_networks[%s_NETWORKS] = {\n", p, p, p);
+    for (uint32_t n = 0; n < ladder_ctx->ladder.quantity.networks; n++) {
+        ladder_network_t *net = &ladder_ctx->network[n];
+        if (net->cells == NULL)
+            fprintf(fp, "    { 0, 0, %s, NULL },\n", net->enable ? "true" : "false");
+        else
+            fprintf(fp, "    { %u, %u, %s, %s_cells_%u },\n", (unsigned) net->rows, (unsigned) net->cols, net->enable ? "true" : "false", p, (unsigned) n);
+    }
+    fprintf(fp, "};\n\n");
+}
+
+// Loader of the generated program ($P: prefix)
+static const char *ladder_c_runtime = //
+        "bool $P_program(ladder_ctx_t *ladder_ctx) {\n"
+        "    if (ladder_ctx == NULL || ladder_ctx->network == NULL || ladder_ctx->ladder.quantity.networks != $P_NETWORKS)\n"
+        "        return false;\n"
+        "\n"
+        "    ladder_clear_program(ladder_ctx);\n"
+        "\n"
+        "    for (uint32_t n = 0; n < $P_NETWORKS; n++) {\n"
+        "        const $P_network_t *gnet = &$P_networks[n];\n"
+        "        ladder_network_t *net = &ladder_ctx->network[n];\n"
+        "        net->enable = gnet->enable;\n"
+        "        if (net->rows != gnet->rows || net->cols != gnet->cols || net->cells == NULL) {\n"
+        "            ladder_network_free(net);\n"
+        "            net->rows = 0;\n"
+        "            net->cols = 0;\n"
+        "            if (gnet->cells == NULL)\n"
+        "                continue;\n"
+        "            if (!ladder_network_alloc(net, gnet->rows, gnet->cols))\n"
+        "                goto fail;\n"
+        "        }\n"
+        "\n"
+        "        for (uint32_t r = 0; r < gnet->rows; r++) {\n"
+        "            for (uint32_t c = 0; c < gnet->cols; c++) {\n"
+        "                const $P_cell_t *gcell = &gnet->cells[r * gnet->cols + c];\n"
+        "                ladder_cell_t *cell = &net->cells[r][c];\n"
+        "                cell->code = gcell->code;\n"
+        "                cell->vertical_bar = gcell->vertical_bar;\n"
+        "                cell->state = false;\n"
+        "                if (gcell->data_qty == 0)\n"
+        "                    continue;\n"
+        "                cell->data = calloc(gcell->data_qty, sizeof(ladder_value_t));\n"
+        "                if (cell->data == NULL)\n"
+        "                    goto fail;\n"
+        "                for (uint32_t d = 0; d < gcell->data_qty; d++) {\n"
+        "                    cell->data[d] = $P_data[gcell->data + d];\n"
+        "                    cell->data_qty = d + 1;\n"
+        "                    if (cell->data[d].type == LADDER_REGISTER_S && cell->data[d].value.cstr != NULL\n"
+        "                            && (cell->data[d].value.cstr = strdup(cell->data[d].value.cstr)) == NULL)\n"
+        "                        goto fail;\n"
+        "                }\n"
+        "            }\n"
+        "        }\n"
+        "    }\n"
+        "\n"
+        "    // networks were reallocated: drop any compiled form and pack cells data\n"
+        "    if (!ladder_program_compact(ladder_ctx))\n"
+        "        goto fail;\n"
+        "\n"
+        "    return ladder_set_generated(ladder_ctx, $P_scan) && ladder_set_engine(ladder_ctx, LADDER_ENGINE_GENERATED);\n"
+        "\n"
+        "    fail:\n"
+        "    ladder_clear_program(ladder_ctx);\n"
+        "    return false;\n"
+        "}\n";
+
+// Copy a template replacing $P with the prefix
+static void ladder_c_template(FILE *fp, const char *text, const char *prefix) {
+    for (const char *s = text; *s != '\0'; s++) {
+        if (s[0] == '$' && s[1] == 'P') {
+            fputs(prefix, fp);
+            s++;
+        } else
+            fputc(*s, fp);
+    }
+}
+
+static bool ladder_c_prefix(const char *prefix) {
+    if (prefix == NULL || prefix[0] == '\0' || (prefix[0] >= '0' && prefix[0] <= '9'))
+        return false;
+
+    for (const char *s = prefix; *s != '\0'; s++)
+        if (!((*s >= 'a' && *s <= 'z') || (*s >= 'A' && *s <= 'Z') || (*s >= '0' && *s <= '9') || *s == '_'))
+            return false;
+
+    return true;
+}
+
+bool ladder_program_to_c(const char *c_file, ladder_ctx_t *ladder_ctx, const char *prefix) {
+    if (c_file == NULL || ladder_ctx == NULL || ladder_ctx->network == NULL || !ladder_c_prefix(prefix))
+        return false;
+
+    ladder_compiled_t *compiled = ladder_compiled_get(ladder_ctx);
+    if (compiled == NULL)
+        return false;
+
+    FILE *fp = fopen(c_file, "w");
+    if (fp == NULL)
+        return false;
+
+    uint32_t read_qty = ladder_ctx->input != NULL ? ladder_ctx->hw.io.fn_read_qty : 0;
+    uint32_t write_qty = ladder_ctx->output != NULL ? ladder_ctx->hw.io.fn_write_qty : 0;
+    ladder_c_gen_t gen = { .ladder_ctx = ladder_ctx, .prefix = prefix };
+    gen.input_used = calloc(read_qty + 1, 1);
+    gen.output_used = calloc(write_qty + 1, 1);
+    gen.input_all = calloc(read_qty + 1, 1);
+    gen.output_all = calloc(write_qty + 1, 1);
+    bool ok = gen.input_used != NULL && gen.output_used != NULL && gen.input_all != NULL && gen.output_all != NULL;
+
+    if (ok) {
+        fprintf(fp, "/*\n * Ladder program translated to C by ladder_program_to_c(). Do not edit.\n *\n");
+        fprintf(fp, " *   bool %s_program(ladder_ctx_t *ladder_ctx): load the program and select the generated engine\n", prefix);
+        fprintf(fp, " *   void %s_scan(ladder_ctx_t *ladder_ctx): scan function for ladder_set_generated()\n */\n\n", prefix);
+        fprintf(fp, "#include <stdint.h>\n#include <stdbool.h>\n#include <stdlib.h>\n#include <string.h>\n#include <math.h>\n\n");
+        fprintf(fp, "#include \"ladder.h\"\n#include \"ladder_instructions.h\"\n#include \"ladder_internals.h\"\n#include \"ladder_bits.h\"\n\n");
+        fprintf(fp, "#define %s_NETWORKS %u\n\n", prefix, (unsigned) ladder_ctx->ladder.quantity.networks);
+        fprintf(fp, "typedef struct %s_cell_s {\n", prefix);
+        fprintf(fp, "     uint8_t code;\n        bool vertical_bar;\n     uint8_t data_qty;\n    uint32_t data;\n} %s_cell_t;\n\n", prefix);
+        fprintf(fp, "typedef struct %s_network_s {\n", prefix);
+        fprintf(fp, "          uint32_t rows;\n          uint32_t cols;\n              bool enable;\n    const %s_cell_t *cells;\n} %s_network_t;\n\n",
+                prefix, prefix);
+        ladder_c_program(&gen, fp);
+        fprintf(fp, "bool %s_program(ladder_ctx_t *ladder_ctx);\nvoid %s_scan(ladder_ctx_t *ladder_ctx);\n\n", prefix, prefix);
+        fprintf(fp, "static inline void %s_last(ladder_ctx_t *ladder_ctx, uint8_t instr, uint32_t network, uint32_t row, uint32_t column) {\n", prefix);
+        fprintf(fp, "    ladder_ctx->ladder.last.instr = instr;\n    ladder_ctx->ladder.last.err = LADDER_INS_ERR_OK;\n");
+        fprintf(fp, "    ladder_ctx->ladder.last.network = network;\n    ladder_ctx->ladder.last.cell_row = row;\n");
+        fprintf(fp, "    ladder_ctx->ladder.last.cell_column = column;\n}\n\n");
+        fprintf(fp, "static bool %s_fault(ladder_ctx_t *ladder_ctx) {\n    ladder_ctx->ladder.state = LADDER_ST_INV;\n    return false;\n}\n\n", prefix);
+    }
+
+    for (uint32_t n = 0; ok && n < compiled->networks_qty; n++) {
+        gen.network = n;
+        ok = ladder_c_network(&gen, fp, &compiled->network[n]);
+    }
+
+    if (ok) {
+        ladder_c_valid(&gen, fp);
+
+        fprintf(fp, "void %s_scan(ladder_ctx_t *ladder_ctx) {\n", prefix);
+        fprintf(fp, "    // per instruction hook needs every cell visited, other contexts have other registers and I/O\n");
+        fprintf(fp, "    if (ladder_ctx->on.instruction != NULL || !%s_valid(ladder_ctx)) {\n        ladder_scan(ladder_ctx);\n        return;\n    }\n\n", prefix);
+        fprintf(fp, "    if (!ladder_scan_begin(ladder_ctx))\n        return;\n\n");
+        for (uint32_t n = 0; n < compiled->networks_qty; n++) {
+            fprintf(fp, "    if (ladder_ctx->network[%u].cells == NULL) {\n", (unsigned) n);
+            fprintf(fp, "        ladder_ctx->ladder.state = LADDER_ST_ERROR;\n");
+            fprintf(fp, "        if (ladder_ctx->on.panic != NULL)\n            ladder_ctx->on.panic(ladder_ctx);\n        return;\n    }\n");
+            fprintf(fp, "    if (ladder_ctx->network[%u].enable && !%s_network_%u(ladder_ctx))\n        return;\n", (unsigned) n, prefix, (unsigned) n);
+        }
+        fprintf(fp, "}\n\n");
+
+        ladder_c_template(fp, ladder_c_runtime, prefix);
+    }
+
+    free(gen.body.data);
+    free(gen.cell);
+    free(gen.input_used);
+    free(gen.output_used);
+    free(gen.input_all);
+    free(gen.output_all);
+
+    if (fclose(fp) != 0)
+        ok = false;
+
+    return ok;
+}
+
+#endif /* OPTIONAL_COMPILED */
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2025 Emiliano Gonzalez (egonzalez . hiperion @ gmail . com))
+ * * Project Site: https://github.com/hiperiondev/ladderlib *
+ *
+ * This is based on other projects:
+ *    PLsi (https://github.com/ElPercha/PLsi)
+ *
+ *    please contact their authors for more information.
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ * LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ * OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef LADDER_PROGRAM_C_H_
+#define LADDER_PROGRAM_C_H_
+
+#include <stdbool.h>
+
+#include "ladder.h"
+
+#ifdef OPTIONAL_COMPILED
+
+/**
+ * @fn bool ladder_program_to_c(const char *c_file, ladder_ctx_t *ladder_ctx, const char *prefix)
+ * @brief Translate the program to a C source file with a scan specialized for it.
+ *        The file defines bool <prefix>_program(ladder_ctx_t*), which loads the program in a context and selects the generated engine,
+ *        and void <prefix>_scan(ladder_ctx_t*), the scan function for ladder_set_generated. Registers, I/O ports and constant operands
+ *        are resolved with the context used here: the scan falls back to the interpreter on contexts with other quantities, I/O modules
+ *        or watchdog limit, or when a per instruction hook is set. Program edits after loading are not seen by the generated scan.
+ *
+ * @param c_file C file name
+ * @param ladder_ctx Ladder context with the program loaded and I/O modules initialized
+ * @param prefix Prefix of generated functions (C identifier)
+ * @return Status
+ */
+bool ladder_program_to_c(const char *c_file, ladder_ctx_t *ladder_ctx, const char *prefix);
+
+#endif /* OPTIONAL_COMPILED */
+
+#endif /* LADDER_PROGRAM_C_H_ */
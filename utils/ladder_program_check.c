@@ -32,6 +32,7 @@
 
 #include "ladder.h"
 #include "ladder_internals.h"
+#include "ladder_topology.h"
 #include "ladder_program_check.h"
 
 typedef struct {
@@ -44,7 +45,7 @@ typedef struct {
 } check_info_t;
 
 ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
-    ladder_prg_check_t status;
+    ladder_prg_check_t status = { 0, 0, 0, LADDER_INS_NOP, LADDER_ERR_PRG_CHECK_OK };
     if (ladder_ctx == NULL) {
         status.error = LADDER_ERR_PRG_CHECK_FAIL;
         return status;
@@ -60,13 +61,34 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
             };
     static const size_t num_checks = sizeof(checks) / sizeof(checks[0]);
 
-    for (uint32_t nt = 0; nt < (*ladder_ctx).ladder.quantity.networks; nt++)
+    // The program is sealed (scanned without operand checks) when it passes and every instruction holds its described operands
+    bool sealable = true;
+    ladder_ctx->ladder.sealed = false;
+
+    for (uint32_t nt = 0; nt < (*ladder_ctx).ladder.quantity.networks; nt++) {
+        // Non empty rows of each column from the sparse index: NOP cells without data are only looked at where a MULTI cell is expected
+        uint32_t rows_mask[LADDER_MAX_COLS + 1] = { 0 };
+        const ladder_topology_network_t *tnet = ladder_topology_get(ladder_ctx, nt);
+        if (tnet == NULL || tnet->cols > LADDER_MAX_COLS + 1) {
+            status.network = nt;
+            status.error = LADDER_ERR_PRG_CHECK_FAIL;
+            goto end;
+        }
+        for (uint32_t n = 0; n < tnet->sparse_start[tnet->rows]; n++)
+            rows_mask[tnet->sparse[n] & 0xff] |= (uint32_t) 1 << (tnet->sparse[n] >> 8);
+
         for (uint32_t column = 0; column < (*ladder_ctx).network[nt].cols; column++) {
             // Tracking for expected MULTI cells to validate multi-cell instruction integrity.
             // This prevents dangling or missing MULTI cells.
             uint32_t expected_multi = 0;
 
+            if (rows_mask[column] == 0)
+                continue;
+
             for (uint32_t row = 0; row < (*ladder_ctx).network[nt].rows; row++) {
+                if (expected_multi == 0 && (rows_mask[column] >> row & 1) == 0)
+                    continue;
+
                 status.network = nt;
                 status.row = row;
                 status.column = column;
@@ -146,7 +168,7 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
                                     status.error = checks[i].no_mod_err;
                                     goto end;
                                 }
-                                if (module > fn_qty) {
+                                if (module >= fn_qty) {
                                     status.error = checks[i].inv_mod_err;
                                     goto end;
                                 }
@@ -170,7 +192,7 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
                     // Loop through non-I/O registers to validate indices.
                     // This bounds-checks memory/register accesses to prevent out-of-bounds errors.
                     if (reg_type != LADDER_REGISTER_NONE && reg_type != LADDER_REGISTER_I && reg_type != LADDER_REGISTER_IW && reg_type != LADDER_REGISTER_Q
-                            && reg_type != LADDER_REGISTER_QW && reg_type != LADDER_REGISTER_S && reg_type != LADDER_REGISTER_R) {
+                            && reg_type != LADDER_REGISTER_QW && reg_type != LADDER_REGISTER_S) {
                         int32_t index = (*ladder_ctx).network[nt].cells[row][column].data[d].value.i32;
                         if (index < 0) {
                             status.error = LADDER_ERR_PRG_CHECK_FAIL; // Negative indices are invalid
@@ -307,7 +329,7 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
                             }
                             break;
                         default:
-                            if (status.code >= LADDER_INS_INV) {
+                            if (status.code >= LADDER_INS_INV && ladder_custom_get(ladder_ctx, status.code) == NULL) {
                                 status.error = LADDER_ERR_PRG_CHECK_FAIL; // Invalid instruction code
                                 goto end;
                             }
@@ -322,9 +344,13 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
 
                 // After validating the primary cell, compute and set expected_multi for multi-cell instructions.
                 // This includes handling FOREIGN by fetching its description.
-                if (status.code != LADDER_INS_NOP && status.code != LADDER_INS_CONN && status.code < LADDER_INS_INV) { // Skip trivial single-cells.
+                const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, status.code);
+                // Skip trivial single-cells.
+                if (status.code != LADDER_INS_NOP && status.code != LADDER_INS_CONN && (status.code < LADDER_INS_INV || custom != NULL)) {
                     ladder_instructions_iocd_t iocd;
-                    if (status.code == LADDER_INS_FOREIGN) {
+                    if (custom != NULL) {
+                        iocd = custom->description;
+                    } else if (status.code == LADDER_INS_FOREIGN) {
                         if ((*ladder_ctx).network[nt].cells[row][column].data_qty < 1) {
                             status.error = LADDER_ERR_PRG_CHECK_FAIL; // FOREIGN missing ID data.
                             goto end;
@@ -345,10 +371,19 @@ ladder_prg_check_t ladder_program_check(ladder_ctx_t *ladder_ctx) {
                         goto end;
                     }
 
+                    // Instructions read their operands without bound checks once sealed
+                    if ((*ladder_ctx).network[nt].cells[row][column].data_qty < iocd.data_qty
+                            || ((*ladder_ctx).network[nt].cells[row][column].data_qty > 0 && (*ladder_ctx).network[nt].cells[row][column].data == NULL))
+                        sealable = false;
+
                     expected_multi = iocd.cells - 1;
                 }
             }
         }
+    }
+
+    if (sealable)
+        ladder_seal(ladder_ctx);
 
     end:
     return status;
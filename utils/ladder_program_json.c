@@ -44,6 +44,9 @@
 #endif
 
 #include "ladder.h"
+#include "ladder_instructions.h"
+#include "ladder_topology.h"
+#include "ladder_arena.h"
 #include "ladder_program_json.h"
 
 static const char *str_symbol[] = { "NOP", //
@@ -214,12 +217,19 @@ static bool parse_module_port(const char *str, moduleport_t *result) {
     return false;
 }
 
-static ladder_instruction_t get_instruction_code(const char *symbol) {
+static ladder_instruction_t get_instruction_code(const ladder_ctx_t *ladder_ctx, const char *symbol) {
     for (int i = 0; i < sizeof(str_symbol) / sizeof(str_symbol[0]); i++) {
         if (strcmp(symbol, str_symbol[i]) == 0) {
             return (ladder_instruction_t) i;
         }
     }
+    // custom instructions are saved by name
+    for (uint32_t n = 0; ladder_ctx->custom != NULL && n < LADDER_CUSTOM_MAX; n++) {
+        if (ladder_ctx->custom[n].exec != NULL && strncmp(symbol, ladder_ctx->custom[n].name, sizeof(ladder_ctx->custom[n].name)) == 0
+                && strlen(symbol) < sizeof(ladder_ctx->custom[n].name)) {
+            return ladder_ctx->custom[n].code;
+        }
+    }
     return LADDER_INS_INV;
 }
 
@@ -235,6 +245,18 @@ static ladder_register_t get_register_code(const char *type) {
     return LADDER_REGISTER_INV;
 }
 
+// sparse files written before the network "sparse" flag are recognized by the cells column
+static bool network_has_col(const cJSON *network_data) {
+    for (int r = 0; r < cJSON_GetArraySize(network_data); r++) {
+        cJSON *row_array = cJSON_GetArrayItem(network_data, r);
+        for (int k = 0; k < cJSON_GetArraySize(row_array); k++)
+            if (cJSON_HasObjectItem(cJSON_GetArrayItem(row_array, k), "col"))
+                return true;
+    }
+
+    return false;
+}
+
 static char* read_file(const char *path) {
     FILE *file = fopen(path, "r");
     if (!file)
@@ -606,6 +628,7 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
         return JSON_ERROR_OPENFILE;
     }
 
+    size_t json_len = strlen(json_str);
     cJSON *root = cJSON_Parse(json_str);
     free(json_str);
     if (!root) {
@@ -619,6 +642,13 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
 
     ladder_clear_program(ladder_ctx);
 
+    // cells data and strings of the whole program live in one arena (first block sized from the source text)
+    ladder_arena_t *arena = ladder_arena_get(ladder_ctx, json_len / 4);
+    if (arena == NULL) {
+        cJSON_Delete(root);
+        return JSON_ERROR_FAIL;
+    }
+
     int num_networks = cJSON_GetArraySize(root);
     bool load_ok = true;
 
@@ -643,93 +673,75 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
         ladder_network_t *net = &ladder_ctx->network[n];
         net->enable = true;
 
-        // Free any pre-existing allocations using current rows/cols
-        for (uint32_t rr = 0; rr < net->rows; rr++) {
-            for (uint32_t cc = 0; cc < net->cols; cc++) {
-                if (net->cells[rr][cc].data_qty > 0 && net->cells[rr][cc].data) {
-                    for (uint8_t dd = 0; dd < net->cells[rr][cc].data_qty; dd++) {
-                        if (net->cells[rr][cc].data[dd].type == LADDER_REGISTER_S && net->cells[rr][cc].data[dd].value.cstr) {
-                            free((void*) net->cells[rr][cc].data[dd].value.cstr);
-                        }
-                    }
-                    free(net->cells[rr][cc].data);
-                }
-            }
-            free(net->cells[rr]);
-        }
-        free(net->cells);
-        net->cells = NULL;
-        net->rows = 0;
-        net->cols = 0;
-
         cJSON *rows_json = cJSON_GetObjectItemCaseSensitive(net_obj, "rows");
         if (!rows_json || !cJSON_IsNumber(rows_json)) {
             load_ok = false;
             continue;
         }
-        net->rows = (uint32_t) rows_json->valuedouble;
+        uint32_t rows = (uint32_t) rows_json->valuedouble;
 
         cJSON *cols_json = cJSON_GetObjectItemCaseSensitive(net_obj, "cols");
         if (!cols_json || !cJSON_IsNumber(cols_json)) {
             load_ok = false;
             continue;
         }
-        net->cols = (uint32_t) cols_json->valuedouble;
+        uint32_t cols = (uint32_t) cols_json->valuedouble;
 
         cJSON *network_data = cJSON_GetObjectItemCaseSensitive(net_obj, "networkData");
-        if (!network_data || !cJSON_IsArray(network_data) || (int) net->rows != cJSON_GetArraySize(network_data)) {
+        if (!network_data || !cJSON_IsArray(network_data) || (int) rows != cJSON_GetArraySize(network_data)) {
             load_ok = false;
             continue;
         }
 
-        net->cells = (ladder_cell_t**) calloc(net->rows, sizeof(ladder_cell_t*));
-        if (!net->cells) {
+        // sparse networks list only the non empty cells of each row with their column (missing cells are NOP), dense ones every column
+        cJSON *sparse_json = cJSON_GetObjectItemCaseSensitive(net_obj, "sparse");
+        if (sparse_json && !cJSON_IsBool(sparse_json)) {
             load_ok = false;
             continue;
         }
+        bool sparse = cJSON_IsTrue(sparse_json) || network_has_col(network_data);
 
-        bool alloc_ok = true;
-        for (uint32_t r = 0; r < net->rows && alloc_ok; r++) {
-            net->cells[r] = (ladder_cell_t*) calloc(net->cols, sizeof(ladder_cell_t));
-            if (!net->cells[r]) {
-                alloc_ok = false;
-            }
-        }
-        if (!alloc_ok) {
-            for (uint32_t r = 0; r < net->rows; r++) {
-                if (net->cells[r]) {
-                    free(net->cells[r]);
-                }
-            }
-            free(net->cells);
-            net->cells = NULL;
-            net->rows = 0;
-            net->cols = 0;
+        // cleared cells block of the same shape is reused, otherwise reallocated
+        if ((net->cells == NULL || net->rows != rows || net->cols != cols) && !ladder_network_alloc(net, rows, cols)) {
             load_ok = false;
             continue;
         }
+        net->arena = arena;
 
         bool parse_ok = true;
         for (uint32_t r = 0; r < net->rows && parse_ok; r++) {
             cJSON *row_array = cJSON_GetArrayItem(network_data, r);
-            if (!cJSON_IsArray(row_array) || (int) net->cols != cJSON_GetArraySize(row_array)) {
+            int cells_qty = cJSON_IsArray(row_array) ? cJSON_GetArraySize(row_array) : -1;
+            if (cells_qty < 0 || cells_qty > (int) net->cols || (!sparse && cells_qty != (int) net->cols)) {
                 parse_ok = false;
                 continue;
             }
 
-            for (uint32_t c = 0; c < net->cols && parse_ok; c++) {
-                cJSON *cell_obj = cJSON_GetArrayItem(row_array, c);
+            uint32_t next_col = 0;
+            for (int k = 0; k < cells_qty && parse_ok; k++) {
+                cJSON *cell_obj = cJSON_GetArrayItem(row_array, k);
                 if (!cJSON_IsObject(cell_obj)) {
                     parse_ok = false;
                     continue;
                 }
 
+                uint32_t c = next_col;
+                cJSON *col_json = cJSON_GetObjectItemCaseSensitive(cell_obj, "col");
+                if (col_json) {
+                    if (!cJSON_IsNumber(col_json) || col_json->valuedouble < next_col || col_json->valuedouble >= net->cols) {
+                        parse_ok = false;
+                        continue;
+                    }
+                    c = (uint32_t) col_json->valuedouble;
+                }
+                next_col = c + 1;
+
                 cJSON *symbol_json = cJSON_GetObjectItemCaseSensitive(cell_obj, "symbol");
                 if (!symbol_json || !cJSON_IsString(symbol_json)) {
                     parse_ok = false;
                     continue;
                 }
-                ladder_instruction_t code = get_instruction_code(symbol_json->valuestring);
+                ladder_instruction_t code = get_instruction_code(ladder_ctx, symbol_json->valuestring);
                 if (code == LADDER_INS_INV) {
                     parse_ok = false;
                     continue;
@@ -752,7 +764,10 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
                     continue;
                 }
                 int data_qty = cJSON_GetArraySize(data_array);
-                if (data_qty != (int) ladder_fn_iocd[code].data_qty) {
+                const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, code);
+                // cells occupied by a multi cell instruction have no data (and no entry in ladder_fn_iocd)
+                uint8_t code_data_qty = custom != NULL ? custom->description.data_qty : code == LADDER_INS_MULTI ? 0 : ladder_fn_iocd[code].data_qty;
+                if (data_qty != (int) code_data_qty) {
                     parse_ok = false;
                     continue;
                 }
@@ -762,7 +777,7 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
                     continue;
                 }
 
-                cell->data = (ladder_value_t*) calloc((size_t) data_qty, sizeof(ladder_value_t));
+                cell->data = (ladder_value_t*) ladder_arena_alloc(arena, (size_t) data_qty * sizeof(ladder_value_t));
                 if (!cell->data) {
                     parse_ok = false;
                     continue;
@@ -828,7 +843,7 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
                         val->type = reg_type;
 
                         if (reg_type == LADDER_REGISTER_S) {
-                            val->value.cstr = strdup(value_str);
+                            val->value.cstr = ladder_arena_strdup(arena, value_str);
                             if (!val->value.cstr) {
                                 data_parse_ok = false;
                                 continue;
@@ -856,14 +871,7 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
                 }
 
                 if (!data_parse_ok) {
-                    for (uint8_t dd = 0; dd < cell->data_qty; dd++) {
-                        if (cell->data[dd].type == LADDER_REGISTER_S && cell->data[dd].value.cstr) {
-                            free((void*) cell->data[dd].value.cstr);
-                        }
-                    }
-                    free(cell->data);
-                    cell->data = NULL;
-                    cell->data_qty = 0;
+                    ladder_cell_data_free(net, cell);
                     parse_ok = false;
                 }
             }
@@ -871,21 +879,7 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
 
         if (!parse_ok) {
             // Cleanup this network on parse failure
-            for (uint32_t rr = 0; rr < net->rows; rr++) {
-                for (uint32_t cc = 0; cc < net->cols; cc++) {
-                    if (net->cells[rr][cc].data_qty > 0 && net->cells[rr][cc].data) {
-                        for (uint8_t dd = 0; dd < net->cells[rr][cc].data_qty; dd++) {
-                            if (net->cells[rr][cc].data[dd].type == LADDER_REGISTER_S && net->cells[rr][cc].data[dd].value.cstr) {
-                                free((void*) net->cells[rr][cc].data[dd].value.cstr);
-                            }
-                        }
-                        free(net->cells[rr][cc].data);
-                    }
-                }
-                free(net->cells[rr]);
-            }
-            free(net->cells);
-            net->cells = NULL;
+            ladder_network_free(net);
             net->rows = 0;
             net->cols = 0;
             load_ok = false;
@@ -896,11 +890,14 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
         ladder_clear_program(ladder_ctx);
     }
 
+    // networks were reloaded: drop any compiled form
+    ladder_program_changed(ladder_ctx);
+
     cJSON_Delete(root);
     return load_ok ? JSON_ERROR_OK : JSON_ERROR_FAIL;
 }
 
-ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder_ctx) {
+static ladder_json_error_t ladder_program_to_json_write(const char *prg, ladder_ctx_t *ladder_ctx, bool sparse) {
     FILE *fp = fopen(prg, "w");
     if (fp == NULL) {
         return JSON_ERROR_OPENFILE;
@@ -923,6 +920,8 @@ ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder
         cJSON_AddNumberToObject(network_obj, "id", n);
         cJSON_AddNumberToObject(network_obj, "rows", (*ladder_ctx).network[n].rows);
         cJSON_AddNumberToObject(network_obj, "cols", (*ladder_ctx).network[n].cols);
+        if (sparse)
+            cJSON_AddBoolToObject(network_obj, "sparse", true);
 
         cJSON *networkData = cJSON_CreateArray();
         if (networkData == NULL) {
@@ -944,6 +943,9 @@ ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder
 
             for (uint32_t c = 0; c < (*ladder_ctx).network[n].cols; c++) {
                 ladder_cell_t *cell = &((*ladder_ctx).network[n].cells[r][c]);
+                if (sparse && ladder_topology_empty(cell))
+                    continue;
+
                 cJSON *cell_obj = cJSON_CreateObject();
                 if (cell_obj == NULL) {
                     cJSON_Delete(row_array);
@@ -954,7 +956,11 @@ ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder
                     return JSON_ERROR_CREATECELLOBJ;
                 }
 
-                const char *symbol = (cell->code < sizeof(str_symbol) / sizeof(str_symbol[0])) ? str_symbol[cell->code] : "INV";
+                if (sparse)
+                    cJSON_AddNumberToObject(cell_obj, "col", c);
+
+                const ladder_custom_t *custom = ladder_custom_get(ladder_ctx, cell->code);
+                const char *symbol = (cell->code < sizeof(str_symbol) / sizeof(str_symbol[0])) ? str_symbol[cell->code] : custom != NULL ? custom->name : "INV";
                 cJSON_AddStringToObject(cell_obj, "symbol", symbol);
                 cJSON_AddBoolToObject(cell_obj, "bar", cell->vertical_bar);
 
@@ -1055,6 +1061,14 @@ ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder
     return JSON_ERROR_OK;
 }
 
+ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder_ctx) {
+    return ladder_program_to_json_write(prg, ladder_ctx, false);
+}
+
+ladder_json_error_t ladder_program_to_json_sparse(const char *prg, ladder_ctx_t *ladder_ctx) {
+    return ladder_program_to_json_write(prg, ladder_ctx, true);
+}
+
 ladder_json_error_t ladder_compact_json_file(const char *input_path, const char *output_path) {
     ladder_json_error_t status = JSON_ERROR_FAIL;
     char *json_str = NULL;
@@ -79,6 +79,17 @@ ladder_json_error_t ladder_json_to_program(const char *prg, ladder_ctx_t *ladder
  */
 ladder_json_error_t ladder_program_to_json(const char *prg, ladder_ctx_t *ladder_ctx);
 
+/**
+ * @fn ladder_json_error_t ladder_program_to_json_sparse(const char *prg, ladder_ctx_t* ladder_ctx)
+ * @brief Save program writing only non empty cells (not NOP, vertical bar or data), each one with its "col", in networks marked "sparse".
+ *        ladder_json_to_program reads both formats.
+ *
+ * @param prg prg file name of JSON program
+ * @param ladder_ctx Ladder context
+ * @return Status
+ */
+ladder_json_error_t ladder_program_to_json_sparse(const char *prg, ladder_ctx_t *ladder_ctx);
+
 /**
  * @fn ladder_json_error_t ladder_compact_json_file(const char *input_path, const char *output_path)
  * @brief